@@ -234,7 +234,7 @@ ifneq ("$(wildcard $(KEYMAP_JSON))", "")
 # Add rules to generate the keymap files - indentation here is important
 $(INTERMEDIATE_OUTPUT)/src/keymap.c: $(KEYMAP_JSON) $(DD_CONFIG_FILES)
 	@$(SILENT) || printf "$(MSG_GENERATING) $@" | $(AWK_CMD)
-	$(eval CMD=$(QMK_BIN) json2c --quiet --output $(KEYMAP_C) $(KEYMAP_JSON))
+	$(eval CMD=$(QMK_BIN) json2c --quiet $(if $(filter yes,$(strip $(KEYMAP_COMPRESSION_ENABLE))),--compress) --output $(KEYMAP_C) $(KEYMAP_JSON))
 	@$(BUILD_CMD)
 
 $(INTERMEDIATE_OUTPUT)/src/config.h: $(KEYMAP_JSON) $(DD_CONFIG_FILES)
@@ -18,7 +18,13 @@ MAGIC_ENABLE ?= yes
 SEND_STRING_ENABLE ?= yes
 SPACE_CADET_ENABLE ?= yes
 
+# Lookups into compressed keymaps go through the keymap cache
+ifeq ($(strip $(KEYMAP_COMPRESSION_ENABLE)), yes)
+    KEYMAP_CACHE_ENABLE ?= yes
+endif
+
 GENERIC_FEATURES = \
+    ADAPTIVE_TICK \
     AUTO_SHIFT \
     AUTOCORRECT \
     BATTERY \
@@ -37,18 +43,23 @@ GENERIC_FEATURES = \
     GRAVE_ESC \
     HAPTIC \
     KEYCODE_STRING \
+    KEYMAP_CACHE \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
+    MATRIX_EVENT_QUEUE \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILER \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
     SEND_STRING \
+    SEND_STRING_ASYNC \
     SEQUENCER \
     SPACE_CADET \
     SWAP_HANDS \
@@ -33,7 +33,8 @@
     there is nothing to override during linkage.
 */
 
-#include "wait.h"
+#include "compiler_support.h"
+#include "timer.h"
 #include "i2c_master.h"
 #include "eeprom.h"
 #include "eeprom_driver.h"
@@ -42,10 +43,24 @@
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-#    include "timer.h"
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#ifndef EXTERNAL_EEPROM_I2C_TIMEOUT
+#    define EXTERNAL_EEPROM_I2C_TIMEOUT 100
+#endif
+
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+STATIC_ASSERT((EXTERNAL_EEPROM_READ_AHEAD_SIZE & (EXTERNAL_EEPROM_READ_AHEAD_SIZE - 1)) == 0, "EXTERNAL_EEPROM_READ_AHEAD_SIZE must be a power of two");
+
+static uint8_t   read_ahead_buffer[EXTERNAL_EEPROM_READ_AHEAD_SIZE];
+static uintptr_t read_ahead_address;
+static bool      read_ahead_valid = false;
+#endif // EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+
+static bool     write_in_progress = false;
+static uint32_t write_start;
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -54,8 +69,47 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
+/*
+    The EEPROM does not acknowledge its address while a write cycle is in
+    progress, so rather than waiting for the worst-case write time after every
+    page, the next transaction is retried until the EEPROM responds.
+*/
+static i2c_status_t i2c_eeprom_transmit(uintptr_t addr, const uint8_t *data, uint16_t length, uint8_t *rx_data, uint16_t rx_length) {
+    i2c_status_t status;
+    do {
+        if (rx_length > 0) {
+            status = i2c_transmit_and_receive(EXTERNAL_EEPROM_I2C_ADDRESS(addr), data, length, rx_data, rx_length, EXTERNAL_EEPROM_I2C_TIMEOUT);
+        } else {
+            status = i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), data, length, EXTERNAL_EEPROM_I2C_TIMEOUT);
+        }
+    } while (status != I2C_STATUS_SUCCESS && write_in_progress && timer_elapsed32(write_start) <= EXTERNAL_EEPROM_WRITE_TIME);
+
+    write_in_progress = false;
+    return status;
+}
+
+static bool i2c_eeprom_read(void *buf, uintptr_t addr, size_t len) {
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
+    fill_target_address(complete_packet, (const void *)addr);
+
+    i2c_status_t status = i2c_eeprom_transmit(addr, complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, buf, len);
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
+    for (size_t i = 0; i < len; ++i) {
+        dprintf(" %02X", (int)(((uint8_t *)buf)[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+
+    return status == I2C_STATUS_SUCCESS;
+}
+
 void eeprom_driver_init(void) {
     i2c_init();
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    read_ahead_valid = false;
+#endif
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
@@ -87,19 +141,20 @@ void eeprom_driver_erase(void) {
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
-    fill_target_address(complete_packet, addr);
-
-    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
-    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-    dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
-    for (size_t i = 0; i < len; ++i) {
-        dprintf(" %02X", (int)(((uint8_t *)buf)[i]));
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    // Small reads are served from an aligned window, so that sequential reads only hit the bus once per window
+    uintptr_t window = (uintptr_t)addr & ~(uintptr_t)(EXTERNAL_EEPROM_READ_AHEAD_SIZE - 1);
+    if ((uintptr_t)addr + len <= window + EXTERNAL_EEPROM_READ_AHEAD_SIZE) {
+        if (!read_ahead_valid || read_ahead_address != window) {
+            read_ahead_valid   = i2c_eeprom_read(read_ahead_buffer, window, EXTERNAL_EEPROM_READ_AHEAD_SIZE);
+            read_ahead_address = window;
+        }
+        memcpy(buf, &read_ahead_buffer[(uintptr_t)addr - window], len);
+        return;
     }
-    dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
+#endif // EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+
+    i2c_eeprom_read(buf, (uintptr_t)addr, len);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
@@ -107,6 +162,12 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     uint8_t  *read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
 
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    if (read_ahead_valid && target_addr < read_ahead_address + EXTERNAL_EEPROM_READ_AHEAD_SIZE && target_addr + len > read_ahead_address) {
+        read_ahead_valid = false;
+    }
+#endif // EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
@@ -132,8 +193,10 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         dprintf("\n");
 #endif // DEBUG_EEPROM_OUTPUT
 
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+        if (i2c_eeprom_transmit(target_addr, complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, NULL, 0) == I2C_STATUS_SUCCESS) {
+            write_in_progress = true;
+            write_start       = timer_read32();
+        }
 
         read_buf += write_length;
         target_addr += write_length;
@@ -123,3 +123,12 @@
 #ifndef EXTERNAL_EEPROM_WRITE_TIME
 #    define EXTERNAL_EEPROM_WRITE_TIME 5
 #endif
+
+/*
+    The number of bytes read at a time for small reads, which are then served
+    from RAM until a read falls outside of them. Needs to be a power of two,
+    or 0 to disable.
+*/
+#ifndef EXTERNAL_EEPROM_READ_AHEAD_SIZE
+#    define EXTERNAL_EEPROM_READ_AHEAD_SIZE 32
+#endif
@@ -30,7 +30,7 @@
     there is nothing to override during linkage.
 */
 
-#include "wait.h"
+#include "compiler_support.h"
 #include "debug.h"
 #include "timer.h"
 #include "spi_master.h"
@@ -53,12 +53,27 @@
 #    define EXTERNAL_EEPROM_SPI_TIMEOUT 100
 #endif
 
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+STATIC_ASSERT((EXTERNAL_EEPROM_READ_AHEAD_SIZE & (EXTERNAL_EEPROM_READ_AHEAD_SIZE - 1)) == 0, "EXTERNAL_EEPROM_READ_AHEAD_SIZE must be a power of two");
+
+static uint8_t   read_ahead_buffer[EXTERNAL_EEPROM_READ_AHEAD_SIZE];
+static uintptr_t read_ahead_address;
+static bool      read_ahead_valid = false;
+#endif // EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+
+// Only a write can leave the EEPROM busy, assume one may be in progress from before a reset
+static bool write_in_progress = true;
+
 static bool spi_eeprom_start(void) {
     return spi_start(EXTERNAL_EEPROM_SPI_SLAVE_SELECT_PIN, EXTERNAL_EEPROM_SPI_LSBFIRST, EXTERNAL_EEPROM_SPI_MODE, EXTERNAL_EEPROM_SPI_CLOCK_DIVISOR);
 }
 
 static spi_status_t spi_eeprom_wait_while_busy(int timeout) {
-    uint32_t     deadline = timer_read32() + timeout;
+    if (!write_in_progress) {
+        return SPI_STATUS_SUCCESS;
+    }
+
+    uint32_t     start    = timer_read32();
     spi_status_t response = SR_WIP;
     while (response & SR_WIP) {
         if (!spi_eeprom_start()) {
@@ -69,10 +84,14 @@ static spi_status_t spi_eeprom_wait_while_busy(int timeout) {
         response = spi_read();
         spi_stop();
 
-        if (timer_read32() >= deadline) {
+        if (response < 0) {
+            return response;
+        }
+        if ((response & SR_WIP) && timer_elapsed32(start) >= timeout) {
             return SPI_STATUS_TIMEOUT;
         }
     }
+    write_in_progress = false;
     return SPI_STATUS_SUCCESS;
 }
 
@@ -91,6 +110,10 @@ static void spi_eeprom_transmit_address(uintptr_t addr) {
 
 void eeprom_driver_init(void) {
     spi_init();
+    write_in_progress = true;
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    read_ahead_valid = false;
+#endif
 }
 
 void eeprom_driver_format(bool erase) {
@@ -116,7 +139,7 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+static bool spi_eeprom_read(void *buf, uintptr_t addr, size_t len) {
     //-------------------------------------------------
     // Wait for the write-in-progress bit to be cleared
     spi_status_t response = spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT);
@@ -124,7 +147,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
         spi_stop();
         memset(buf, 0, len);
         dprint("SPI timeout for WIP check\n");
-        return;
+        return false;
     }
 
     //-------------------------------------------------
@@ -134,15 +157,15 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
         spi_stop();
         memset(buf, 0, len);
         dprint("failed to start SPI for read\n");
-        return;
+        return false;
     }
 
     spi_write(CMD_READ);
-    spi_eeprom_transmit_address((uintptr_t)addr);
+    spi_eeprom_transmit_address(addr);
     spi_receive(buf, len);
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-    dprintf("[EEPROM R] 0x%08lX: ", ((uint32_t)(uintptr_t)addr));
+    dprintf("[EEPROM R] 0x%08lX: ", ((uint32_t)addr));
     for (size_t i = 0; i < len; ++i) {
         dprintf(" %02X", (int)(((uint8_t *)buf)[i]));
     }
@@ -150,6 +173,24 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 #endif // DEBUG_EEPROM_OUTPUT
 
     spi_stop();
+    return true;
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    // Small reads are served from an aligned window, so that sequential reads only hit the bus once per window
+    uintptr_t window = (uintptr_t)addr & ~(uintptr_t)(EXTERNAL_EEPROM_READ_AHEAD_SIZE - 1);
+    if ((uintptr_t)addr + len <= window + EXTERNAL_EEPROM_READ_AHEAD_SIZE) {
+        if (!read_ahead_valid || read_ahead_address != window) {
+            read_ahead_valid   = spi_eeprom_read(read_ahead_buffer, window, EXTERNAL_EEPROM_READ_AHEAD_SIZE);
+            read_ahead_address = window;
+        }
+        memcpy(buf, &read_ahead_buffer[(uintptr_t)addr - window], len);
+        return;
+    }
+#endif // EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+
+    spi_eeprom_read(buf, (uintptr_t)addr, len);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
@@ -157,6 +198,12 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     uint8_t  *read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
 
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    if (read_ahead_valid && target_addr < read_ahead_address + EXTERNAL_EEPROM_READ_AHEAD_SIZE && target_addr + len > read_ahead_address) {
+        read_ahead_valid = false;
+    }
+#endif // EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+
     while (len > 0) {
         uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
         int       write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
@@ -206,20 +253,13 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         spi_eeprom_transmit_address(target_addr);
         spi_transmit(read_buf, write_length);
         spi_stop();
+        write_in_progress = true;
 
         read_buf += write_length;
         target_addr += write_length;
         len -= write_length;
     }
 
-    //-------------------------------------------------
-    // Disable writes
-    res = spi_eeprom_start();
-    if (!res) {
-        dprint("failed to start SPI for write-disable\n");
-        return;
-    }
-
-    spi_write(CMD_WRDI);
-    spi_stop();
+    // No need to disable writes, the write-enable latch is reset once each write cycle completes -- the EEPROM would
+    // ignore anything but a status read until then anyway
 }
@@ -45,14 +45,19 @@
 #    define AW20216S_SPI_DIVISOR 4
 #endif
 
+// The PWM registers that changed since the last flush are tracked as a single
+// range, which is written in one auto-incrementing SPI transfer. The range is
+// empty when pwm_dirty_end (exclusive) is 0.
 typedef struct aw20216s_driver_t {
     uint8_t pwm_buffer[AW20216S_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_dirty_start;
+    uint8_t pwm_dirty_end;
 } PACKED aw20216s_driver_t;
 
 aw20216s_driver_t driver_buffers[AW20216S_DRIVER_COUNT] = {{
-    .pwm_buffer       = {0},
-    .pwm_buffer_dirty = false,
+    .pwm_buffer      = {0},
+    .pwm_dirty_start = 0,
+    .pwm_dirty_end   = 0,
 }};
 
 bool aw20216s_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
@@ -122,6 +127,13 @@ void aw20216s_init_drivers(void) {
 #if defined(AW20216S_CS_PIN_2)
     aw20216s_init(AW20216S_CS_PIN_2);
 #endif
+
+    // The soft reset cleared the PWM registers, so the next flush has to
+    // send all of them.
+    for (uint8_t i = 0; i < AW20216S_DRIVER_COUNT; i++) {
+        driver_buffers[i].pwm_dirty_start = 0;
+        driver_buffers[i].pwm_dirty_end   = AW20216S_PWM_REGISTER_COUNT;
+    }
 }
 
 void aw20216s_init(pin_t cs_pin) {
@@ -136,6 +148,23 @@ void aw20216s_init(pin_t cs_pin) {
     aw20216s_auto_lowpower(cs_pin);
 }
 
+static void aw20216s_set_pwm_value(uint8_t driver, uint8_t reg, uint8_t value) {
+    if (driver_buffers[driver].pwm_buffer[reg] == value) {
+        return;
+    }
+
+    driver_buffers[driver].pwm_buffer[reg] = value;
+
+    if (driver_buffers[driver].pwm_dirty_end == 0) {
+        driver_buffers[driver].pwm_dirty_start = reg;
+        driver_buffers[driver].pwm_dirty_end   = reg + 1;
+    } else if (reg < driver_buffers[driver].pwm_dirty_start) {
+        driver_buffers[driver].pwm_dirty_start = reg;
+    } else if (reg >= driver_buffers[driver].pwm_dirty_end) {
+        driver_buffers[driver].pwm_dirty_end = reg + 1;
+    }
+}
+
 void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     aw20216s_led_t led;
     memcpy_P(&led, (&g_aw20216s_leds[index]), sizeof(led));
@@ -144,10 +173,9 @@ void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         return;
     }
 
-    driver_buffers[led.driver].pwm_buffer[led.r] = red;
-    driver_buffers[led.driver].pwm_buffer[led.g] = green;
-    driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-    driver_buffers[led.driver].pwm_buffer_dirty  = true;
+    aw20216s_set_pwm_value(led.driver, led.r, red);
+    aw20216s_set_pwm_value(led.driver, led.g, green);
+    aw20216s_set_pwm_value(led.driver, led.b, blue);
 }
 
 void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -157,9 +185,12 @@ void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, 0, driver_buffers[index].pwm_buffer, AW20216S_PWM_REGISTER_COUNT);
-        driver_buffers[index].pwm_buffer_dirty = false;
+    const uint8_t start = driver_buffers[index].pwm_dirty_start;
+    const uint8_t end   = driver_buffers[index].pwm_dirty_end;
+
+    if (end != 0) {
+        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, start, driver_buffers[index].pwm_buffer + start, end - start);
+        driver_buffers[index].pwm_dirty_end = 0;
     }
 }
 
@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_TILE_ROWS
+/**
+ * @def This controls how many rows of tiles are used to track which parts of a surface have changed, with up to 32
+ *      tiles in each row. Tiles are at least 8x8 pixels, and are made bigger to cover larger surfaces. Only the changed
+ *      tiles are sent when the surface is drawn to a display. Each row costs 4 bytes of RAM per surface.
+ */
+#    define SURFACE_DIRTY_TILE_ROWS 16
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
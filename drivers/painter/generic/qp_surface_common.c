@@ -47,6 +47,61 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    // Mark the tile containing the pixel, as it may be inside the existing region without being part of it
+    dirty->tiles[y >> dirty->tile_shift_y] |= 1UL << (x >> dirty->tile_shift_x);
+}
+
+static void qp_surface_mark_all_tiles(surface_painter_device_t *surface) {
+    uint32_t tile_cols = ((uint32_t)surface->base.panel_width + (1UL << surface->dirty.tile_shift_x) - 1) >> surface->dirty.tile_shift_x;
+    uint32_t tile_rows = ((uint32_t)surface->base.panel_height + (1UL << surface->dirty.tile_shift_y) - 1) >> surface->dirty.tile_shift_y;
+    uint32_t row_mask  = tile_cols >= 32 ? UINT32_MAX : ((1UL << tile_cols) - 1);
+    for (uint32_t i = 0; i < SURFACE_DIRTY_TILE_ROWS; ++i) {
+        surface->dirty.tiles[i] = i < tile_rows ? row_mask : 0;
+    }
+}
+
+bool qp_surface_for_each_dirty_rect(surface_dirty_data_t *dirty, surface_dirty_rect_callback_t callback, void *cb_arg) {
+    // Work on a copy, as tiles get consumed when they're merged into a rectangle
+    uint32_t tiles[SURFACE_DIRTY_TILE_ROWS];
+    memcpy(tiles, dirty->tiles, sizeof(tiles));
+
+    for (uint16_t row = 0; row < SURFACE_DIRTY_TILE_ROWS; ++row) {
+        while (tiles[row] != 0) {
+            // Find the first horizontal run of dirty tiles in this row
+            uint8_t  start    = __builtin_ctzl(tiles[row]);
+            uint32_t run      = tiles[row] >> start;
+            uint8_t  length   = (~run == 0) ? (32 - start) : __builtin_ctzl(~run);
+            uint32_t run_mask = (length >= 32 ? UINT32_MAX : ((1UL << length) - 1)) << start;
+            tiles[row] &= ~run_mask;
+
+            // Grow the run downwards for as long as the rows below contain the same tiles
+            uint16_t end_row = row + 1;
+            while (end_row < SURFACE_DIRTY_TILE_ROWS && (tiles[end_row] & run_mask) == run_mask) {
+                tiles[end_row] &= ~run_mask;
+                ++end_row;
+            }
+
+            // Convert to pixels, never going outside the overall dirty region
+            uint32_t l = (uint32_t)start << dirty->tile_shift_x;
+            uint32_t t = (uint32_t)row << dirty->tile_shift_y;
+            uint32_t r = (((uint32_t)start + length) << dirty->tile_shift_x) - 1;
+            uint32_t b = ((uint32_t)end_row << dirty->tile_shift_y) - 1;
+            l          = MAX(l, dirty->l);
+            t          = MAX(t, dirty->t);
+            r          = MIN(r, dirty->r);
+            b          = MIN(b, dirty->b);
+            if (l > r || t > b) {
+                continue;
+            }
+
+            if (!callback(cb_arg, l, t, r, b)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +118,18 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    // Pick the smallest tiles that still allow the whole surface to be tracked, starting with 8 pixels to line up with
+    // the pages on monochrome panels
+    surface->dirty.tile_shift_x = 3;
+    while (((uint32_t)surface->base.panel_width + (1UL << surface->dirty.tile_shift_x) - 1) >> surface->dirty.tile_shift_x > 32) {
+        surface->dirty.tile_shift_x++;
+    }
+    surface->dirty.tile_shift_y = 3;
+    while (((uint32_t)surface->base.panel_height + (1UL << surface->dirty.tile_shift_y) - 1) >> surface->dirty.tile_shift_y > SURFACE_DIRTY_TILE_ROWS) {
+        surface->dirty.tile_shift_y++;
+    }
+    qp_surface_mark_all_tiles(surface);
+
     return true;
 }
 
@@ -83,6 +150,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    memset(surface->dirty.tiles, 0, sizeof(surface->dirty.tiles));
     return true;
 }
 
@@ -102,6 +170,25 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Transfer helper, sending each of the changed rectangles (or the whole surface) through the supplied callback
+
+bool qp_surface_transfer_dirty_rects(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface, surface_dirty_rect_callback_t callback) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    surface_transfer_data_t   transfer       = {
+        .surface_driver = surface_driver,
+        .target_driver  = target_driver,
+        .x              = x,
+        .y              = y,
+    };
+
+    if (entire_surface) {
+        return callback(&transfer, 0, 0, surface_driver->panel_width - 1, surface_driver->panel_height - 1);
+    }
+
+    return qp_surface_for_each_dirty_rect(&surface_handle->dirty, callback, &transfer);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
@@ -22,8 +22,24 @@ typedef struct surface_dirty_data_t {
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // The tiles which have changed within the region above, one bit per column of tiles
+    uint8_t  tile_shift_x;
+    uint8_t  tile_shift_y;
+    uint32_t tiles[SURFACE_DIRTY_TILE_ROWS];
 } surface_dirty_data_t;
 
+// Invoked with each changed rectangle of a surface, inclusive of the right and bottom edges
+typedef bool (*surface_dirty_rect_callback_t)(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
+
+// Everything needed to send a changed rectangle of a surface to another device
+typedef struct surface_transfer_data_t {
+    painter_driver_t *surface_driver;
+    painter_driver_t *target_driver;
+    uint16_t          x;
+    uint16_t          y;
+} surface_transfer_data_t;
+
 typedef struct surface_viewport_data_t {
     // Manually manage the viewport for streaming pixel data to the display
     uint16_t viewport_l;
@@ -90,6 +106,8 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+bool qp_surface_for_each_dirty_rect(surface_dirty_data_t *dirty, surface_dirty_rect_callback_t callback, void *cb_arg);
+bool qp_surface_transfer_dirty_rects(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface, surface_dirty_rect_callback_t callback);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
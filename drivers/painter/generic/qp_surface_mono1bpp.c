@@ -84,8 +84,63 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
+static bool mono1bpp_target_pixdata_transfer_rect(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_transfer_data_t  *transfer       = (surface_transfer_data_t *)cb_arg;
+    painter_driver_t         *surface_driver = transfer->surface_driver;
+    painter_driver_t         *target_driver  = transfer->target_driver;
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    // Set the target drawing area
+    bool ok = qp_viewport((painter_device_t)target_driver, transfer->x + l, transfer->y + t, transfer->x + r, transfer->y + b);
+    if (!ok) {
+        qp_dprintf("mono1bpp_target_pixdata_transfer_rect: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    uint32_t total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    uint32_t pixel_counter     = 0;
+    uint8_t *target_buffer     = (uint8_t *)qp_internal_global_pixdata_buffer;
+
+    // Fill the global pixdata area so that we can start transferring to the panel, packing the pixels LSB-first
+    memset(target_buffer, 0, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+    for (uint16_t y = t; y <= b; ++y) {
+        for (uint16_t x = l; x <= r; ++x) {
+            // Update the target buffer
+            uint32_t pixel_num = y * surface_handle->base.panel_width + x;
+            if (surface_handle->u8buffer[pixel_num / 8] & (1 << (pixel_num % 8))) {
+                target_buffer[pixel_counter / 8] |= (1 << (pixel_counter % 8));
+            }
+            ++pixel_counter;
+
+            // If we've accumulated enough data, send it
+            if (pixel_counter == total_pixel_count) {
+                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                if (!ok) {
+                    qp_dprintf("mono1bpp_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
+                    return false;
+                }
+                // Reset the counter and the packed bits
+                pixel_counter = 0;
+                memset(target_buffer, 0, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (pixel_counter > 0) {
+        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+        if (!ok) {
+            qp_dprintf("mono1bpp_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    return false; // Not yet supported.
+    return qp_surface_transfer_dirty_rects(surface_driver, target_driver, x, y, entire_surface, mono1bpp_target_pixdata_transfer_rect);
 }
 
 static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
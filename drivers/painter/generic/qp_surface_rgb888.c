@@ -66,18 +66,16 @@ static bool qp_surface_append_pixels_rgb888(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb888_target_pixdata_transfer_rect(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_transfer_data_t  *transfer       = (surface_transfer_data_t *)cb_arg;
+    painter_driver_t         *surface_driver = transfer->surface_driver;
+    painter_driver_t         *target_driver  = transfer->target_driver;
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
     // Set the target drawing area
-    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    bool ok = qp_viewport((painter_device_t)target_driver, transfer->x + l, transfer->y + t, transfer->x + r, transfer->y + b);
     if (!ok) {
-        qp_dprintf("rgb888_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_dprintf("rgb888_target_pixdata_transfer_rect: fail (could not set target viewport)\n");
         return false;
     }
 
@@ -96,7 +94,7 @@ static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, pai
             if (pixel_counter == total_pixel_count) {
                 ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
                 if (!ok) {
-                    qp_dprintf("rgb888_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    qp_dprintf("rgb888_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
                     return false;
                 }
                 // Reset the counter
@@ -109,7 +107,7 @@ static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     if (pixel_counter > 0) {
         ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
         if (!ok) {
-            qp_dprintf("rgb888_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            qp_dprintf("rgb888_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
             return false;
         }
     }
@@ -117,6 +115,10 @@ static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    return qp_surface_transfer_dirty_rects(surface_driver, target_driver, x, y, entire_surface, rgb888_target_pixdata_transfer_rect);
+}
+
 static bool qp_surface_append_pixdata_rgb888(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
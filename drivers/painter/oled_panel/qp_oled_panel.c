@@ -58,15 +58,24 @@ bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *tar
 // Flush helpers
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
-    painter_driver_t                   *driver = (painter_driver_t *)device;
-    oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
+// Where each of the changed rectangles of the surface are sent
+typedef struct oled_panel_flush_data_t {
+    painter_device_t device;
+    const uint8_t   *framebuffer;
+} oled_panel_flush_data_t;
+
+static bool qp_oled_panel_page_column_flush_rect_rot0(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    oled_panel_flush_data_t            *flush       = (oled_panel_flush_data_t *)cb_arg;
+    painter_device_t                    device      = flush->device;
+    const uint8_t                      *framebuffer = flush->framebuffer;
+    painter_driver_t                   *driver      = (painter_driver_t *)device;
+    oled_panel_painter_driver_vtable_t *vtable      = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
-    int min_page   = dirty->t / 8;
-    int max_page   = dirty->b / 8;
-    int min_column = dirty->l;
-    int max_column = dirty->r;
+    int min_page   = t / 8;
+    int max_page   = b / 8;
+    int min_column = l;
+    int max_column = r;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -89,18 +98,28 @@ void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty
         qp_comms_command(device, vtable->opcodes.set_column_msb | (start_column & 0xF0) >> 4);
         qp_comms_send(device, column_data, cols_required);
     }
+
+    return true;
 }
 
-void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
-    painter_driver_t                   *driver = (painter_driver_t *)device;
-    oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
+void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    oled_panel_flush_data_t flush = {.device = device, .framebuffer = framebuffer};
+    qp_surface_for_each_dirty_rect(dirty, qp_oled_panel_page_column_flush_rect_rot0, &flush);
+}
+
+static bool qp_oled_panel_page_column_flush_rect_rot90(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    oled_panel_flush_data_t            *flush       = (oled_panel_flush_data_t *)cb_arg;
+    painter_device_t                    device      = flush->device;
+    const uint8_t                      *framebuffer = flush->framebuffer;
+    painter_driver_t                   *driver      = (painter_driver_t *)device;
+    oled_panel_painter_driver_vtable_t *vtable      = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
     int num_columns = driver->panel_width;
-    int min_page    = dirty->l / 8;
-    int max_page    = dirty->r / 8;
-    int min_column  = dirty->t;
-    int max_column  = dirty->b;
+    int min_page    = l / 8;
+    int max_page    = r / 8;
+    int min_column  = t;
+    int max_column  = b;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -123,19 +142,29 @@ void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirt
         qp_comms_command(device, vtable->opcodes.set_column_msb | (start_column & 0xF0) >> 4);
         qp_comms_send(device, column_data, cols_required);
     }
+
+    return true;
 }
 
-void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
-    painter_driver_t                   *driver = (painter_driver_t *)device;
-    oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
+void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    oled_panel_flush_data_t flush = {.device = device, .framebuffer = framebuffer};
+    qp_surface_for_each_dirty_rect(dirty, qp_oled_panel_page_column_flush_rect_rot90, &flush);
+}
+
+static bool qp_oled_panel_page_column_flush_rect_rot180(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    oled_panel_flush_data_t            *flush       = (oled_panel_flush_data_t *)cb_arg;
+    painter_device_t                    device      = flush->device;
+    const uint8_t                      *framebuffer = flush->framebuffer;
+    painter_driver_t                   *driver      = (painter_driver_t *)device;
+    oled_panel_painter_driver_vtable_t *vtable      = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
     int num_pages   = driver->panel_height / 8;
     int num_columns = driver->panel_width;
-    int min_page    = dirty->t / 8;
-    int max_page    = dirty->b / 8;
-    int min_column  = dirty->l;
-    int max_column  = dirty->r;
+    int min_page    = t / 8;
+    int max_page    = b / 8;
+    int min_column  = l;
+    int max_column  = r;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -158,18 +187,28 @@ void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dir
         qp_comms_command(device, vtable->opcodes.set_column_msb | (start_column & 0xF0) >> 4);
         qp_comms_send(device, column_data, cols_required);
     }
+
+    return true;
 }
 
-void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
-    painter_driver_t                   *driver = (painter_driver_t *)device;
-    oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
+void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    oled_panel_flush_data_t flush = {.device = device, .framebuffer = framebuffer};
+    qp_surface_for_each_dirty_rect(dirty, qp_oled_panel_page_column_flush_rect_rot180, &flush);
+}
+
+static bool qp_oled_panel_page_column_flush_rect_rot270(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    oled_panel_flush_data_t            *flush       = (oled_panel_flush_data_t *)cb_arg;
+    painter_device_t                    device      = flush->device;
+    const uint8_t                      *framebuffer = flush->framebuffer;
+    painter_driver_t                   *driver      = (painter_driver_t *)device;
+    oled_panel_painter_driver_vtable_t *vtable      = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
     int num_pages  = driver->panel_height / 8;
-    int min_page   = dirty->l / 8;
-    int max_page   = dirty->r / 8;
-    int min_column = dirty->t;
-    int max_column = dirty->b;
+    int min_page   = l / 8;
+    int max_page   = r / 8;
+    int min_column = t;
+    int max_column = b;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -192,4 +231,11 @@ void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dir
         qp_comms_command(device, vtable->opcodes.set_column_msb | (start_column & 0xF0) >> 4);
         qp_comms_send(device, column_data, cols_required);
     }
+
+    return true;
+}
+
+void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    oled_panel_flush_data_t flush = {.device = device, .framebuffer = framebuffer};
+    qp_surface_for_each_dirty_rect(dirty, qp_oled_panel_page_column_flush_rect_rot270, &flush);
 }
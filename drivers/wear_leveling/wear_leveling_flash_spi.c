@@ -42,6 +42,16 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    for (uint32_t offset = address; offset < address + length; offset += (EXTERNAL_FLASH_BLOCK_SIZE)) {
+        flash_status_t status = flash_erase_block((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + offset);
+        if (status != FLASH_STATUS_SUCCESS) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -105,6 +105,7 @@ subcommands = [
     'qmk.cli.new.keyboard',
     'qmk.cli.new.keymap',
     'qmk.cli.painter',
+    'qmk.cli.profile',
     'qmk.cli.pytest',
     'qmk.cli.resolve_alias',
     'qmk.cli.test.c',
@@ -165,6 +165,20 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
+def serialize_correction(typo: str, correction: str) -> List[int]:
+    """Serializes the backspaces and replacement text applied when `typo` is found."""
+
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    correction = correction[i:]
+    return [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
+
+
 def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
@@ -179,18 +193,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
             typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': serialize_correction(typo, correction), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -232,6 +235,96 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def make_automaton(autocorrections: List[Tuple[str, str]]) -> List[Dict[str, Any]]:
+    """Makes an Aho-Corasick automaton from the typos, read forwards.
+  The states are the prefixes of the typos, in breadth first order so that the
+  root is state 0. The failure link of a state is the longest proper suffix of
+  its prefix that is also a state, which is where matching continues when the
+  next character has no transition.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    List of states, each a dict of children, failure link and leaf.
+  """
+    states = [{'children': {}, 'failure': 0, 'leaf': None}]
+    for typo, correction in autocorrections:
+        state = 0
+        for letter in typo:
+            if letter not in states[state]['children']:
+                states[state]['children'][letter] = len(states)
+                states.append({'children': {}, 'failure': 0, 'leaf': None})
+            state = states[state]['children'][letter]
+        states[state]['leaf'] = (typo, correction)
+
+    # Number the states breadth first, filling in the failure links on the way.
+    order = [0]
+    for state in order:
+        for letter, child in sorted(states[state]['children'].items(), key=lambda item: TYPO_CHARS[item[0]]):
+            order.append(child)
+            if state:
+                failure = states[state]['failure']
+                while failure and letter not in states[failure]['children']:
+                    failure = states[failure]['failure']
+                failure = states[failure]['children'].get(letter, 0)
+                # Typos that are substrings of others were reported by parse_file(), never continue from one.
+                if states[failure]['leaf']:
+                    failure = states[failure]['failure']
+                states[child]['failure'] = failure
+
+    renumber = {old: new for new, old in enumerate(order)}
+    automaton = []
+    for old in order:
+        state = states[old]
+        automaton.append({
+            'children': {letter: renumber[child] for letter, child in state['children'].items()},
+            'failure': renumber[state['failure']],
+            'leaf': state['leaf'],
+        })
+    return automaton
+
+
+def serialize_automaton(automaton: List[Dict[str, Any]]) -> Tuple[List[int], int, int]:
+    """Serializes the automaton in a form readable by the C code.
+  A leaf state is its correction, as for the trie. Any other state is its
+  number of children, its failure link, then a keycode and link for each child
+  sorted by keycode. Links are byte offsets of two bytes, or three bytes when
+  the table does not fit in 64KB.
+  Args:
+    automaton: List of states, as returned by make_automaton().
+  Returns:
+    Tuple of the list of ints in the range 0-255, the size of links, and the
+    byte offset of the state after a word break.
+  """
+    def state_data(state: Dict[str, Any], offsets: List[int], link_size: int) -> List[int]:
+        if state['leaf']:
+            return serialize_correction(*state['leaf'])
+        data = [len(state['children'])] + encode_offset(offsets[state['failure']], link_size)
+        for letter, child in sorted(state['children'].items(), key=lambda item: TYPO_CHARS[item[0]]):
+            data += [TYPO_CHARS[letter]] + encode_offset(offsets[child], link_size)
+        return data
+
+    for link_size in (2, 3):
+        offsets = []
+        byte_offset = 0
+        for state in automaton:
+            offsets.append(byte_offset)
+            byte_offset += len(state_data(state, [0] * len(automaton), link_size))
+        if byte_offset < 1 << (8 * link_size):
+            break
+    else:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection automaton is too large, a state link exceeds the 16MB limit. Try reducing the autocorrection dict to fewer entries.')
+        maybe_exit(1)
+
+    data = [b for state in automaton for b in state_data(state, offsets, link_size)]
+    start = offsets[automaton[0]['children'].get(':', 0)]
+    return data, link_size, start
+
+
+def encode_offset(byte_offset: int, link_size: int) -> List[int]:
+    """Encodes a byte offset as `link_size` little endian bytes."""
+    return [(byte_offset >> (8 * i)) & 255 for i in range(link_size)]
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -254,11 +347,14 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a output file is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--automaton', arg_only=True, action='store_true', help="Generate an Aho-Corasick automaton, matched in constant time per keystroke, instead of a trie")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
-    trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.automaton:
+        data, link_size, start = serialize_automaton(make_automaton(autocorrections))
+    else:
+        data = serialize_trie(autocorrections, make_trie(autocorrections))
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +378,11 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.automaton:
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_AUTOMATON')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_LINK_SIZE {link_size}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_START_STATE {start}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
@@ -25,6 +25,80 @@ def _gen_led_configs(info_data):
     return lines
 
 
+def _sqrt16(x):
+    """Matches sqrt16() from lib8tion, including the truncation of x to 16 bits
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while hi >= low:
+        mid = (low + hi) >> 1
+        if (mid * mid) & 0xFFFF > x:
+            hi = mid - 1
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+
+    return low - 1
+
+
+def _atan2_8(dy, dx):
+    """Matches atan2_8() from lib8tion, where division truncates towards zero
+    """
+    def div(a, b):
+        q = abs(a) // abs(b)
+        return q if (a < 0) == (b < 0) else -q
+
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - div(32 * (dx + abs_y), abs_y - dx)
+
+    # a is an int8_t
+    a = (a + 128) % 256 - 128
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _gen_led_geometry(info_data, config_type):
+    """Precompute the distance and angle of each LED from the center, and the distance between each pair of LEDs
+    """
+    define = 'RGB_MATRIX' if config_type == 'rgb_matrix' else 'LED_MATRIX'
+    center_x, center_y = info_data[config_type].get('center_point', [112, 32])
+    points = [(led_data.get('x', 0), led_data.get('y', 0)) for led_data in info_data[config_type]['layout']]
+
+    lines = []
+    lines.append(f'#ifdef {define}_GEOMETRY_TABLE')
+    lines.append(f'__attribute__ ((weak)) const led_geometry_t g_led_geometry[{define}_LED_COUNT] PROGMEM = {{')
+    for x, y in points:
+        dx = x - center_x
+        dy = y - center_y
+        lines.append(f'  {{ {_sqrt16(dx * dx + dy * dy)}, {_atan2_8(dy, dx)} }},')
+    lines.append('};')
+
+    lines.append(f'#ifdef {define}_KEYREACTIVE_ENABLED')
+    lines.append(f'__attribute__ ((weak)) const uint8_t g_led_distance[{define}_LED_COUNT][{define}_LED_COUNT] PROGMEM = {{')
+    for hit_x, hit_y in points:
+        row = []
+        for x, y in points:
+            dx = x - hit_x
+            dy = y - hit_y
+            row.append(str(_sqrt16(dx * dx + dy * dy)))
+        lines.append(f'  {{ {", ".join(row)} }},')
+    lines.append('};')
+    lines.append('#endif')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_led_config(info_data, config_type):
     """Convert info.json content to g_led_config
     """
@@ -60,6 +134,7 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    lines.extend(_gen_led_geometry(info_data, config_type))
     lines.append('#endif')
     lines.append('')
 
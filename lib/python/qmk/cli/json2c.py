@@ -10,6 +10,7 @@ from qmk.commands import dump_lines, parse_configurator_json
 
 @cli.argument('-o', '--output', arg_only=True, type=qmk.path.normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--compress', arg_only=True, action='store_true', help="Store the keymap in a compressed form, for KEYMAP_COMPRESSION_ENABLE")
 @cli.argument('filename', type=qmk.path.FileType('r'), arg_only=True, completer=FilesCompleter('.json'), help='Configurator JSON file')
 @cli.subcommand('Creates a keymap.c from a QMK Configurator export.')
 def json2c(cli):
@@ -22,7 +23,11 @@ def json2c(cli):
     user_keymap = parse_configurator_json(cli.args.filename)
 
     # Generate the keymap
-    keymap_c = qmk.keymap.generate_c(user_keymap)
+    try:
+        keymap_c = qmk.keymap.generate_c(user_keymap, compress=cli.args.compress)
+    except ValueError as e:
+        cli.log.error('Unable to compress keymap: %s', e)
+        return False
 
     # Show the results
     dump_lines(cli.args.output, keymap_c.split('\n'), cli.args.quiet)
@@ -0,0 +1,52 @@
+"""Decode the dumps of the firmware's hot path profiler.
+"""
+import sys
+
+from argcomplete.completers import FilesCompleter
+from milc import cli
+
+import qmk.path
+from qmk.commands import dump_lines
+from qmk.profiler import ProfilerDumpError, extract_dumps, parse_dump, format_summary, format_folded
+
+
+@cli.argument('-o', '--output', arg_only=True, type=qmk.path.normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help='Quiet mode, only output error messages')
+@cli.argument('--folded', arg_only=True, action='store_true', help='Output the sample ring as folded stacks for flamegraph tools')
+@cli.argument('-a', '--all', arg_only=True, action='store_true', help='Decode every dump found instead of only the last one')
+@cli.argument('filename', nargs='?', arg_only=True, completer=FilesCompleter(), help='Binary dump, raw HID capture or console log to read, defaults to stdin')
+@cli.subcommand('Decodes a profiler dump.', hidden=False if cli.config.user.developer else True)
+def profile(cli):
+    """Decode a profiler dump.
+
+    Reads the output of `profiler_dump_console()` from a console log, the reports of `profiler_dump_raw_hid()`, or a binary dump, and prints the statistics of each zone along with a flame style summary of the most recent samples.
+    """
+    if cli.args.filename and cli.args.filename != '-':
+        path = qmk.path.normpath(cli.args.filename)
+        if not path.exists():
+            cli.log.error('File not found: %s', path)
+            return False
+        data = path.read_bytes()
+    else:
+        data = sys.stdin.buffer.read()
+
+    dumps = extract_dumps(data)
+    if not dumps:
+        cli.log.error('No profiler dump found.')
+        return False
+    if not cli.args.all:
+        dumps = dumps[-1:]
+
+    lines = []
+    for dump in dumps:
+        try:
+            decoded = parse_dump(dump)
+        except ProfilerDumpError as e:
+            cli.log.error('Invalid profiler dump: %s', e)
+            return False
+
+        if lines:
+            lines.append('')
+        lines.extend(format_folded(decoded) if cli.args.folded else format_summary(decoded))
+
+    dump_lines(cli.args.output, lines, cli.args.quiet)
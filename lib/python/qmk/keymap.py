@@ -2,6 +2,7 @@
 """
 import json
 import sys
+from collections import Counter
 from pathlib import Path
 from subprocess import DEVNULL
 
@@ -53,6 +54,83 @@ def _generate_keymap_table(keymap_json):
     return lines
 
 
+def _compress_layer(matrix):
+    """Returns the sparse encoding of a layer, as (fill, masks, keycodes).
+
+    `matrix` holds the keycode of each matrix position, by row. Every position that does not hold `fill`, the layer's
+    most common keycode, is flagged in its row's mask and has its keycode listed in matrix order.
+    """
+    fill = Counter(keycode for row in matrix for keycode in row).most_common(1)[0][0]
+    masks = []
+    keycodes = []
+    for row in matrix:
+        mask = 0
+        for col, keycode in enumerate(row):
+            if keycode != fill:
+                mask |= 1 << col
+                keycodes.append(keycode)
+        masks.append(mask)
+
+    return fill, masks, keycodes
+
+
+def _generate_compressed_keymap_table(keymap_json):
+    """Generates the sparse encoding of the keymap decoded by `keymap_introspection.c`, instead of `keymaps[][][]`.
+
+    Falls back to the plain table when the keyboard does not describe where each key of the layout sits in the matrix.
+    """
+    kb_info_json = info_json(keymap_json['keyboard'])
+    layout_name = kb_info_json.get('layout_aliases', {}).get(keymap_json['layout'], keymap_json['layout'])
+    layout = kb_info_json.get('layouts', {}).get(layout_name, {}).get('layout', [])
+    rows = kb_info_json.get('matrix_size', {}).get('rows', 0)
+    cols = kb_info_json.get('matrix_size', {}).get('cols', 0)
+    if not rows or not cols or not all('matrix' in key for key in layout):
+        cli.log.warning('Unable to compress keymap: no matrix positions for %s, storing it uncompressed.', keymap_json['layout'])
+        return _generate_keymap_table(keymap_json)
+
+    fills = []
+    masks = []
+    offsets = []
+    keycodes = []
+    for layer_num, layer in enumerate(keymap_json['layers']):
+        # LAYOUT() refuses a layer of the wrong size, do not let zip() silently drop or leave out keys
+        if len(layer) != len(layout):
+            raise ValueError(f'Layer {layer_num} has {len(layer)} keys, but {keymap_json["layout"]} has {len(layout)}.')
+
+        matrix = [['KC_NO'] * cols for _ in range(rows)]
+        for key, keycode in zip(layout, layer):
+            row, col = key['matrix']
+            matrix[row][col] = _strip_any(keycode)
+
+        fill, layer_masks, layer_keycodes = _compress_layer(matrix)
+        layer_offsets = []
+        offset = len(keycodes)
+        for mask in layer_masks:
+            layer_offsets.append(offset)
+            offset += bin(mask).count('1')
+        keycodes.extend(layer_keycodes)
+
+        fills.append(fill)
+        masks.append(layer_masks)
+        offsets.append(layer_offsets)
+
+    lines = [
+        '#define KEYMAP_COMPRESSED',
+        'const uint16_t PROGMEM keymap_compressed_fill[] = {%s};' % ', '.join(fills),
+        'const matrix_row_t PROGMEM keymap_compressed_masks[][MATRIX_ROWS] = {',
+    ]
+    for layer_num, layer_masks in enumerate(masks):
+        lines.append('    [%s] = {%s},' % (layer_num, ', '.join('0x%X' % mask for mask in layer_masks)))
+    lines.extend(['};', 'const uint16_t PROGMEM keymap_compressed_offsets[][MATRIX_ROWS] = {'])
+    for layer_num, layer_offsets in enumerate(offsets):
+        lines.append('    [%s] = {%s},' % (layer_num, ', '.join(str(offset) for offset in layer_offsets)))
+    lines.extend(['};', 'const uint16_t PROGMEM keymap_compressed_keycodes[] = {'])
+    # Keep at least one entry, so that the array exists when every layer is a single keycode
+    lines.append('    %s' % ', '.join(keycodes or ['KC_NO']))
+    lines.append('};')
+    return lines
+
+
 def _generate_encodermap_table(keymap_json):
     lines = [
         '#if defined(ENCODER_ENABLE) && defined(ENCODER_MAP_ENABLE)',
@@ -269,7 +347,7 @@ def generate_json(keymap, keyboard, layout, layers, macros=None):
     return new_keymap
 
 
-def generate_c(keymap_json):
+def generate_c(keymap_json, compress=False):
     """Returns a `keymap.c`.
 
     `keymap_json` is a dictionary with the following keys:
@@ -285,12 +363,17 @@ def generate_c(keymap_json):
 
         macros
             A sequence of strings containing macros to implement for this keyboard.
+
+    With `compress`, the layers are stored in a sparse encoding instead of a full table, see `KEYMAP_COMPRESSION_ENABLE`.
     """
     new_keymap = DEFAULT_KEYMAP_C
 
     keymap = ''
     if 'layers' in keymap_json and keymap_json['layers'] is not None:
-        layer_txt = _generate_keymap_table(keymap_json)
+        if compress:
+            layer_txt = _generate_compressed_keymap_table(keymap_json)
+        else:
+            layer_txt = _generate_keymap_table(keymap_json)
         keymap = '\n'.join(layer_txt)
     new_keymap = new_keymap.replace('__KEYMAP_GOES_HERE__', keymap)
 
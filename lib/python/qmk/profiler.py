@@ -0,0 +1,233 @@
+"""Functions that decode the dumps of the firmware's hot path profiler.
+
+See quantum/profiler.h for the layout of a dump.
+"""
+import re
+import struct
+
+DUMP_MAGIC = b'QP'
+DUMP_VERSION = 1
+RAW_HID_ID = 0xFB
+RAW_HID_REPORT_SIZE = 32
+RAW_HID_HEADER_SIZE = 3
+
+console_line_re = re.compile(r'profiler: ([0-9A-Fa-f]+|begin|end)\s*$')
+
+
+class ProfilerDumpError(Exception):
+    """Raised when a dump can not be decoded.
+    """
+
+
+class _Reader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.offset + size > len(self.data):
+            raise ProfilerDumpError(f'Dump truncated at byte {self.offset}')
+        values = struct.unpack_from(fmt, self.data, self.offset)
+        self.offset += size
+        return values
+
+    def read_bytes(self, length):
+        if self.offset + length > len(self.data):
+            raise ProfilerDumpError(f'Dump truncated at byte {self.offset}')
+        value = self.data[self.offset:self.offset + length]
+        self.offset += length
+        return value
+
+
+def parse_dump(data):
+    """Decodes a binary dump into a dictionary of the header, zones and samples.
+    """
+    reader = _Reader(bytes(data))
+    magic = reader.read_bytes(2)
+    if magic != DUMP_MAGIC:
+        raise ProfilerDumpError('Not a profiler dump')
+
+    version, zone_count, bucket_count, sample_count, frequency, elapsed_ms = reader.read('<BBBBII')
+    if version != DUMP_VERSION:
+        raise ProfilerDumpError(f'Unsupported dump version {version}')
+
+    zones = []
+    for _ in range(zone_count):
+        name_length, = reader.read('<B')
+        name = reader.read_bytes(name_length).decode('utf-8', errors='replace')
+        count, total_low, total_high, minimum, maximum = reader.read('<IIIII')
+        histogram = list(reader.read(f'<{bucket_count}H'))
+        zones.append({
+            'name': name,
+            'count': count,
+            'total': total_low | total_high << 32,
+            'min': minimum,
+            'max': maximum,
+            'histogram': histogram,
+        })
+
+    samples = []
+    for _ in range(sample_count):
+        zone, depth, duration = reader.read('<BBI')
+        samples.append({'zone': zone, 'depth': depth, 'duration': duration})
+
+    return {
+        'frequency': frequency,
+        'elapsed_ms': elapsed_ms,
+        'zones': zones,
+        'samples': samples,
+    }
+
+
+def extract_console_dumps(lines):
+    """Collects the binary dumps printed by profiler_dump_console() from console output.
+    """
+    dumps = []
+    current = None
+    for line in lines:
+        match = console_line_re.search(line)
+        if not match:
+            continue
+        token = match.group(1)
+        if token == 'begin':
+            current = bytearray()
+        elif token == 'end':
+            if current is not None:
+                dumps.append(bytes(current))
+            current = None
+        elif current is not None:
+            current += bytes.fromhex(token)
+    return dumps
+
+
+def extract_raw_hid_dumps(data):
+    """Collects the binary dumps sent by profiler_dump_raw_hid() from a capture of 32 byte reports.
+    """
+    dumps = []
+    current = bytearray()
+    for offset in range(0, len(data) - RAW_HID_REPORT_SIZE + 1, RAW_HID_REPORT_SIZE):
+        report = data[offset:offset + RAW_HID_REPORT_SIZE]
+        if report[0] != RAW_HID_ID:
+            continue
+        if report[1] == 0:
+            current = bytearray()
+        length = min(report[2], RAW_HID_REPORT_SIZE - RAW_HID_HEADER_SIZE)
+        current += report[RAW_HID_HEADER_SIZE:RAW_HID_HEADER_SIZE + length]
+        if length < RAW_HID_REPORT_SIZE - RAW_HID_HEADER_SIZE:
+            dumps.append(bytes(current))
+            current = bytearray()
+    return dumps
+
+
+def extract_dumps(data):
+    """Finds the dumps in a binary dump, a raw HID capture or console output.
+    """
+    if data.startswith(DUMP_MAGIC):
+        return [data]
+    if len(data) >= RAW_HID_REPORT_SIZE and data[0] == RAW_HID_ID:
+        return extract_raw_hid_dumps(data)
+    return extract_console_dumps(data.decode('utf-8', errors='replace').splitlines())
+
+
+def percentile(zone, fraction):
+    """Estimates a percentile of a zone's durations from its histogram.
+
+    Bucket n holds durations of n bits, in [2**(n-1), 2**n), which are assumed to be evenly spread.
+    """
+    if zone['count'] == 0:
+        return 0
+
+    histogram = zone['histogram']
+    rank = fraction * sum(histogram)
+    seen = 0
+    for bucket, count in enumerate(histogram):
+        if count and seen + count >= rank:
+            low = 0 if bucket == 0 else 1 << (bucket - 1)
+            # The last bucket also holds everything longer
+            high = zone['max'] if bucket == len(histogram) - 1 else (1 << bucket)
+            estimate = low + (high - low) * (rank - seen) / count
+            return min(max(estimate, zone['min']), zone['max'])
+        seen += count
+    return zone['max']
+
+
+def build_call_tree(dump):
+    """Rebuilds the nesting of the samples in the ring.
+
+    Samples are recorded as zones end, so a sample is the parent of the preceding samples one level deeper that are not claimed yet. Samples whose parent fell out of the ring become roots.
+
+    Returns a list of root nodes, each node is a dictionary of name, duration and children.
+    """
+    zones = dump['zones']
+    pending = {}
+    for sample in dump['samples']:
+        depth = sample['depth']
+        name = zones[sample['zone']]['name'] if sample['zone'] < len(zones) else f'zone {sample["zone"]}'
+        node = {'name': name, 'duration': sample['duration'], 'children': pending.pop(depth + 1, [])}
+        pending.setdefault(depth, []).append(node)
+
+    roots = []
+    for depth in sorted(pending):
+        roots.extend(pending[depth])
+    return roots
+
+
+def fold_call_tree(roots):
+    """Sums the self time of every call path, as "parent;child" strings.
+    """
+    folded = {}
+
+    def visit(node, path):
+        path = f'{path};{node["name"]}' if path else node['name']
+        children = sum(child['duration'] for child in node['children'])
+        folded[path] = folded.get(path, 0) + max(node['duration'] - children, 0)
+        for child in node['children']:
+            visit(child, path)
+
+    for root in roots:
+        visit(root, '')
+    return folded
+
+
+def ticks_to_us(dump, ticks):
+    """Converts timestamp ticks to microseconds.
+    """
+    return ticks * 1000000 / dump['frequency'] if dump['frequency'] else ticks
+
+
+def format_summary(dump):
+    """Renders the statistics of every zone, and a flame style summary of the ring, as lines of text.
+    """
+    lines = []
+    elapsed_us = dump['elapsed_ms'] * 1000
+    lines.append(f'{len(dump["zones"])} zones over {dump["elapsed_ms"]} ms, {dump["frequency"]} Hz timestamps')
+    lines.append('')
+    lines.append(f'{"zone":<24} {"calls":>8} {"avg us":>9} {"min us":>9} {"p50 us":>9} {"p90 us":>9} {"p99 us":>9} {"max us":>9} {"time":>7}')
+
+    zones = sorted(dump['zones'], key=lambda zone: zone['total'], reverse=True)
+    for zone in zones:
+        total_us = ticks_to_us(dump, zone['total'])
+        average = zone['total'] / zone['count'] if zone['count'] else 0
+        share = f'{100 * total_us / elapsed_us:6.1f}%' if elapsed_us else '      -'
+        values = [average, zone['min'], percentile(zone, 0.5), percentile(zone, 0.9), percentile(zone, 0.99), zone['max']]
+        columns = ' '.join(f'{ticks_to_us(dump, value):9.1f}' for value in values)
+        lines.append(f'{zone["name"]:<24} {zone["count"]:>8} {columns} {share}')
+
+    folded = fold_call_tree(build_call_tree(dump))
+    if folded:
+        total = sum(folded.values()) or 1
+        lines.append('')
+        lines.append(f'Self time of the last {len(dump["samples"])} samples:')
+        for path, ticks in sorted(folded.items(), key=lambda item: item[1], reverse=True):
+            bar = '#' * round(40 * ticks / total)
+            lines.append(f'{100 * ticks / total:6.1f}% {ticks_to_us(dump, ticks):10.1f} us  {bar:<40} {path}')
+
+    return lines
+
+
+def format_folded(dump):
+    """Renders the ring as folded stacks, the input format of flamegraph tools.
+    """
+    folded = fold_call_tree(build_call_tree(dump))
+    return [f'{path} {round(ticks_to_us(dump, ticks))}' for path, ticks in sorted(folded.items())]
@@ -1,4 +1,6 @@
 import platform
+import re
+from pathlib import Path
 from subprocess import DEVNULL
 
 from milc import cli
@@ -313,6 +315,25 @@ def test_generate_rules_mk():
     assert 'MCU ?= atmega32u4' in result.stdout
 
 
+def c_table_rows(text, name):
+    """Returns the rows of the C array `name` in `text`, as lists of numbers.
+    """
+    start = text.index(name)
+    body = text[text.index('{', text.index('=', start)) + 1:text.index('};', start)]
+    return [[int(number) for number in re.findall(r'\d+', row)] for row in re.findall(r'\{([^{}]*)\}', body)]
+
+
+def test_generate_keyboard_c_led_geometry():
+    """The LED geometry tables in the rgb_matrix unit tests have to match what is generated for the same LEDs.
+    """
+    result = check_subcommand('generate-keyboard-c', '-kb', 'handwired/pytest/led_geometry')
+    check_returncode(result)
+    expected = Path('tests/rgb_matrix/led_geometry/test_led_config.c').read_text()
+    assert len(c_table_rows(result.stdout, 'g_led_geometry')) == 40
+    assert c_table_rows(result.stdout, 'g_led_geometry') == c_table_rows(expected, 'g_led_geometry')
+    assert c_table_rows(result.stdout, 'g_led_distance') == c_table_rows(expected, 'g_led_distance')
+
+
 def test_generate_version_h():
     result = check_subcommand('generate-version-h')
     check_returncode(result)
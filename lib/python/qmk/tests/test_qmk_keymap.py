@@ -1,3 +1,7 @@
+import re
+from pathlib import Path
+from unittest.mock import patch
+
 import qmk.keymap
 
 
@@ -44,4 +48,123 @@ def test_parse_keymap_c():
     assert parsed_keymap_c == {'layers': [{'name': '0', 'layout': 'LAYOUT_ortho_1x1', 'keycodes': ['KC_A']}]}
 
 
+def test_compress_layer():
+    matrix = [
+        ['KC_TRNS', 'KC_A', 'KC_TRNS'],
+        ['KC_B', 'KC_TRNS', 'KC_C'],
+    ]
+    assert qmk.keymap._compress_layer(matrix) == ('KC_TRNS', [0b010, 0b101], ['KC_A', 'KC_B', 'KC_C'])
+
+
+def compression_info_json(layout, rows, cols):
+    """Returns a stand in for `info_json()`, describing a keyboard with a single `LAYOUT`.
+    """
+    def info_json(keyboard):
+        return {
+            'layout_aliases': {'LAYOUT_alias': 'LAYOUT'},
+            'layouts': {'LAYOUT': {'layout': layout}},
+            'matrix_size': {'rows': rows, 'cols': cols},
+        }
+
+    return info_json
+
+
+def test_generate_compressed_keymap_table_offsets():
+    layout = [{'matrix': [row, col]} for row in range(2) for col in range(3)]
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT',
+        'layers': [
+            ['KC_A', 'KC_B', 'KC_C', 'KC_D', 'KC_SPC', 'KC_SPC'],
+            ['KC_TRNS', 'KC_1', 'KC_TRNS', 'KC_TRNS', 'KC_TRNS', 'KC_2'],
+            ['KC_NO'] * 6,
+        ],
+    }
+    with patch.object(qmk.keymap, 'info_json', compression_info_json(layout, 2, 3)):
+        lines = qmk.keymap._generate_compressed_keymap_table(keymap_json)
+    assert lines == [
+        '#define KEYMAP_COMPRESSED',
+        'const uint16_t PROGMEM keymap_compressed_fill[] = {KC_SPC, KC_TRNS, KC_NO};',
+        'const matrix_row_t PROGMEM keymap_compressed_masks[][MATRIX_ROWS] = {',
+        '    [0] = {0x7, 0x1},',
+        '    [1] = {0x2, 0x4},',
+        '    [2] = {0x0, 0x0},',
+        '};',
+        'const uint16_t PROGMEM keymap_compressed_offsets[][MATRIX_ROWS] = {',
+        '    [0] = {0, 3},',
+        '    [1] = {4, 5},',
+        '    [2] = {6, 6},',
+        '};',
+        'const uint16_t PROGMEM keymap_compressed_keycodes[] = {',
+        '    KC_A, KC_B, KC_C, KC_D, KC_1, KC_2',
+        '};',
+    ]
+
+
+def test_generate_compressed_keymap_table_layout_to_matrix():
+    # The layout lists the keys in a different order from the matrix, and leaves some positions unused
+    layout = [{'matrix': [1, 2]}, {'matrix': [0, 0]}, {'matrix': [1, 0]}]
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT_alias',
+        'layers': [['KC_C', 'KC_A', 'KC_B']],
+    }
+    with patch.object(qmk.keymap, 'info_json', compression_info_json(layout, 2, 3)):
+        lines = qmk.keymap._generate_compressed_keymap_table(keymap_json)
+    assert 'const uint16_t PROGMEM keymap_compressed_fill[] = {KC_NO};' in lines
+    assert '    [0] = {0x1, 0x5},' in lines
+    assert '    [0] = {0, 1},' in lines
+    assert '    KC_A, KC_B, KC_C' in lines
+
+
+def test_generate_compressed_keymap_table_fallback():
+    layout = [{'x': 0, 'y': 0}, {'matrix': [0, 1]}]
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT',
+        'layers': [['KC_A', 'KC_B']],
+    }
+    with patch.object(qmk.keymap, 'info_json', compression_info_json(layout, 1, 2)):
+        lines = qmk.keymap._generate_compressed_keymap_table(keymap_json)
+    assert lines == qmk.keymap._generate_keymap_table(keymap_json)
+
+
+def test_generate_compressed_keymap_table_layer_size_mismatch():
+    layout = [{'matrix': [0, 0]}, {'matrix': [0, 1]}]
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT',
+        'layers': [['KC_A', 'KC_B'], ['KC_C']],
+    }
+    with patch.object(qmk.keymap, 'info_json', compression_info_json(layout, 1, 2)):
+        try:
+            qmk.keymap._generate_compressed_keymap_table(keymap_json)
+        except ValueError as e:
+            assert str(e) == 'Layer 1 has 1 keys, but LAYOUT has 2.'
+            return
+    assert False
+
+
+def test_generate_compressed_keymap_table_unit_test_fixture():
+    """The tables in `tests/keymap_compression/keymap.c` have to be what `qmk json2c --compress` generates for the reference layers next to them.
+    """
+    keymap_c = Path('tests/keymap_compression/keymap.c').read_text()
+    generated = keymap_c[keymap_c.index('#define KEYMAP_COMPRESSED'):keymap_c.index('// Same layers as a plain table')].strip()
+    reference = keymap_c[keymap_c.index('keymap_compression_reference'):]
+
+    layers = []
+    for layer in re.findall(r'\[\d+\] = \{\n(.*?)\n    \},', reference, re.DOTALL):
+        layers.append(re.findall(r'[A-Z_]+\w*(?:\(\d+\))?', layer))
+
+    layout = [{'matrix': [row, col]} for row in range(4) for col in range(10)]
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT',
+        'layers': layers,
+    }
+    with patch.object(qmk.keymap, 'info_json', compression_info_json(layout, 4, 10)):
+        lines = qmk.keymap._generate_compressed_keymap_table(keymap_json)
+    assert '\n'.join(lines) == generated
+
+
 # FIXME(skullydazed): Add a test for qmk.keymap.write that mocks up an FD.
@@ -0,0 +1,60 @@
+import struct
+
+import qmk.profiler
+
+BUCKETS = 5
+
+
+def make_zone(name, count, total, minimum, maximum, histogram):
+    return bytes([len(name)]) + name.encode() + struct.pack('<IIIII', count, total & 0xFFFFFFFF, total >> 32, minimum, maximum) + struct.pack(f'<{BUCKETS}H', *histogram)
+
+
+def make_dump():
+    zones = make_zone('outer', 1, 15, 15, 15, [0, 0, 0, 0, 1]) + make_zone('inner', 2, 14, 4, 10, [0, 0, 0, 1, 1])
+    samples = struct.pack('<BBI', 1, 1, 4) + struct.pack('<BBI', 1, 1, 10) + struct.pack('<BBI', 0, 0, 15)
+    return b'QP' + struct.pack('<BBBBII', 1, 2, BUCKETS, 3, 1000000, 100) + zones + samples
+
+
+def test_parse_dump():
+    dump = qmk.profiler.parse_dump(make_dump())
+    assert dump['frequency'] == 1000000
+    assert dump['elapsed_ms'] == 100
+    assert [zone['name'] for zone in dump['zones']] == ['outer', 'inner']
+    assert dump['zones'][1]['total'] == 14
+    assert dump['zones'][1]['histogram'] == [0, 0, 0, 1, 1]
+    assert dump['samples'][2] == {'zone': 0, 'depth': 0, 'duration': 15}
+
+
+def test_parse_truncated_dump():
+    try:
+        qmk.profiler.parse_dump(make_dump()[:-1])
+    except qmk.profiler.ProfilerDumpError:
+        return
+    assert False
+
+
+def test_percentile_stays_within_range():
+    dump = qmk.profiler.parse_dump(make_dump())
+    inner = dump['zones'][1]
+    assert 4 <= qmk.profiler.percentile(inner, 0.5) <= 8
+    assert 8 <= qmk.profiler.percentile(inner, 0.99) <= 10
+    assert qmk.profiler.percentile(inner, 1) == 10
+
+
+def test_call_tree():
+    dump = qmk.profiler.parse_dump(make_dump())
+    assert qmk.profiler.fold_call_tree(qmk.profiler.build_call_tree(dump)) == {'outer': 1, 'outer;inner': 14}
+
+
+def test_console_and_raw_hid_dumps():
+    data = make_dump()
+    console = ['noise', 'profiler: begin'] + [f'profiler: {data[i:i + 16].hex().upper()}' for i in range(0, len(data), 16)] + ['profiler: end']
+    assert qmk.profiler.extract_console_dumps(console) == [data]
+
+    reports = b''
+    chunks = [data[i:i + 29] for i in range(0, len(data), 29)]
+    if len(chunks[-1]) == 29:
+        chunks.append(b'')
+    for index, chunk in enumerate(chunks):
+        reports += bytes([0xFB, index, len(chunk)]) + chunk.ljust(29, b'\0')
+    assert qmk.profiler.extract_dumps(reports) == [data]
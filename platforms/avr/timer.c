@@ -125,6 +125,33 @@ inline uint32_t timer_read32(void) {
     return t;
 }
 
+/** \brief timer read in microseconds
+ *
+ * Combines the millisecond count with the current Timer0 value.
+ */
+uint32_t timer_read_us(void) {
+    uint32_t ms;
+    uint8_t  raw;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ms  = timer_count;
+        raw = TIMER_RAW;
+        // The compare match may have happened after interrupts were disabled
+#if defined(__AVR_ATmega32A__)
+        if (TIFR & _BV(OCF0)) {
+#elif defined(__AVR_ATtiny85__)
+        if (TIFR & _BV(OCF0A)) {
+#else
+        if (TIFR0 & _BV(OCF0A)) {
+#endif
+            ms++;
+            raw = TIMER_RAW;
+        }
+    }
+
+    return ms * 1000 + (uint32_t)raw * 1000 / (TIMER_RAW_TOP + 1);
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
@@ -101,6 +101,18 @@ bool backing_store_init(void) {
 
 #endif // defined(WEAR_LEVELING_EFL_FIRST_SECTOR)
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Banks are erased BACKING_STORE_ERASE_SIZE at a time, which only works if no sector crosses those boundaries
+    for (flash_sector_t i = 0; i < sector_count; ++i) {
+        flash_offset_t offset = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        flash_offset_t last   = offset + flashGetSectorSize(flash, first_sector + i) - 1;
+        if (offset / (BACKING_STORE_ERASE_SIZE) != last / (BACKING_STORE_ERASE_SIZE)) {
+            bs_dprintf("Sector %d does not fit within BACKING_STORE_ERASE_SIZE boundaries\n", (int)(first_sector + i));
+            return false;
+        }
+    }
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
     return true;
 }
 
@@ -109,28 +121,55 @@ bool backing_store_unlock(void) {
     return eflStart(&EFLD1, NULL) == HAL_RET_SUCCESS;
 }
 
+static bool backing_store_erase_sector(flash_sector_t sector) {
+    bool          ret = true;
+    flash_error_t status;
+
+    // Kick off the sector erase
+    status = flashStartEraseSector(flash, sector);
+    if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+        ret = false;
+    }
+
+    // Wait for the erase to complete
+    status = flashWaitErase(flash);
+    if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+        ret = false;
+    }
+    return ret;
+}
+
 bool backing_store_erase(void) {
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
     uint32_t start = timer_read32();
 #endif
 
-    bool          ret = true;
-    flash_error_t status;
+    bool ret = true;
     for (int i = 0; i < sector_count; ++i) {
-        // Kick off the sector erase
-        status = flashStartEraseSector(flash, first_sector + i);
-        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
-            ret = false;
-        }
+        ret &= backing_store_erase_sector(first_sector + i);
+    }
+
+    bs_dprintf("Backing store erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
 
-        // Wait for the erase to complete
-        status = flashWaitErase(flash);
-        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
-            ret = false;
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Only whole sectors can be erased, refuse a range which would take part of one with it
+    for (int i = 0; i < sector_count; ++i) {
+        flash_offset_t offset = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        flash_offset_t end    = offset + flashGetSectorSize(flash, first_sector + i);
+        if (end > address && offset < address + length && (offset < address || end > address + length)) {
+            return false;
         }
     }
 
-    bs_dprintf("Backing store erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    bool ret = true;
+    for (int i = 0; i < sector_count; ++i) {
+        flash_offset_t offset = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        if (offset >= address && offset < address + length) {
+            ret &= backing_store_erase_sector(first_sector + i);
+        }
+    }
     return ret;
 }
 
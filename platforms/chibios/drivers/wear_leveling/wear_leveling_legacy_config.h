@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+#    error "The legacy wear-leveling driver cannot erase part of its backing store, incremental consolidation is not supported"
+#endif
+
 // Work out the page size to use
 #ifndef WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE
 #    if defined(QMK_MCU_STM32F042)
@@ -118,3 +118,12 @@ uint32_t timer_read32(void) {
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
+
+// The resolution is that of the system tick, i.e. CH_CFG_ST_FREQUENCY.
+uint32_t timer_read_us(void) {
+    syssts_t sts   = chSysGetStatusAndLockX();
+    uint32_t ticks = get_system_time_ticks();
+    chSysRestoreStatusX(sts);
+
+    return (uint32_t)TIME_I2US(ticks);
+}
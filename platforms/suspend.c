@@ -3,6 +3,9 @@
 
 #include "suspend.h"
 #include "matrix.h"
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+#    include "matrix_event_queue.h"
+#endif
 
 extern matrix_row_t matrix_previous[MATRIX_ROWS];
 static matrix_row_t wakeup_matrix[MATRIX_ROWS];
@@ -67,6 +70,11 @@ void update_matrix_state_after_wakeup(void) {
         wakeup_matrix[row] |= current_row & ~matrix_previous[row];
         matrix_previous[row] |= current_row;
     }
+
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    // Keys changed while suspended have been folded into matrix_previous
+    matrix_event_queue_invalidate();
+#endif
 }
 
 bool keypress_is_wakeup_key(uint8_t row, uint8_t col) {
@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "eeprom_sim.h"
+#include "eeprom.h"
+#include "i2c_master.h"
+#include "timer.h"
+
+// Provided by the test platform timer
+void advance_time_us(uint32_t us);
+
+#define EEPROM_SIM_I2C_BITS 9 // 8 data + ack
+
+static eeprom_sim_device_t device = {.bus_hz = 400000, .write_cycle_us = EXTERNAL_EEPROM_WRITE_TIME * 1000};
+static eeprom_sim_stats_t  stats;
+static uint8_t             memory[EXTERNAL_EEPROM_BYTE_COUNT];
+static uint32_t            pointer;
+static uint32_t            busy_until_us;
+
+void eeprom_sim_configure(const eeprom_sim_device_t *config) {
+    device = *config;
+}
+
+void eeprom_sim_reset(void) {
+    memset(memory, 0xFF, sizeof(memory));
+    pointer       = 0;
+    busy_until_us = timer_read_us();
+    eeprom_sim_reset_stats();
+}
+
+uint8_t *eeprom_sim_memory(void) {
+    return memory;
+}
+
+const eeprom_sim_stats_t *eeprom_sim_get_stats(void) {
+    return &stats;
+}
+
+void eeprom_sim_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+// Accounts for bytes on the wire, start and stop conditions included
+static void eeprom_sim_wire(uint16_t bytes) {
+    uint32_t us = (uint32_t)(((uint64_t)bytes * EEPROM_SIM_I2C_BITS + 2) * 1000000 + device.bus_hz - 1) / device.bus_hz;
+    stats.bytes += bytes;
+    stats.bus_us += us;
+    advance_time_us(us);
+}
+
+// Addresses the EEPROM, which only acknowledges when it is present and not in the middle of a write cycle
+static bool eeprom_sim_address(uint8_t address) {
+    stats.transactions++;
+    if (address != EXTERNAL_EEPROM_I2C_BASE_ADDRESS) {
+        eeprom_sim_wire(1);
+        return false;
+    }
+    if ((int32_t)(timer_read_us() - busy_until_us) < 0) {
+        stats.refused++;
+        eeprom_sim_wire(1);
+        return false;
+    }
+    return true;
+}
+
+static void eeprom_sim_write(const uint8_t *data, uint16_t length) {
+    pointer = 0;
+    for (uint16_t i = 0; i < length && i < EXTERNAL_EEPROM_ADDRESS_SIZE; i++) {
+        pointer = (pointer << 8) | data[i];
+    }
+    pointer %= EXTERNAL_EEPROM_BYTE_COUNT;
+    if (length <= EXTERNAL_EEPROM_ADDRESS_SIZE) {
+        return;
+    }
+
+    // Data goes into the page buffer, where the address wraps around within the page
+    uint32_t page   = pointer - pointer % EXTERNAL_EEPROM_PAGE_SIZE;
+    uint32_t offset = pointer % EXTERNAL_EEPROM_PAGE_SIZE;
+    if (offset + length - EXTERNAL_EEPROM_ADDRESS_SIZE > EXTERNAL_EEPROM_PAGE_SIZE) {
+        stats.page_wraps++;
+    }
+    for (uint16_t i = EXTERNAL_EEPROM_ADDRESS_SIZE; i < length; i++) {
+        memory[page + offset] = data[i];
+        offset                = (offset + 1) % EXTERNAL_EEPROM_PAGE_SIZE;
+    }
+    pointer = page + offset;
+
+    stats.page_writes++;
+    busy_until_us = timer_read_us() + device.write_cycle_us;
+}
+
+static void eeprom_sim_read(uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = memory[pointer];
+        pointer = (pointer + 1) % EXTERNAL_EEPROM_BYTE_COUNT;
+    }
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (!eeprom_sim_address(address)) {
+        return I2C_STATUS_ERROR;
+    }
+    eeprom_sim_wire(1 + length);
+    eeprom_sim_write(data, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (!eeprom_sim_address(address)) {
+        return I2C_STATUS_ERROR;
+    }
+    eeprom_sim_wire(1 + length);
+    eeprom_sim_read(data, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_transmit_and_receive(uint8_t address, const uint8_t *tx_data, uint16_t tx_length, uint8_t *rx_data, uint16_t rx_length, uint16_t timeout) {
+    if (!eeprom_sim_address(address)) {
+        return I2C_STATUS_ERROR;
+    }
+    // A repeated start in between, the address goes out twice
+    eeprom_sim_wire(2 + tx_length + rx_length);
+    eeprom_sim_write(tx_data, tx_length);
+    eeprom_sim_read(rx_data, rx_length);
+    return I2C_STATUS_SUCCESS;
+}
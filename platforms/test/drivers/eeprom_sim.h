@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Simulated external EEPROM for the test platform.
+ *
+ * Stands in for the I2C (24xx) or SPI (25xx) master driver, depending on which
+ * of eeprom_i2c_sim.c or eeprom_spi_sim.c is linked in, with the EEPROM as the
+ * only device on the bus. Each transfer advances the test clock by the time it
+ * would take on the wire, and a write leaves the EEPROM busy for a write cycle,
+ * during which it refuses anything but status polls -- I2C EEPROMs do not
+ * acknowledge their address, SPI EEPROMs only answer RDSR.
+ *
+ * Writes wrap around within their page like on the real thing, so a driver
+ * which does not split writes at page boundaries corrupts the data it wrote.
+ */
+
+typedef struct eeprom_sim_device_t {
+    uint32_t bus_hz;         // bus clock
+    uint32_t write_cycle_us; // time taken to program a page once it has been sent
+} eeprom_sim_device_t;
+
+typedef struct eeprom_sim_stats_t {
+    uint32_t transactions; // everything addressed to the EEPROM, including refused ones
+    uint32_t refused;      // transactions refused or ignored while a write cycle was in progress
+    uint32_t bytes;        // everything that went over the wire, addressing and commands included
+    uint32_t bus_us;       // time spent transferring those bytes
+    uint32_t page_writes;  // write cycles started
+    uint32_t page_wraps;   // writes which wrapped around to the start of their page
+} eeprom_sim_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Takes effect for the next transfer; defaults to the driver's worst-case write time on a 400kHz I2C or 8MHz SPI bus
+void eeprom_sim_configure(const eeprom_sim_device_t *device);
+
+// Erases the EEPROM to 0xFF, ends any write cycle and clears the stats
+void eeprom_sim_reset(void);
+
+// Direct access to the EEPROM contents, bypassing the bus
+uint8_t *eeprom_sim_memory(void);
+
+const eeprom_sim_stats_t *eeprom_sim_get_stats(void);
+void                      eeprom_sim_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,186 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "eeprom_sim.h"
+#include "eeprom.h"
+#include "spi_master.h"
+#include "timer.h"
+
+// Provided by the test platform timer
+void advance_time_us(uint32_t us);
+
+#define CMD_WREN 6
+#define CMD_WRDI 4
+#define CMD_RDSR 5
+#define CMD_READ 3
+#define CMD_WRITE 2
+
+#define SR_WIP 0x01
+#define SR_WEL 0x02
+
+typedef enum {
+    EEPROM_SIM_COMMAND,
+    EEPROM_SIM_ADDRESS,
+    EEPROM_SIM_DATA,
+    EEPROM_SIM_IGNORED,
+} eeprom_sim_state_t;
+
+static eeprom_sim_device_t device = {.bus_hz = 8000000, .write_cycle_us = 5000};
+static eeprom_sim_stats_t  stats;
+static uint8_t             memory[EXTERNAL_EEPROM_BYTE_COUNT];
+static uint32_t            busy_until_us;
+static bool                write_enabled;
+
+// State of the current transaction, between spi_start() and spi_stop()
+static bool               selected;
+static eeprom_sim_state_t state;
+static uint8_t            command;
+static uint8_t            address_bytes;
+static uint32_t           pointer;
+static uint32_t           page_offset;
+static bool               page_written;
+static bool               page_wrapped;
+
+void eeprom_sim_configure(const eeprom_sim_device_t *config) {
+    device = *config;
+}
+
+void eeprom_sim_reset(void) {
+    memset(memory, 0xFF, sizeof(memory));
+    busy_until_us = timer_read_us();
+    write_enabled = false;
+    selected      = false;
+    eeprom_sim_reset_stats();
+}
+
+uint8_t *eeprom_sim_memory(void) {
+    return memory;
+}
+
+const eeprom_sim_stats_t *eeprom_sim_get_stats(void) {
+    return &stats;
+}
+
+void eeprom_sim_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+static bool eeprom_sim_busy(void) {
+    return (int32_t)(timer_read_us() - busy_until_us) < 0;
+}
+
+// Accounts for bytes on the wire
+static void eeprom_sim_wire(uint16_t bytes) {
+    uint32_t us = (uint32_t)(((uint64_t)bytes * 8 * 1000000 + device.bus_hz - 1) / device.bus_hz);
+    stats.bytes += bytes;
+    stats.bus_us += us;
+    advance_time_us(us);
+}
+
+static uint8_t eeprom_sim_exchange(uint8_t mosi) {
+    uint8_t miso = 0xFF;
+    switch (state) {
+        case EEPROM_SIM_COMMAND:
+            command = mosi;
+            state   = EEPROM_SIM_IGNORED;
+            if (eeprom_sim_busy() && command != CMD_RDSR) {
+                stats.refused++;
+            } else if (command == CMD_WREN) {
+                write_enabled = true;
+            } else if (command == CMD_WRDI) {
+                write_enabled = false;
+            } else if (command == CMD_RDSR) {
+                state = EEPROM_SIM_DATA;
+            } else if (command == CMD_READ || (command == CMD_WRITE && write_enabled)) {
+                state         = EEPROM_SIM_ADDRESS;
+                address_bytes = 0;
+                pointer       = 0;
+            }
+            break;
+        case EEPROM_SIM_ADDRESS:
+            pointer = (pointer << 8) | mosi;
+            if (++address_bytes == EXTERNAL_EEPROM_ADDRESS_SIZE) {
+                pointer %= EXTERNAL_EEPROM_BYTE_COUNT;
+                page_offset = pointer % EXTERNAL_EEPROM_PAGE_SIZE;
+                pointer -= page_offset;
+                state = EEPROM_SIM_DATA;
+            }
+            break;
+        case EEPROM_SIM_DATA:
+            if (command == CMD_RDSR) {
+                miso = (eeprom_sim_busy() ? SR_WIP : 0) | (write_enabled ? SR_WEL : 0);
+            } else if (command == CMD_READ) {
+                miso        = memory[(pointer + page_offset) % EXTERNAL_EEPROM_BYTE_COUNT];
+                page_offset = page_offset + 1;
+            } else {
+                // Data goes into the page buffer, where the address wraps around within the page
+                if (page_written && page_offset == 0) {
+                    page_wrapped = true;
+                }
+                memory[pointer + page_offset] = mosi;
+                page_offset                   = (page_offset + 1) % EXTERNAL_EEPROM_PAGE_SIZE;
+                page_written                  = true;
+            }
+            break;
+        case EEPROM_SIM_IGNORED:
+            break;
+    }
+    eeprom_sim_wire(1);
+    return miso;
+}
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    if (selected || slavePin != EXTERNAL_EEPROM_SPI_SLAVE_SELECT_PIN) {
+        return false;
+    }
+    stats.transactions++;
+    selected     = true;
+    state        = EEPROM_SIM_COMMAND;
+    page_written = false;
+    page_wrapped = false;
+    return true;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    eeprom_sim_exchange(data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_read(void) {
+    return eeprom_sim_exchange(0xFF);
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        eeprom_sim_exchange(data[i]);
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = eeprom_sim_exchange(0xFF);
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    if (!selected) {
+        return;
+    }
+    selected = false;
+
+    // The page is programmed once the EEPROM is deselected
+    if (command == CMD_WRITE && page_written) {
+        stats.page_writes++;
+        if (page_wrapped) {
+            stats.page_wraps++;
+        }
+        write_enabled = false;
+        busy_until_us = timer_read_us() + device.write_cycle_us;
+    }
+}
@@ -0,0 +1,458 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include "split_sim.h"
+#include "keyboard.h"
+#include "matrix.h"
+#include "timer.h"
+#include "test_matrix.h"
+#include "transactions.h"
+#include "transport.h"
+#include "util.h"
+
+#ifdef ENCODER_ENABLE
+#    include "encoder.h"
+#endif
+
+#ifdef USE_I2C
+#    include "i2c_master.h"
+#    include "i2c_slave.h"
+#else
+#    include "serial.h"
+#endif
+
+// Provided by the test platform timer
+void advance_time_us(uint32_t us);
+
+#define SPLIT_SIM_UART_BITS 10 // start + 8 data + stop
+#define SPLIT_SIM_I2C_BITS 9   // 8 data + ack
+
+enum {
+    SPLIT_SIM_TRANSACTION,
+    SPLIT_SIM_I2C_WRITE,
+    SPLIT_SIM_I2C_READ,
+    SPLIT_SIM_KEY,
+    SPLIT_SIM_ENCODER,
+    SPLIT_SIM_STOP,
+};
+
+typedef struct split_sim_message_t {
+    uint8_t  type;
+    uint8_t  target; // transaction id, register, row or encoder
+    uint8_t  col;
+    bool     pressed; // or clockwise
+    uint16_t length;
+    uint32_t time_us;
+    uint8_t  data[sizeof(split_shared_memory_t)];
+} split_sim_message_t;
+
+static split_sim_link_t  link_config = {.baud = 115200, .slave_scan_us = 1000, .seed = 1};
+static split_sim_stats_t stats;
+static uint32_t          rng_state = 1;
+static bool              is_master = true;
+static int               sim_socket = -1;
+static uint32_t          next_scan_us;
+
+////////////////////////////////////////////////////
+// Link model
+
+static uint32_t split_sim_random(void) {
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Flips bits of data in flight, returns true if any were
+static bool split_sim_corrupt(uint8_t *data, uint16_t length) {
+    if (link_config.bit_error_ppm == 0) return false;
+
+    bool corrupted = false;
+    for (uint16_t i = 0; i < length; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (split_sim_random() % 1000000 < link_config.bit_error_ppm) {
+                data[i] ^= 1 << bit;
+                corrupted = true;
+                stats.bit_errors++;
+            }
+        }
+    }
+    return corrupted;
+}
+
+// Accounts for bytes on the wire, the master is blocked until they are through
+static void split_sim_wire(uint16_t bytes, uint8_t bits_per_byte, uint8_t turnarounds) {
+    uint32_t us = (uint32_t)(((uint64_t)bytes * bits_per_byte * 1000000 + link_config.baud - 1) / link_config.baud) + (uint32_t)turnarounds * link_config.latency_us;
+    stats.bytes += bytes;
+    stats.busy_us += us;
+    advance_time_us(us);
+}
+
+static bool split_sim_exchange(split_sim_message_t *message, bool expect_reply) {
+    if (sim_socket < 0) return false;
+
+    message->time_us = timer_read_us();
+    if (send(sim_socket, message, offsetof(split_sim_message_t, data) + message->length, 0) < 0) {
+        return false;
+    }
+    return !expect_reply || recv(sim_socket, message, sizeof(split_sim_message_t), 0) > 0;
+}
+
+////////////////////////////////////////////////////
+// Slave half
+
+static void split_sim_catch_up(uint32_t now_us) {
+    while ((int32_t)(now_us - next_scan_us) >= 0) {
+        advance_time_us(next_scan_us - timer_read_us());
+        keyboard_task();
+        housekeeping_task();
+        next_scan_us += link_config.slave_scan_us;
+    }
+    advance_time_us(now_us - timer_read_us());
+}
+
+static void split_sim_run_callback(int8_t id) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) return;
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+}
+
+static void split_sim_slave_handle(split_sim_message_t *message) {
+    switch (message->type) {
+        case SPLIT_SIM_KEY:
+            if (message->pressed) {
+                press_key(message->col, MATRIX_ROWS_PER_HAND + message->target);
+            } else {
+                release_key(message->col, MATRIX_ROWS_PER_HAND + message->target);
+            }
+            return;
+
+#ifdef ENCODER_ENABLE
+        case SPLIT_SIM_ENCODER:
+            encoder_queue_event(message->target, message->pressed);
+            return;
+#endif
+
+#ifdef USE_I2C
+        case SPLIT_SIM_I2C_WRITE:
+            memcpy((uint8_t *)&i2c_slave_reg[message->target], message->data, MIN(message->length, I2C_SLAVE_REG_COUNT - message->target));
+            if (message->target == split_transaction_table[I2C_EXECUTE_CALLBACK].initiator2target_offset) {
+                split_sim_run_callback(split_shmem->transaction_id);
+            }
+            message->length = 0;
+            break;
+
+        case SPLIT_SIM_I2C_READ:
+            message->length = MIN(message->length, I2C_SLAVE_REG_COUNT - message->target);
+            memcpy(message->data, (uint8_t *)&i2c_slave_reg[message->target], message->length);
+            break;
+#else
+        case SPLIT_SIM_TRANSACTION: {
+            split_transaction_desc_t *trans = &split_transaction_table[message->target];
+            memcpy(split_trans_initiator2target_buffer(trans), message->data, MIN(message->length, trans->initiator2target_buffer_size));
+            split_sim_run_callback(message->target);
+            message->length = trans->target2initiator_buffer_size;
+            memcpy(message->data, split_trans_target2initiator_buffer(trans), message->length);
+            break;
+        }
+#endif
+
+        default:
+            return;
+    }
+
+    send(sim_socket, message, offsetof(split_sim_message_t, data) + message->length, 0);
+}
+
+static void split_sim_slave_main(uint32_t boot_us) {
+    // Power on together with the master
+    advance_time_us(boot_us);
+    keyboard_init();
+
+    static split_sim_message_t message;
+    next_scan_us = timer_read_us();
+    while (recv(sim_socket, &message, sizeof(message), 0) > 0 && message.type != SPLIT_SIM_STOP) {
+        split_sim_catch_up(message.time_us);
+        split_sim_slave_handle(&message);
+    }
+}
+
+bool is_keyboard_master_impl(void) {
+    return is_master;
+}
+
+////////////////////////////////////////////////////
+// Zygote
+
+/* Slaves are not forked off the test process itself: by the time a test runs,
+ * its globals hold master state, the transport's included. A copy taken before
+ * main() forks them instead, so each one starts from power-on state. */
+
+typedef struct split_sim_boot_t {
+    split_sim_link_t link;
+    uint32_t         time_us;
+} split_sim_boot_t;
+
+static int zygote_socket = -1;
+
+static void split_sim_zygote_main(int requests) {
+    signal(SIGCHLD, SIG_IGN);
+
+    split_sim_boot_t boot;
+    while (recv(requests, &boot, sizeof(boot), 0) == sizeof(boot)) {
+        int sockets[2] = {-1, -1};
+        if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets) == 0) {
+            pid_t pid = fork();
+            if (pid == 0) {
+                close(requests);
+                close(sockets[0]);
+                sim_socket = sockets[1];
+                is_master  = false;
+                split_sim_configure(&boot.link);
+                split_sim_slave_main(boot.time_us);
+                _exit(0);
+            }
+            close(sockets[1]);
+        }
+
+        // Hand the master its end of the link, no descriptor at all if the boot failed
+        char          cmsg_buffer[CMSG_SPACE(sizeof(int))] = {0};
+        uint8_t       status                               = sockets[0] >= 0;
+        struct iovec  iov                                  = {.iov_base = &status, .iov_len = sizeof(status)};
+        struct msghdr reply                                = {.msg_iov = &iov, .msg_iovlen = 1};
+        if (status) {
+            reply.msg_control    = cmsg_buffer;
+            reply.msg_controllen = sizeof(cmsg_buffer);
+
+            struct cmsghdr *cmsg = CMSG_FIRSTHDR(&reply);
+            cmsg->cmsg_level     = SOL_SOCKET;
+            cmsg->cmsg_type      = SCM_RIGHTS;
+            cmsg->cmsg_len       = CMSG_LEN(sizeof(int));
+            memcpy(CMSG_DATA(cmsg), &sockets[0], sizeof(int));
+        }
+        sendmsg(requests, &reply, 0);
+        if (status) {
+            close(sockets[0]);
+        }
+    }
+}
+
+__attribute__((constructor)) static void split_sim_zygote_init(void) {
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets) < 0) return;
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(sockets[0]);
+        split_sim_zygote_main(sockets[1]);
+        _exit(0);
+    }
+    close(sockets[1]);
+    zygote_socket = pid > 0 ? sockets[0] : -1;
+}
+
+////////////////////////////////////////////////////
+// Master half
+
+void split_sim_configure(const split_sim_link_t *link) {
+    link_config = *link;
+    if (link_config.baud == 0) {
+        link_config.baud = 115200;
+    }
+    if (link_config.slave_scan_us == 0) {
+        link_config.slave_scan_us = 1000;
+    }
+    rng_state = link_config.seed ? link_config.seed : 1;
+}
+
+bool split_sim_start(void) {
+    if (sim_socket >= 0 || zygote_socket < 0) return false;
+
+    split_sim_boot_t boot = {.link = link_config, .time_us = timer_read_us()};
+    if (send(zygote_socket, &boot, sizeof(boot), 0) < 0) return false;
+
+    char           cmsg_buffer[CMSG_SPACE(sizeof(int))];
+    uint8_t        status = 0;
+    struct iovec   iov    = {.iov_base = &status, .iov_len = sizeof(status)};
+    struct msghdr  reply  = {.msg_iov = &iov, .msg_iovlen = 1, .msg_control = cmsg_buffer, .msg_controllen = sizeof(cmsg_buffer)};
+    if (recvmsg(zygote_socket, &reply, 0) <= 0 || !status) return false;
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&reply);
+    if (!cmsg || cmsg->cmsg_type != SCM_RIGHTS) return false;
+    memcpy(&sim_socket, CMSG_DATA(cmsg), sizeof(int));
+
+    split_sim_reset_stats();
+    return true;
+}
+
+void split_sim_stop(void) {
+    if (sim_socket < 0) return;
+
+    split_sim_message_t message = {.type = SPLIT_SIM_STOP};
+    split_sim_exchange(&message, false);
+    close(sim_socket);
+    sim_socket = -1;
+}
+
+bool split_sim_is_running(void) {
+    return sim_socket >= 0;
+}
+
+static void split_sim_key(uint8_t col, uint8_t row, bool pressed) {
+    split_sim_message_t message = {.type = SPLIT_SIM_KEY, .target = row, .col = col, .pressed = pressed};
+    split_sim_exchange(&message, false);
+}
+
+void split_sim_press_key(uint8_t col, uint8_t row) {
+    split_sim_key(col, row, true);
+}
+
+void split_sim_release_key(uint8_t col, uint8_t row) {
+    split_sim_key(col, row, false);
+}
+
+#ifdef ENCODER_ENABLE
+void split_sim_turn_encoder(uint8_t index, bool clockwise) {
+    split_sim_message_t message = {.type = SPLIT_SIM_ENCODER, .target = index, .pressed = clockwise};
+    split_sim_exchange(&message, false);
+}
+#endif
+
+const split_sim_stats_t *split_sim_get_stats(void) {
+    return &stats;
+}
+
+void split_sim_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+#ifdef USE_I2C
+
+volatile uint8_t i2c_slave_reg[I2C_SLAVE_REG_COUNT];
+
+void i2c_init(void) {}
+
+void i2c_slave_init(uint8_t address) {}
+
+void i2c_slave_stop(void) {}
+
+// Attributes a register access to the transaction whose buffer starts there
+static int8_t split_sim_register_owner(uint8_t reg, bool write) {
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t *trans  = &split_transaction_table[id];
+        uint16_t                  offset = write ? trans->initiator2target_offset : trans->target2initiator_offset;
+        uint8_t                   size   = write ? trans->initiator2target_buffer_size : trans->target2initiator_buffer_size;
+        if (size > 0 && offset == reg) {
+            return id;
+        }
+    }
+    return -1;
+}
+
+// The device address and register byte; a flipped bit there is a NACK
+static bool split_sim_i2c_address(uint8_t devaddr, uint8_t reg, bool write, uint8_t *framing) {
+    int8_t id = split_sim_register_owner(reg, write);
+    if (id >= 0) {
+        stats.transactions[id].attempts++;
+    }
+
+    uint8_t header[3] = {devaddr << 1, reg, (devaddr << 1) | 1};
+    *framing          = write ? 2 : 3;
+    if (sim_socket < 0 || split_sim_corrupt(header, *framing)) {
+        split_sim_wire(*framing, SPLIT_SIM_I2C_BITS, 1);
+        if (id >= 0) {
+            stats.transactions[id].failures++;
+        }
+        return false;
+    }
+    return true;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    uint8_t framing;
+    if (!split_sim_i2c_address(devaddr, regaddr, true, &framing)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    static split_sim_message_t message;
+    message.type   = SPLIT_SIM_I2C_WRITE;
+    message.target = regaddr;
+    message.length = length;
+    memcpy(message.data, data, length);
+    split_sim_corrupt(message.data, length);
+    bool okay = split_sim_exchange(&message, true);
+
+    split_sim_wire(framing + length, SPLIT_SIM_I2C_BITS, 1);
+    return okay ? I2C_STATUS_SUCCESS : I2C_STATUS_ERROR;
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    uint8_t framing;
+    if (!split_sim_i2c_address(devaddr, regaddr, false, &framing)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    static split_sim_message_t message;
+    message.type   = SPLIT_SIM_I2C_READ;
+    message.target = regaddr;
+    message.length = length;
+    bool okay      = split_sim_exchange(&message, true);
+    if (okay) {
+        split_sim_corrupt(message.data, message.length);
+        memcpy(data, message.data, MIN(length, message.length));
+    }
+
+    split_sim_wire(framing + length, SPLIT_SIM_I2C_BITS, 2);
+    return okay ? I2C_STATUS_SUCCESS : I2C_STATUS_ERROR;
+}
+
+#else // USE_I2C
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    uint8_t                   i2t   = trans->initiator2target_buffer_size;
+    uint8_t                   t2i   = trans->target2initiator_buffer_size;
+    stats.transactions[sstd_index].attempts++;
+
+    // The id goes out and comes back xor'ed as the handshake, any damage to either aborts
+    uint8_t handshake[2] = {sstd_index, sstd_index ^ NUM_TOTAL_TRANSACTIONS};
+    if (sim_socket < 0 || split_sim_corrupt(handshake, sizeof(handshake))) {
+        split_sim_wire(sizeof(handshake), SPLIT_SIM_UART_BITS, 1);
+        stats.transactions[sstd_index].failures++;
+        return false;
+    }
+
+    static split_sim_message_t message;
+    message.type   = SPLIT_SIM_TRANSACTION;
+    message.target = sstd_index;
+    message.length = i2t;
+    memcpy(message.data, split_trans_initiator2target_buffer(trans), i2t);
+    split_sim_corrupt(message.data, i2t);
+    if (!split_sim_exchange(&message, true)) {
+        stats.transactions[sstd_index].failures++;
+        return false;
+    }
+    split_sim_corrupt(message.data, message.length);
+    memcpy(split_trans_target2initiator_buffer(trans), message.data, MIN(t2i, message.length));
+
+    // id, handshake, then each direction change of the half duplex line
+    split_sim_wire(sizeof(handshake) + i2t + t2i, SPLIT_SIM_UART_BITS, 1 + (i2t ? 1 : 0) + (i2t && t2i ? 1 : 0));
+    return true;
+}
+
+#endif // USE_I2C
@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transaction_id_define.h"
+
+/* Simulated split transport for the test platform.
+ *
+ * The slave half runs as a forked copy of the test process, the firmware keeps
+ * all of its state in globals so a second instance cannot share an address
+ * space with the first. Both halves talk through a socket pair standing in for
+ * the serial line (or the I2C bus with USE_I2C), and the link decides how long
+ * each transfer takes on the test clock and which bits arrive flipped.
+ *
+ * The slave's clock follows the master's: it catches up, scanning its matrix
+ * every slave_scan_us on the way, each time the master reaches out to it.
+ */
+
+typedef struct split_sim_link_t {
+    uint32_t baud;          // bits per second, the bus clock with USE_I2C
+    uint16_t latency_us;    // added each time the link changes direction
+    uint32_t bit_error_ppm; // chance of each bit on the wire being flipped, in parts per million
+    uint16_t slave_scan_us; // matrix scan interval of the slave half
+    uint32_t seed;          // for the bit error generator
+} split_sim_link_t;
+
+typedef struct split_sim_transaction_stats_t {
+    uint32_t attempts;
+    uint32_t failures; // handshake or addressing errors, the transfer was abandoned
+} split_sim_transaction_stats_t;
+
+typedef struct split_sim_stats_t {
+    split_sim_transaction_stats_t transactions[NUM_TOTAL_TRANSACTIONS];
+    uint32_t                      bytes;   // everything that went over the wire, framing included
+    uint32_t                      busy_us; // time the master spent waiting on the link
+    uint32_t                      bit_errors;
+} split_sim_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Takes effect for the next transfer; defaults to a clean 115200 baud link
+void split_sim_configure(const split_sim_link_t *link);
+
+// Forks the slave half off the current firmware state and makes this process the master
+bool split_sim_start(void);
+void split_sim_stop(void);
+bool split_sim_is_running(void);
+
+// row is relative to the slave half's rows
+void split_sim_press_key(uint8_t col, uint8_t row);
+void split_sim_release_key(uint8_t col, uint8_t row);
+
+#ifdef ENCODER_ENABLE
+// Queues a step of one of the slave half's encoders, index counts across both halves
+void split_sim_turn_encoder(uint8_t index, bool clockwise);
+#endif
+
+const split_sim_stats_t *split_sim_get_stats(void);
+void                     split_sim_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
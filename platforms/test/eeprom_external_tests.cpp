@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "eeprom_sim.h"
+#include "timer.h"
+}
+
+// Worst case the drivers allow for, and a more typical write cycle well within it
+#ifdef EEPROM_I2C
+static const eeprom_sim_device_t worst_case = {.bus_hz = 400000, .write_cycle_us = EXTERNAL_EEPROM_WRITE_TIME * 1000};
+#else
+static const eeprom_sim_device_t worst_case = {.bus_hz = 8000000, .write_cycle_us = 5000};
+#endif
+static const uint32_t write_cycle_us = 3000;
+
+class EepromExternal : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        eeprom_sim_device_t device = worst_case;
+        device.write_cycle_us      = write_cycle_us;
+        eeprom_sim_configure(&device);
+        eeprom_sim_reset();
+        eeprom_driver_init();
+
+        // Settle anything the driver assumes may be pending from before a reset
+        uint8_t buffer[EXTERNAL_EEPROM_READ_AHEAD_SIZE + 1];
+        eeprom_read_block(buffer, (const void *)0, sizeof(buffer));
+        eeprom_sim_reset_stats();
+    }
+
+    void fill(uint8_t *data, size_t length, uint8_t seed) {
+        for (size_t i = 0; i < length; i++) {
+            data[i] = seed + i * 7;
+        }
+    }
+};
+
+/**
+ * This test verifies that writes are split at page boundaries, and that each page is sent as soon as the EEPROM has
+ * finished with the previous one rather than after a fixed delay.
+ */
+TEST_F(EepromExternal, WritesArePageAlignedBursts) {
+    const uintptr_t address = 5;
+    uint8_t         data[300];
+    fill(data, sizeof(data), 0x11);
+
+    const uint32_t start = timer_read_us();
+    eeprom_write_block(data, (void *)address, sizeof(data));
+    const uint32_t elapsed = timer_read_us() - start;
+
+    const eeprom_sim_stats_t *stats = eeprom_sim_get_stats();
+    const uint32_t            pages = (address + sizeof(data) + EXTERNAL_EEPROM_PAGE_SIZE - 1) / EXTERNAL_EEPROM_PAGE_SIZE - address / EXTERNAL_EEPROM_PAGE_SIZE;
+    std::printf("[   INFO   ] %zu bytes over %u pages: %u transactions, %u refused, %uus on the bus, %uus total\n", sizeof(data), pages, stats->transactions, stats->refused, stats->bus_us, elapsed);
+
+    EXPECT_EQ(stats->page_writes, pages);
+    EXPECT_EQ(stats->page_wraps, 0) << "Write crossed a page boundary";
+    EXPECT_EQ(memcmp(&eeprom_sim_memory()[address], data, sizeof(data)), 0);
+
+    // Only the write cycles in between pages are waited for, the last one runs on in the background
+    EXPECT_LE(elapsed, (pages - 1) * write_cycle_us + stats->bus_us);
+}
+
+/**
+ * This test verifies that a read straight after a write waits for the EEPROM to finish, even when it takes as long
+ * as the driver allows for.
+ */
+TEST_F(EepromExternal, ReadWaitsForWriteCycle) {
+    eeprom_sim_configure(&worst_case);
+
+    uint8_t data[EXTERNAL_EEPROM_PAGE_SIZE * 2];
+    uint8_t readback[sizeof(data)];
+    fill(data, sizeof(data), 0x22);
+
+    eeprom_write_block(data, (void *)0, sizeof(data));
+    eeprom_read_block(readback, (const void *)0, sizeof(readback));
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+    EXPECT_GE(timer_read_us(), 2 * worst_case.write_cycle_us) << "Read did not wait for the write cycle";
+}
+
+/**
+ * This test verifies that reading a byte at a time, e.g. while sending a dynamic macro, only goes to the EEPROM once
+ * per read-ahead window.
+ */
+TEST_F(EepromExternal, SequentialReadsAreReadAhead) {
+    const size_t length = 256;
+    fill(eeprom_sim_memory(), length, 0x33);
+
+    const uint32_t start = timer_read_us();
+    for (size_t i = 0; i < length; i++) {
+        EXPECT_EQ(eeprom_read_byte((const uint8_t *)i), eeprom_sim_memory()[i]);
+    }
+    const uint32_t elapsed = timer_read_us() - start;
+
+    const eeprom_sim_stats_t *stats = eeprom_sim_get_stats();
+    std::printf("[   INFO   ] %zu single byte reads: %u transactions, %u bytes, %uus\n", length, stats->transactions, stats->bytes, elapsed);
+#if EXTERNAL_EEPROM_READ_AHEAD_SIZE > 0
+    EXPECT_EQ(stats->transactions, length / EXTERNAL_EEPROM_READ_AHEAD_SIZE);
+#else
+    EXPECT_EQ(stats->transactions, length);
+#endif
+}
+
+/**
+ * This test verifies that a read bigger than the read-ahead window goes to the EEPROM in one go.
+ */
+TEST_F(EepromExternal, LargeReadIsOneTransaction) {
+    uint8_t readback[EXTERNAL_EEPROM_PAGE_SIZE * 3];
+    fill(eeprom_sim_memory(), EXTERNAL_EEPROM_BYTE_COUNT, 0x44);
+
+    eeprom_read_block(readback, (const void *)3, sizeof(readback));
+    EXPECT_EQ(memcmp(readback, &eeprom_sim_memory()[3], sizeof(readback)), 0);
+    EXPECT_EQ(eeprom_sim_get_stats()->transactions, 1);
+}
+
+/**
+ * This test verifies that writing to the read-ahead window drops it, so that the new data is read back.
+ */
+TEST_F(EepromExternal, WriteInvalidatesReadAhead) {
+    fill(eeprom_sim_memory(), EXTERNAL_EEPROM_BYTE_COUNT, 0x55);
+
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)10), eeprom_sim_memory()[10]);
+    eeprom_update_byte((uint8_t *)11, 0xA5);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)11), 0xA5);
+    EXPECT_EQ(eeprom_sim_memory()[11], 0xA5);
+
+    eeprom_update_dword((uint32_t *)12, 0x12345678);
+    EXPECT_EQ(eeprom_read_dword((const uint32_t *)12), 0x12345678);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// The test platform has no GPIO, the simulated SPI EEPROM is only told apart by its pin number
+typedef uint8_t pin_t;
+
+#define EXTERNAL_EEPROM_SPI_SLAVE_SELECT_PIN 0
@@ -23,3 +23,27 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+eeprom_external_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_external_tests.cpp
+eeprom_external_INC := \
+	$(TOP_DIR)/drivers \
+	$(TOP_DIR)/drivers/eeprom \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+
+eeprom_i2c_DEFS := -DEEPROM_DRIVER -DEEPROM_I2C -DEEPROM_I2C_24LC64 -DNO_PRINT
+eeprom_i2c_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_external_tests_config.h
+eeprom_i2c_INC := $(eeprom_external_INC)
+eeprom_i2c_SRC := $(eeprom_external_SRC) \
+	$(TOP_DIR)/drivers/eeprom/eeprom_i2c.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/eeprom_i2c_sim.c
+
+eeprom_spi_DEFS := -DEEPROM_DRIVER -DEEPROM_SPI -DNO_PRINT
+eeprom_spi_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_external_tests_config.h
+eeprom_spi_INC := $(eeprom_external_INC)
+eeprom_spi_SRC := $(eeprom_external_SRC) \
+	$(TOP_DIR)/drivers/eeprom/eeprom_spi.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/eeprom_spi_sim.c
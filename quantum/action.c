@@ -76,7 +76,14 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
  * FIXME: Needs documentation.
  */
 void action_exec(keyevent_t event) {
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_action_exec(&event);
+#endif
+
     if (IS_EVENT(event)) {
+#ifdef ADAPTIVE_TICK_ENABLE
+        adaptive_tick_wake();
+#endif
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
         debug_event(event);
@@ -281,6 +288,9 @@ void process_record(keyrecord_t *record) {
     if (IS_NOEVENT(record->event)) {
         return;
     }
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process_record(record);
+#endif
 #ifdef SPECULATIVE_HOLD
     if (record->event.pressed) {
         speculative_key_settled(record);
@@ -1141,6 +1151,19 @@ void clear_keyboard_but_mods_and_keys(void) {
 #endif
 }
 
+uint32_t action_tick_deadline(void) {
+    uint32_t remaining = DEADLINE_NONE;
+#ifndef NO_ACTION_ONESHOT
+    if (keymap_config.oneshot_enable) {
+        remaining = oneshot_timeout_deadline();
+    }
+#endif
+#ifndef NO_ACTION_TAPPING
+    remaining = MIN(remaining, action_tapping_deadline());
+#endif
+    return remaining;
+}
+
 /** \brief Utilities for actions. (FIXME: Needs better description)
  *
  * FIXME: Needs documentation.
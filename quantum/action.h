@@ -23,6 +23,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keyboard.h"
 #include "keycode.h"
 #include "action_code.h"
+#include "adaptive_tick.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -128,6 +129,12 @@ void layer_switch(uint8_t new_layer);
 bool is_tap_record(keyrecord_t *record);
 bool is_tap_action(action_t action);
 
+/**
+ * Milliseconds until a tick event has work to do, DEADLINE_NONE if no tap-hold
+ * key or one shot is waiting on one.
+ */
+uint32_t action_tick_deadline(void);
+
 /**
  * Given an MT or LT keycode, returns the tap keycode. Otherwise returns the
  * original keycode unchanged.
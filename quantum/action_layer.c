@@ -6,6 +6,15 @@
 #include "encoder.h"
 #include "util.h"
 #include "action_layer.h"
+#include "keymap_common.h"
+
+#ifdef KEYMAP_CACHE_ENABLE
+#    include "keymap_cache.h"
+#endif
+
+#ifdef ADAPTIVE_TICK_ENABLE
+#    include "adaptive_tick.h"
+#endif
 
 /** \brief Default Layer State
  */
@@ -48,6 +57,10 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+#ifdef ADAPTIVE_TICK_ENABLE
+    // The host or VIA may change layers outside of a key event
+    adaptive_tick_wake();
+#endif
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -138,6 +151,9 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+#    ifdef ADAPTIVE_TICK_ENABLE
+    adaptive_tick_wake();
+#    endif
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -341,20 +357,30 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
  */
 uint8_t layer_switch_get_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
-    action_t action;
-    action.code = ACTION_TRANSPARENT;
+#    ifdef KEYMAP_CACHE_ENABLE
+    uint8_t cached_layer;
+    if (keymap_cache_get(key, &cached_layer, NULL)) {
+        return cached_layer;
+    }
+#    endif
 
     layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
-            action = action_for_key(i, key);
-            if (action.code != ACTION_TRANSPARENT) {
+            uint16_t keycode = keymap_key_to_keycode(i, key);
+            if (action_for_keycode(keycode).code != ACTION_TRANSPARENT) {
+#    ifdef KEYMAP_CACHE_ENABLE
+                keymap_cache_set(key, i, keycode);
+#    endif
                 return i;
             }
         }
     }
     /* fall back to layer 0 */
+#    ifdef KEYMAP_CACHE_ENABLE
+    keymap_cache_set(key, 0, keymap_key_to_keycode(0, key));
+#    endif
     return 0;
 #else
     return get_highest_layer(default_layer_state);
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -7,6 +8,7 @@
 #include "action_util.h"
 #include "keycode.h"
 #include "keycode_config.h"
+#include "matrix.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
 #include "wait.h"
@@ -132,9 +134,17 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+/* Keys that have a press (index 1) or release (index 0) in waiting_buffer.
+ * Bits are only cleared once the buffer runs empty, so a set bit means "maybe
+ * buffered" and a clear bit means "definitely not buffered". Events outside
+ * of the key matrix (combos, encoders, ...) are tracked by a single flag.
+ */
+static matrix_row_t waiting_buffer_keys[2][MATRIX_ROWS] = {};
+static bool         waiting_buffer_other_events         = false;
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
-static void waiting_buffer_clear(void);
+static void waiting_buffer_make_room(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
@@ -161,11 +171,10 @@ void action_tapping_process(keyrecord_t record) {
         }
     } else {
         if (!waiting_buffer_enq(record)) {
-            // clear all in case of overflow.
-            ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
-            clear_keyboard();
-            waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
+            // settle buffered events instead of dropping them on overflow.
+            ac_dprintf("OVERFLOW: SETTLE WAITING BUFFER\n");
+            waiting_buffer_make_room();
+            waiting_buffer_enq(record);
         }
     }
 
@@ -179,11 +188,17 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    while (waiting_buffer_tail != waiting_buffer_head) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
+            waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        } else if (IS_NOEVENT(tapping_key.event)) {
+            // The tapping key was settled by this event, which is still the
+            // oldest one; process it again rather than leaving it buffered
+            // behind events that would then bypass it.
+            continue;
         } else {
             break;
         }
@@ -199,6 +214,23 @@ void action_tapping_process(keyrecord_t record) {
     }
 }
 
+/** \brief Milliseconds until tick events have tapping state to process
+ *
+ * Tick events settle the tapping key and the waiting buffer, and expire Flow Tap.
+ */
+uint32_t action_tapping_deadline(void) {
+    if (IS_EVENT(tapping_key.event) || waiting_buffer_head != waiting_buffer_tail) {
+        return 0;
+    }
+#    ifdef FLOW_TAP_TERM
+    if (!flow_tap_expired) {
+        const uint16_t elapsed = TIMER_DIFF_16(timer_read(), flow_tap_prev_time);
+        return elapsed >= INT16_MAX / 2 ? 0 : INT16_MAX / 2 - elapsed;
+    }
+#    endif // FLOW_TAP_TERM
+    return DEADLINE_NONE;
+}
+
 /* Some conditionally defined helper macros to keep process_tapping more
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
@@ -254,7 +286,8 @@ bool process_tapping(keyrecord_t *keyp) {
     const keyevent_t event = keyp->event;
 
 #    if defined(CHORDAL_HOLD) || defined(FLOW_TAP_TERM)
-    if (!event.pressed) {
+    // Tick events carry key (0, 0), so they must not match a registered tap.
+    if (IS_EVENT(event) && !event.pressed) {
         const int8_t i = registered_tap_find(event.key);
         if (i != -1) {
             // If a tap-hold key was previously settled as tapped, set its
@@ -664,6 +697,16 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return false;
     }
 
+    if (waiting_buffer_head == waiting_buffer_tail) {
+        memset(waiting_buffer_keys, 0, sizeof(waiting_buffer_keys));
+        waiting_buffer_other_events = false;
+    }
+    if (IS_KEYEVENT(record.event) && record.event.key.row < MATRIX_ROWS && record.event.key.col < MATRIX_COLS) {
+        waiting_buffer_keys[record.event.pressed][record.event.key.row] |= (matrix_row_t)1 << record.event.key.col;
+    } else {
+        waiting_buffer_other_events = true;
+    }
+
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
 
@@ -672,20 +715,42 @@ bool waiting_buffer_enq(keyrecord_t record) {
     return true;
 }
 
-/** \brief Waiting buffer clear
+/** \brief Frees a slot in a full waiting buffer without losing events
  *
- * FIXME: Needs docs
+ * The waiting buffer only fills up while the tapping key is pressed and still
+ * undecided, so it is settled as held, just as if its tapping term had ended.
+ * Buffered events are then processed in order until one slot is free.
  */
-void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+void waiting_buffer_make_room(void) {
+    while ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+        if (IS_EVENT(tapping_key.event) && tapping_key.event.pressed && tapping_key.tap.count == 0) {
+            ac_dprintf("waiting_buffer_make_room: settle tapping key as held.\n");
+            process_record(&tapping_key);
+        }
+        tapping_key = (keyrecord_t){0};
+        debug_tapping_key();
+
+        // With no tapping key, the oldest event is always consumed; it may
+        // however become the new tapping key and keep the rest buffered.
+        process_tapping(&waiting_buffer[waiting_buffer_tail]);
+        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+    }
+    debug_waiting_buffer();
 }
 
 /** \brief Waiting buffer typed
  *
- * FIXME: Needs docs
+ * Checks whether the opposite event for the key of `event` is buffered.
  */
 bool waiting_buffer_typed(keyevent_t event) {
+    if (IS_KEYEVENT(event) && event.key.row < MATRIX_ROWS && event.key.col < MATRIX_COLS) {
+        if (!(waiting_buffer_keys[!event.pressed][event.key.row] & ((matrix_row_t)1 << event.key.col))) {
+            return false;
+        }
+    } else if (!waiting_buffer_other_events) {
+        return false;
+    }
+
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
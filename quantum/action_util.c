@@ -22,6 +22,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "action_tapping.h"
 #include "timer.h"
 #include "keycode_config.h"
+#include "util.h"
 #include <string.h>
 
 extern keymap_config_t keymap_config;
@@ -177,6 +178,31 @@ void clear_oneshot_swaphands(void) {
 
 #    endif
 
+#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+static uint32_t oneshot_remaining(uint16_t since) {
+    const uint16_t elapsed = TIMER_DIFF_16(timer_read(), since);
+    return elapsed >= ONESHOT_TIMEOUT ? 0 : ONESHOT_TIMEOUT - elapsed;
+}
+#    endif
+
+uint32_t oneshot_timeout_deadline(void) {
+    uint32_t remaining = DEADLINE_NONE;
+#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+    if (oneshot_mods) {
+        remaining = MIN(remaining, oneshot_remaining(oneshot_time));
+    }
+    if (get_oneshot_layer_state() && !(get_oneshot_layer_state() & ONESHOT_TOGGLED)) {
+        remaining = MIN(remaining, oneshot_remaining(oneshot_layer_time));
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (swap_hands_oneshot == SHO_ACTIVE) {
+        remaining = MIN(remaining, oneshot_remaining(oneshot_swaphands_time));
+    }
+#        endif
+#    endif
+    return remaining;
+}
+
 /** \brief Set oneshot layer
  *
  * FIXME: needs doc
@@ -187,6 +213,9 @@ void set_oneshot_layer(uint8_t layer, uint8_t state) {
         layer_on(layer);
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_layer_time = timer_read();
+#    endif
+#    ifdef ADAPTIVE_TICK_ENABLE
+        adaptive_tick_wake();
 #    endif
         oneshot_layer_changed_kb(get_oneshot_layer());
     } else {
@@ -473,6 +502,9 @@ void add_oneshot_mods(uint8_t mods) {
     if ((oneshot_mods & mods) != mods) {
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = timer_read();
+#    endif
+#    ifdef ADAPTIVE_TICK_ENABLE
+        adaptive_tick_wake();
 #    endif
         oneshot_mods |= mods;
         oneshot_mods_changed_kb(mods);
@@ -498,6 +530,9 @@ void set_oneshot_mods(uint8_t mods) {
         if (oneshot_mods != mods) {
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
             oneshot_time = timer_read();
+#    endif
+#    ifdef ADAPTIVE_TICK_ENABLE
+            adaptive_tick_wake();
 #    endif
             oneshot_mods = mods;
             oneshot_mods_changed_kb(mods);
@@ -87,6 +87,9 @@ void    set_oneshot_mods(uint8_t mods);
 void    clear_oneshot_mods(void);
 bool    has_oneshot_mods_timed_out(void);
 
+/** \brief Milliseconds until a one shot times out, DEADLINE_NONE if none is pending. */
+uint32_t oneshot_timeout_deadline(void);
+
 uint8_t get_oneshot_locked_mods(void);
 mod_t   get_oneshot_locked_mod_state(void);
 void    add_oneshot_locked_mods(uint8_t mods);
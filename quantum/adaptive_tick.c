@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "adaptive_tick.h"
+#include "action.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef AUTO_SHIFT_ENABLE
+#    include "process_auto_shift.h"
+#endif
+#ifdef CAPS_WORD_ENABLE
+#    include "caps_word.h"
+#endif
+#ifdef COMBO_ENABLE
+#    include "process_combo.h"
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+#    include "process_key_override.h"
+#endif
+#ifdef LEADER_ENABLE
+#    include "leader.h"
+#endif
+#ifdef TAP_DANCE_ENABLE
+#    include "process_tap_dance.h"
+#endif
+
+static bool     poll      = true;
+static bool     scheduled = false;
+static uint32_t deadline  = 0;
+
+void adaptive_tick_wake(void) {
+    poll = true;
+}
+
+bool adaptive_tick_due(void) {
+    return poll || (scheduled && timer_expired32(timer_read32(), deadline));
+}
+
+void adaptive_tick_task(void) {
+    if (!adaptive_tick_due()) return;
+
+    uint32_t remaining = action_tick_deadline();
+#ifdef KEY_OVERRIDE_ENABLE
+    remaining = MIN(remaining, key_override_task_deadline());
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+    remaining = MIN(remaining, deferred_timer_task_deadline());
+#else
+#    ifdef TAP_DANCE_ENABLE
+    remaining = MIN(remaining, tap_dance_task_deadline());
+#    endif
+#    ifdef COMBO_ENABLE
+    remaining = MIN(remaining, combo_task_deadline());
+#    endif
+#    ifdef LEADER_ENABLE
+    remaining = MIN(remaining, leader_task_deadline());
+#    endif
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    remaining = MIN(remaining, autoshift_matrix_scan_deadline());
+#endif
+#ifdef CAPS_WORD_ENABLE
+    remaining = MIN(remaining, caps_word_task_deadline());
+#endif
+
+    poll      = remaining == 0;
+    scheduled = remaining != DEADLINE_NONE;
+    deadline  = timer_read32() + remaining;
+}
@@ -0,0 +1,43 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file adaptive_tick.h
+ * @brief Runs the timed tasks of the main loop only when they have work to do.
+ *
+ * Tick events, and the tasks that time out combos, tap dances, leader
+ * sequences, deferred key overrides, Caps Word and Auto Shift, normally run on
+ * every loop. Each of them can tell how many milliseconds are left until it
+ * next has work to do through its `*_deadline()` function. When
+ * `ADAPTIVE_TICK_ENABLE` is set, the loop skips them until the earliest of
+ * these deadlines, or until a key event or adaptive_tick_wake() changes their
+ * state. They still run on the same millisecond as they would otherwise.
+ *
+ * Layer changes and deferred_timer_schedule() wake the loop on their own. Code
+ * that starts a timeout in any other way outside of a key event, for example
+ * from housekeeping_task_user(), has to call adaptive_tick_wake().
+ */
+
+// Deadline of a task that has nothing pending
+#define DEADLINE_NONE UINT32_MAX
+
+/**
+ * @brief Polls the timed tasks on the next loop, after changing their state
+ * outside of a key event.
+ */
+void adaptive_tick_wake(void);
+
+/**
+ * @brief Returns whether the timed tasks have to run on this loop.
+ */
+bool adaptive_tick_due(void);
+
+/**
+ * @brief Reschedules the timed tasks after they ran.
+ */
+void adaptive_tick_task(void);
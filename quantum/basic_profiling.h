@@ -19,8 +19,16 @@
         PROFILE_CALL_NAMED(1000, "matrix_task", {
             matrix_task();
         });
+
+    With PROFILER_ENABLE the calls become zones of the profiler instead, see profiler.h.
 */
 
+#if defined(PROFILER_ENABLE)
+// Hand over to the zone profiler, which keeps its own statistics
+#    include "profiler.h"
+#    define PROFILE_CALL_NAMED(count, name, call) PROFILE_ZONE(name, call)
+#else
+
 #if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
 #    define TIMESTAMP_GETTER TCNT0
 #elif defined(PROTOCOL_CHIBIOS)
@@ -64,4 +72,6 @@
 
 #endif // CONSOLE_ENABLE
 
+#endif // PROFILER_ENABLE
+
 #define PROFILE_CALL(count, call) PROFILE_CALL_NAMED(count, #call, call)
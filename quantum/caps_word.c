@@ -37,11 +37,24 @@ void caps_word_task(void) {
     }
 }
 
+uint32_t caps_word_task_deadline(void) {
+    if (!caps_word_active) {
+        return DEADLINE_NONE;
+    }
+
+    uint16_t now = timer_read();
+    return timer_expired(now, idle_timer) ? 0 : (uint16_t)(idle_timer - now);
+}
+
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
 }
 #else
 void caps_word_task(void) {}
+
+uint32_t caps_word_task_deadline(void) {
+    return DEADLINE_NONE;
+}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
 
 void caps_word_on(void) {
@@ -53,6 +66,9 @@ void caps_word_on(void) {
 #ifndef NO_ACTION_ONESHOT
     clear_oneshot_mods();
 #endif // NO_ACTION_ONESHOT
+#ifdef ADAPTIVE_TICK_ENABLE
+    adaptive_tick_wake();
+#endif
 #if CAPS_WORD_IDLE_TIMEOUT > 0
     caps_word_reset_idle_timer();
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
@@ -4,11 +4,22 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#include "compiler_support.h"
+
+#ifdef ADAPTIVE_TICK_ENABLE
+#    include "adaptive_tick.h"
+#endif
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+#ifndef DEFERRED_TIMER_WHEEL_SIZE
+#    define DEFERRED_TIMER_WHEEL_SIZE 16
+#endif
+
+STATIC_ASSERT((DEFERRED_TIMER_WHEEL_SIZE & (DEFERRED_TIMER_WHEEL_SIZE - 1)) == 0, "DEFERRED_TIMER_WHEEL_SIZE must be a power of two");
+
 //------------------------------------
 // Helpers
 //
@@ -175,3 +186,134 @@ bool cancel_deferred_exec(deferred_token token) {
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
+
+//------------------------------------
+// Timer wheel: used by core timeouts which are armed and cancelled on most key events.
+//
+// Each slot of the wheel holds the timers triggering on the milliseconds which map onto it, so expiring only needs to
+// look at one slot per elapsed millisecond. Timers further away than one revolution are skipped until they are due.
+//
+
+static deferred_timer_t *timer_wheel[DEFERRED_TIMER_WHEEL_SIZE] = {0};
+static uint32_t          timer_wheel_time                       = 0;
+static uint8_t           timer_wheel_pending                    = 0;
+
+static inline deferred_timer_t **timer_wheel_slot(uint32_t time) {
+    return &timer_wheel[time & (DEFERRED_TIMER_WHEEL_SIZE - 1)];
+}
+
+static void timer_wheel_link(deferred_timer_t *timer) {
+    deferred_timer_t **slot = timer_wheel_slot(timer->trigger_time);
+
+    timer->next  = *slot;
+    timer->pprev = slot;
+    if (*slot) {
+        (*slot)->pprev = &timer->next;
+    }
+    *slot = timer;
+    ++timer_wheel_pending;
+}
+
+static void timer_wheel_unlink(deferred_timer_t *timer) {
+    *timer->pprev = timer->next;
+    if (timer->next) {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next  = NULL;
+    timer->pprev = NULL;
+    --timer_wheel_pending;
+}
+
+bool deferred_timer_schedule(deferred_timer_t *timer, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    // Ignore scheduling if the timer isn't valid or it's a zero-time delay
+    if (!timer || delay_ms == 0 || !callback) {
+        return false;
+    }
+
+    if (deferred_timer_pending(timer)) {
+        timer_wheel_unlink(timer);
+    }
+
+    uint32_t now = timer_read32();
+    if (timer_wheel_pending == 0) {
+        // Nothing was pending, so there are no elapsed slots left to look at
+        timer_wheel_time = now;
+    }
+    timer->trigger_time = now + delay_ms;
+    timer->callback     = callback;
+    timer->cb_arg       = cb_arg;
+    timer_wheel_link(timer);
+#ifdef ADAPTIVE_TICK_ENABLE
+    // Timers armed outside of a key event or an expiring timer are otherwise only found on the next key event
+    adaptive_tick_wake();
+#endif
+    return true;
+}
+
+bool deferred_timer_cancel(deferred_timer_t *timer) {
+    if (!deferred_timer_pending(timer)) {
+        return false;
+    }
+
+    timer_wheel_unlink(timer);
+    return true;
+}
+
+bool deferred_timer_pending(const deferred_timer_t *timer) {
+    return timer && timer->pprev;
+}
+
+void deferred_timer_task(void) {
+    uint32_t now = timer_read32();
+
+    if (timer_wheel_pending == 0) {
+        timer_wheel_time = now;
+        return;
+    }
+
+    // After a long stall, one revolution is enough to look at every slot
+    if (TIMER_DIFF_32(now, timer_wheel_time) > DEFERRED_TIMER_WHEEL_SIZE) {
+        timer_wheel_time = now - DEFERRED_TIMER_WHEEL_SIZE;
+    }
+
+    while (timer_wheel_pending > 0 && timer_wheel_time != now) {
+        ++timer_wheel_time;
+
+        deferred_timer_t **slot  = timer_wheel_slot(timer_wheel_time);
+        deferred_timer_t  *timer = *slot;
+        while (timer) {
+            if (!timer_expired32(timer_wheel_time, timer->trigger_time)) {
+                timer = timer->next;
+                continue;
+            }
+
+            timer_wheel_unlink(timer);
+            uint32_t delay_ms = timer->callback(timer->trigger_time, timer->cb_arg);
+
+            // Requeue with respect to the previous trigger, unless the callback has already rescheduled the timer
+            if (delay_ms > 0 && !deferred_timer_pending(timer)) {
+                timer->trigger_time += delay_ms;
+                timer_wheel_link(timer);
+            }
+
+            // The callback may have scheduled or cancelled any timer in this slot, so start over
+            timer = *slot;
+        }
+    }
+    timer_wheel_time = now;
+}
+
+uint32_t deferred_timer_task_deadline(void) {
+    if (timer_wheel_pending == 0) {
+        return UINT32_MAX;
+    }
+
+    // The first occupied slot may hold timers for a later revolution, waking up for those early is harmless
+    uint32_t now = timer_read32();
+    for (uint32_t time = timer_wheel_time + 1; time != timer_wheel_time + 1 + DEFERRED_TIMER_WHEEL_SIZE; ++time) {
+        if (*timer_wheel_slot(time)) {
+            return timer_expired32(now, time) ? 0 : TIMER_DIFF_32(time, now);
+        }
+    }
+    return 0;
+}
@@ -119,3 +119,55 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+
+//------------------------------------
+// Timer wheel: used by core timeouts which are armed and cancelled on most key events.
+//------------------------------------
+
+/**
+ * @struct Structure for a timeout owned by the caller, which is linked into the timer wheel while it is pending.
+ * @brief Scheduling, cancelling and expiring a timer each take constant time, regardless of how many are pending.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should just zero-initialise it.
+ */
+typedef struct deferred_timer_t {
+    struct deferred_timer_t  *next;
+    struct deferred_timer_t **pprev;
+    uint32_t                  trigger_time;
+    deferred_exec_callback    callback;
+    void                     *cb_arg;
+} deferred_timer_t;
+
+/**
+ * Configures the supplied timer to invoke the callback after the required number of milliseconds, replacing any
+ * pending schedule of the same timer.
+ *
+ * @param timer[in] the timer to schedule, which must stay valid while it is pending
+ * @param delay_ms[in] the number of milliseconds before executing the callback
+ * @param callback[in] the executor to invoke
+ * @param cb_arg[in] the argument to pass to the executor, may be NULL if unused by the executor
+ * @return true if the timer was scheduled, otherwise false
+ */
+bool deferred_timer_schedule(deferred_timer_t *timer, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+
+/**
+ * Allows for cancellation of a pending timer.
+ *
+ * @param timer[in] the timer to cancel
+ * @return true if the timer was pending and is now cancelled, otherwise false
+ */
+bool deferred_timer_cancel(deferred_timer_t *timer);
+
+/**
+ * @return true if the supplied timer is waiting for its callback to be invoked
+ */
+bool deferred_timer_pending(const deferred_timer_t *timer);
+
+/**
+ * Forward declaration for the main loop in order to expire pending timers. Should not be invoked by keyboard/user code.
+ */
+void deferred_timer_task(void);
+
+/**
+ * @return the number of milliseconds until deferred_timer_task() next has a timer to expire, UINT32_MAX if none are pending
+ */
+uint32_t deferred_timer_task_deadline(void);
@@ -34,6 +34,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "eeconfig.h"
 #include "action_layer.h"
 #include "suspend.h"
+#include "profiler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -76,6 +77,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef TAP_DANCE_ENABLE
 #    include "process_tap_dance.h"
 #endif
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
 #ifdef STENO_ENABLE
 #    include "process_steno.h"
 #endif
@@ -112,6 +116,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+#    include "wear_leveling.h"
+#endif
+#ifdef NVM_CACHE_ENABLE
+#    include "nvm_cache.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -151,6 +161,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+#    include "matrix_event_queue.h"
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -572,6 +591,10 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
  * internal QMK state machine.
  */
 static inline void generate_tick_event(void) {
+#ifdef ADAPTIVE_TICK_ENABLE
+    if (!adaptive_tick_due()) return;
+#endif
+
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
@@ -583,29 +606,20 @@ static inline void generate_tick_event(void) {
 matrix_row_t matrix_previous[MATRIX_ROWS];
 
 /**
- * @brief This task scans the keyboards matrix and processes any key presses
- * that occur.
+ * @brief Compares the whole matrix against its previous state and processes
+ * every key that changed.
  *
  * @return true Matrix did change
  * @return false Matrix didn't change
  */
-static bool matrix_task(void) {
-    if (!matrix_can_read()) {
-        generate_tick_event();
-        return false;
-    }
-
-    matrix_scan();
+static bool matrix_process_changes(void) {
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
     }
 
-    matrix_scan_perf_task();
-
     // Short-circuit the complete matrix processing if it is not necessary
     if (!matrix_changed) {
-        generate_tick_event();
         return matrix_changed;
     }
 
@@ -629,6 +643,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress && !keypress_is_wakeup_key(row, col)) {
+#ifdef LATENCY_TRACE_ENABLE
+                    latency_trace_key_event(MAKE_KEYPOS(row, col), key_pressed);
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -642,6 +659,95 @@ static bool matrix_task(void) {
     return matrix_changed;
 }
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+/**
+ * @brief Processes the key changes queued by the matrix scanning code.
+ *
+ * @return true Matrix did change
+ * @return false Matrix didn't change
+ */
+static bool matrix_process_events(void) {
+    if (matrix_event_queue_take_resync()) {
+        return matrix_process_changes();
+    }
+
+    if (matrix_event_queue_is_empty()) {
+        return false;
+    }
+
+    if (debug_config.matrix) {
+        matrix_print();
+    }
+
+    const bool     process_keypress = should_process_keypress();
+    matrix_event_t event;
+
+    while (matrix_event_queue_pop(&event)) {
+        const matrix_row_t col_mask = (matrix_row_t)1 << event.col;
+
+        if (process_keypress && !keypress_is_wakeup_key(event.row, event.col)) {
+#ifdef LATENCY_TRACE_ENABLE
+            latency_trace_key_event(MAKE_KEYPOS(event.row, event.col), event.pressed);
+#endif
+            action_exec((keyevent_t){.key = MAKE_KEYPOS(event.row, event.col), .pressed = event.pressed, .time = event.time, .type = KEY_EVENT});
+        }
+
+        switch_events(event.row, event.col, event.pressed);
+
+        // Keep the previous state current, so that a resync only sees changes that were not queued
+        if (event.pressed) {
+            matrix_previous[event.row] |= col_mask;
+        } else {
+            matrix_previous[event.row] &= ~col_mask;
+        }
+    }
+
+    return true;
+}
+#endif
+
+/**
+ * @brief This task scans the keyboards matrix and processes any key presses
+ * that occur.
+ *
+ * @return true Matrix did change
+ * @return false Matrix didn't change
+ */
+static bool matrix_task(void) {
+    if (!matrix_can_read()) {
+        generate_tick_event();
+        return false;
+    }
+
+    matrix_scan();
+
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_matrix_scanned();
+#endif
+
+    matrix_scan_perf_task();
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+    // Key changes wait for a queued string, as they would behind a synchronous one
+    if (send_string_busy()) {
+        generate_tick_event();
+        return false;
+    }
+#endif
+
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    const bool matrix_changed = matrix_process_events();
+#else
+    const bool matrix_changed = matrix_process_changes();
+#endif
+
+    if (!matrix_changed) {
+        generate_tick_event();
+    }
+
+    return matrix_changed;
+}
+
 /** \brief Tasks previously located in matrix_scan_quantum
  *
  * TODO: rationalise against keyboard_task and current split role
@@ -652,6 +758,13 @@ void quantum_task(void) {
     if (!is_keyboard_master()) return;
 #endif
 
+#ifdef ADAPTIVE_TICK_ENABLE
+    // The tasks that only act on timeouts have nothing to do until then
+    __attribute__((unused)) const bool timed_tasks_due = adaptive_tick_due();
+#else
+    __attribute__((unused)) const bool timed_tasks_due = true;
+#endif
+
 #ifdef AUDIO_ENABLE
     audio_task();
 #endif
@@ -661,23 +774,39 @@ void quantum_task(void) {
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    if (timed_tasks_due) {
+        key_override_task();
+    }
 #endif
 
 #ifdef SEQUENCER_ENABLE
     sequencer_task();
 #endif
 
-#ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+#ifdef DEFERRED_EXEC_ENABLE
+    // Times out combos, tap dances and leader sequences
+    if (timed_tasks_due) {
+        deferred_timer_task();
+    }
 #endif
 
-#ifdef COMBO_ENABLE
-    combo_task();
+    // Without deferred execution, combos, tap dances and leader sequences are polled for their timeouts
+#if defined(TAP_DANCE_ENABLE) && !defined(DEFERRED_EXEC_ENABLE)
+    if (timed_tasks_due) {
+        tap_dance_task();
+    }
 #endif
 
-#ifdef LEADER_ENABLE
-    leader_task();
+#if defined(COMBO_ENABLE) && !defined(DEFERRED_EXEC_ENABLE)
+    if (timed_tasks_due) {
+        combo_task();
+    }
+#endif
+
+#if defined(LEADER_ENABLE) && !defined(DEFERRED_EXEC_ENABLE)
+    if (timed_tasks_due) {
+        leader_task();
+    }
 #endif
 
 #ifdef WPM_ENABLE
@@ -689,11 +818,15 @@ void quantum_task(void) {
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    if (timed_tasks_due) {
+        autoshift_matrix_scan();
+    }
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (timed_tasks_due) {
+        caps_word_task();
+    }
 #endif
 
 #ifdef SECURE_ENABLE
@@ -704,18 +837,20 @@ void quantum_task(void) {
     layer_lock_task();
 #endif
 
-    host_task();
+    PROFILE_ZONE("host_task", host_task());
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    PROFILE_ZONE("matrix_task", matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILE_ZONE("quantum_task", quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -729,7 +864,7 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILE_ZONE("rgb_matrix_task", rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -746,7 +881,9 @@ void keyboard_task(void) {
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    bool pointing_device_changed;
+    PROFILE_ZONE("pointing_device_task", pointing_device_changed = pointing_device_task());
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
@@ -802,4 +939,24 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef PROFILER_ENABLE
+    profiler_task();
+#endif
+
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_task();
+#endif
+
+#ifdef NVM_CACHE_ENABLE
+    nvm_cache_task();
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+    wear_leveling_task();
+#endif
+
+#ifdef ADAPTIVE_TICK_ENABLE
+    adaptive_tick_task();
+#endif
 }
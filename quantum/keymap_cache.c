@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "keymap_cache.h"
+#include "action_layer.h"
+
+#define KEYMAP_CACHE_INVALID 0xFF
+
+static uint8_t       resolved_layers[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t      resolved_keycodes[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t resolved_state;
+static bool          resolved_state_valid = false;
+
+static inline bool key_is_cacheable(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+static inline layer_state_t current_layer_state(void) {
+#ifndef NO_ACTION_LAYER
+    return layer_state | default_layer_state;
+#else
+    return default_layer_state;
+#endif
+}
+
+/**
+ * @brief Drops the entries which a change of the effective layer state since
+ * they were resolved can affect.
+ *
+ * An entry resolved to a layer stays valid unless that layer was turned off,
+ * or a layer above it was turned on. Layers above it which were turned off
+ * were transparent for the key, and layers below it were never reached.
+ *
+ * Comparing against the state the entries were resolved for, rather than
+ * hooking every layer setter, also catches direct writes to `layer_state`.
+ */
+static inline void sync_layer_state(void) {
+    const layer_state_t state = current_layer_state();
+    if (resolved_state_valid && resolved_state == state) {
+        return;
+    }
+
+    if (!resolved_state_valid) {
+        memset(resolved_layers, KEYMAP_CACHE_INVALID, sizeof(resolved_layers));
+    } else {
+        const layer_state_t turned_on   = state & ~resolved_state;
+        const layer_state_t turned_off  = resolved_state & ~state;
+        const uint8_t       lowest_kept = turned_on ? get_highest_layer(turned_on) : 0;
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                const uint8_t layer = resolved_layers[row][col];
+                if (layer != KEYMAP_CACHE_INVALID && (layer < lowest_kept || (turned_off & ((layer_state_t)1 << layer)))) {
+                    resolved_layers[row][col] = KEYMAP_CACHE_INVALID;
+                }
+            }
+        }
+    }
+
+    resolved_state       = state;
+    resolved_state_valid = true;
+}
+
+bool keymap_cache_get(keypos_t key, uint8_t *layer, uint16_t *keycode) {
+    if (!key_is_cacheable(key)) {
+        return false;
+    }
+
+    sync_layer_state();
+
+    const uint8_t cached_layer = resolved_layers[key.row][key.col];
+    if (cached_layer == KEYMAP_CACHE_INVALID) {
+        return false;
+    }
+
+    *layer = cached_layer;
+    if (keycode) {
+        *keycode = resolved_keycodes[key.row][key.col];
+    }
+    return true;
+}
+
+void keymap_cache_set(keypos_t key, uint8_t layer, uint16_t keycode) {
+    if (!key_is_cacheable(key)) {
+        return;
+    }
+
+    sync_layer_state();
+
+    resolved_layers[key.row][key.col]   = layer;
+    resolved_keycodes[key.row][key.col] = keycode;
+}
+
+void keymap_cache_invalidate(void) {
+    resolved_state_valid = false;
+}
+
+void keymap_cache_invalidate_key(uint8_t row, uint8_t col) {
+    if (row < MATRIX_ROWS && col < MATRIX_COLS) {
+        resolved_layers[row][col] = KEYMAP_CACHE_INVALID;
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "keyboard.h"
+
+/**
+ * @file keymap_cache.h
+ * @brief Cache of the resolved layer and keycode of each matrix position.
+ *
+ * When `KEYMAP_CACHE_ENABLE` is set, `layer_switch_get_layer()` remembers the
+ * layer and keycode it resolved for each key, for the current combination of
+ * `layer_state | default_layer_state`. Subsequent lookups for that key are
+ * served from RAM without walking the layer stack or reading the keymap.
+ *
+ * When the effective layer state changes, only the entries it can affect are
+ * dropped: those resolved to a layer which was turned off, or to a layer below
+ * one which was turned on. Entries are refilled lazily as keys are used. Code that changes keymap
+ * contents at runtime must call `keymap_cache_invalidate()` or
+ * `keymap_cache_invalidate_key()`.
+ */
+
+/**
+ * @brief Looks up the cached resolution of a matrix position.
+ *
+ * @param key[in] the matrix position
+ * @param layer[out] the layer the key resolves to
+ * @param keycode[out] the keycode on that layer, may be NULL
+ * @return true if the cache held a valid entry for the key
+ */
+bool keymap_cache_get(keypos_t key, uint8_t *layer, uint16_t *keycode);
+
+/**
+ * @brief Stores the resolution of a matrix position for the current layer state.
+ */
+void keymap_cache_set(keypos_t key, uint8_t layer, uint16_t keycode);
+
+/**
+ * @brief Drops the cached resolution of every matrix position.
+ */
+void keymap_cache_invalidate(void);
+
+/**
+ * @brief Drops the cached resolution of a single matrix position.
+ */
+void keymap_cache_invalidate_key(uint8_t row, uint8_t col);
@@ -41,6 +41,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "process_midi.h"
 #endif
 
+#ifdef KEYMAP_CACHE_ENABLE
+#    include "keymap_cache.h"
+#endif
+
 extern keymap_config_t keymap_config;
 
 #include <inttypes.h>
@@ -199,6 +203,13 @@ action_t action_for_keycode(uint16_t keycode) {
 // translates key to keycode
 __attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
     if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+#ifdef KEYMAP_CACHE_ENABLE
+        uint8_t  cached_layer;
+        uint16_t cached_keycode;
+        if (keymap_cache_get(key, &cached_layer, &cached_keycode) && cached_layer == layer) {
+            return cached_keycode;
+        }
+#endif
         return keycode_at_keymap_location(layer, key.row, key.col);
     }
 #ifdef ENCODER_MAP_ENABLE
@@ -16,11 +16,18 @@
 #include "compiler_support.h"
 #include "keymap_introspection.h"
 #include "util.h"
+#ifdef KEYMAP_COMPRESSED
+#    include "bitwise.h"
+#endif // KEYMAP_COMPRESSED
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Key mapping
 
-#define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(keymaps) / ((MATRIX_ROWS) * (MATRIX_COLS) * sizeof(uint16_t))))
+#ifdef KEYMAP_COMPRESSED
+#    define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(keymap_compressed_fill) / sizeof(uint16_t)))
+#else
+#    define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(keymaps) / ((MATRIX_ROWS) * (MATRIX_COLS) * sizeof(uint16_t))))
+#endif // KEYMAP_COMPRESSED
 
 uint8_t keymap_layer_count_raw(void) {
     return NUM_KEYMAP_LAYERS_RAW;
@@ -36,9 +43,37 @@ STATIC_ASSERT(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers excee
 STATIC_ASSERT(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers exceeds maximum set by LAYER_STATE_(8|16|32)BIT");
 #endif
 
+#ifdef KEYMAP_COMPRESSED
+/*
+ * Keymaps generated with `KEYMAP_COMPRESSION_ENABLE` store a single keycode filling most of each layer. A bitmask per row
+ * flags the keys which hold something else, and those keycodes are listed in matrix order from the row's offset onwards.
+ */
+static uint16_t keycode_at_compressed_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+#    if (MATRIX_COLS <= 8)
+    matrix_row_t mask   = pgm_read_byte(&keymap_compressed_masks[layer_num][row]);
+    uint8_t      before = bitpop(mask & ((MATRIX_ROW_SHIFTER << column) - 1));
+#    elif (MATRIX_COLS <= 16)
+    matrix_row_t mask   = pgm_read_word(&keymap_compressed_masks[layer_num][row]);
+    uint8_t      before = bitpop16(mask & ((MATRIX_ROW_SHIFTER << column) - 1));
+#    else
+    matrix_row_t mask   = pgm_read_dword(&keymap_compressed_masks[layer_num][row]);
+    uint8_t      before = bitpop32(mask & ((MATRIX_ROW_SHIFTER << column) - 1));
+#    endif
+
+    if (!(mask & (MATRIX_ROW_SHIFTER << column))) {
+        return pgm_read_word(&keymap_compressed_fill[layer_num]);
+    }
+    return pgm_read_word(&keymap_compressed_keycodes[pgm_read_word(&keymap_compressed_offsets[layer_num][row]) + before]);
+}
+#endif // KEYMAP_COMPRESSED
+
 uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < NUM_KEYMAP_LAYERS_RAW && row < MATRIX_ROWS && column < MATRIX_COLS) {
+#ifdef KEYMAP_COMPRESSED
+        return keycode_at_compressed_keymap_location(layer_num, row, column);
+#else
         return pgm_read_word(&keymaps[layer_num][row][column]);
+#endif // KEYMAP_COMPRESSED
     }
     return KC_TRNS;
 }
@@ -0,0 +1,212 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+#include "timer.h"
+#include "util.h"
+
+// Stamps an event has collected, the first stage is its debounce output
+#define LATENCY_TRACE_FREE 0
+#define LATENCY_TRACE_PROCESSED LATENCY_TRACE_STAGE_COUNT
+// Processed, and changed a report that is waiting to be sent
+#define LATENCY_TRACE_QUEUED (LATENCY_TRACE_STAGE_COUNT + 1)
+
+#define LATENCY_TRACE_HEADER 4
+
+typedef struct latency_trace_event_t {
+    keypos_t key;
+    bool     pressed;
+    uint8_t  stamps;
+    uint8_t  path;
+    uint8_t  ahead; // reports to be sent before the one this event changed
+    uint32_t time[LATENCY_TRACE_STAGE_COUNT];
+} latency_trace_event_t;
+
+static latency_trace_stats_t stats[LATENCY_TRACE_PATH_COUNT];
+static latency_trace_event_t events[LATENCY_TRACE_PENDING];
+static uint32_t              scan_time;
+
+static latency_trace_event_t *find_event(keypos_t key, bool pressed, uint8_t stamps) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_PENDING; i++) {
+        latency_trace_event_t *event = &events[i];
+        if (event->stamps == stamps && event->pressed == pressed && KEYEQ(event->key, key)) {
+            return event;
+        }
+    }
+    return NULL;
+}
+
+static void stamp(latency_trace_event_t *event) {
+    event->time[event->stamps++] = timer_read_us();
+}
+
+void latency_trace_matrix_scanned(void) {
+    scan_time = timer_read_us();
+}
+
+void latency_trace_key_event(keypos_t key, bool pressed) {
+    latency_trace_event_t *slot = NULL;
+    for (uint8_t i = 0; i < LATENCY_TRACE_PENDING; i++) {
+        latency_trace_event_t *event = &events[i];
+        if (event->stamps == LATENCY_TRACE_FREE || (event->pressed == pressed && KEYEQ(event->key, key))) {
+            slot = event;
+            break;
+        }
+        // Evict the oldest event if every slot is taken
+        if (!slot || scan_time - event->time[0] > scan_time - slot->time[0]) {
+            slot = event;
+        }
+    }
+
+    *slot = (latency_trace_event_t){
+        .key     = key,
+        .pressed = pressed,
+        .stamps  = 1,
+        .time    = {scan_time},
+    };
+}
+
+void latency_trace_action_exec(keyevent_t *event) {
+    if (event->type != KEY_EVENT) return;
+
+    latency_trace_event_t *traced = find_event(event->key, event->pressed, LATENCY_TRACE_ACTION_EXEC);
+    if (traced) {
+        stamp(traced);
+    }
+}
+
+void latency_trace_process_record(keyrecord_t *record) {
+    if (record->event.type == COMBO_EVENT) {
+        // The keys of the chord are replaced by a single combo event
+        for (uint8_t i = 0; i < LATENCY_TRACE_PENDING; i++) {
+            latency_trace_event_t *event = &events[i];
+            if (event->stamps == LATENCY_TRACE_PROCESS_RECORD && event->pressed == record->event.pressed) {
+                event->path = LATENCY_TRACE_COMBO;
+                stamp(event);
+            }
+        }
+        return;
+    }
+    if (record->event.type != KEY_EVENT) return;
+
+    latency_trace_event_t *event = find_event(record->event.key, record->event.pressed, LATENCY_TRACE_PROCESS_RECORD);
+    if (event) {
+        event->path = is_tap_record(record) ? LATENCY_TRACE_TAP_HOLD : LATENCY_TRACE_PLAIN;
+        stamp(event);
+    }
+}
+
+void latency_trace_report_queued(uint8_t ahead) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_PENDING; i++) {
+        latency_trace_event_t *event = &events[i];
+        if (event->stamps == LATENCY_TRACE_PROCESSED) {
+            event->stamps = LATENCY_TRACE_QUEUED;
+            event->ahead  = ahead;
+        }
+    }
+}
+
+void latency_trace_report(void) {
+    uint32_t now = timer_read_us();
+
+    for (uint8_t i = 0; i < LATENCY_TRACE_PENDING; i++) {
+        latency_trace_event_t *event = &events[i];
+        if (event->stamps != LATENCY_TRACE_QUEUED) continue;
+        if (event->ahead) {
+            event->ahead--;
+            continue;
+        }
+
+        latency_trace_stats_t *path    = &stats[event->path];
+        uint32_t               latency = now - event->time[0];
+        for (uint8_t stage = 0; stage < LATENCY_TRACE_STAGE_COUNT; stage++) {
+            uint32_t end = stage + 1 < LATENCY_TRACE_STAGE_COUNT ? event->time[stage + 1] : now;
+            path->stage_total[stage] += end - event->time[stage];
+        }
+        path->min = path->count ? MIN(path->min, latency) : latency;
+        path->max = MAX(path->max, latency);
+        path->count++;
+
+        uint8_t bucket = 0;
+        for (uint32_t remaining = latency; remaining && bucket < LATENCY_TRACE_BUCKETS - 1; remaining >>= 1) {
+            bucket++;
+        }
+        if (path->histogram[bucket] < UINT16_MAX) {
+            path->histogram[bucket]++;
+        }
+
+        event->stamps = LATENCY_TRACE_FREE;
+    }
+}
+
+void latency_trace_task(void) {
+    uint32_t now = timer_read_us();
+
+    for (uint8_t i = 0; i < LATENCY_TRACE_PENDING; i++) {
+        latency_trace_event_t *event = &events[i];
+        if (event->stamps == LATENCY_TRACE_PROCESSED || (event->stamps != LATENCY_TRACE_FREE && now - event->time[0] > LATENCY_TRACE_TIMEOUT * 1000UL)) {
+            event->stamps = LATENCY_TRACE_FREE;
+        }
+    }
+}
+
+void latency_trace_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    memset(events, 0, sizeof(events));
+}
+
+const latency_trace_stats_t *latency_trace_get_stats(latency_trace_path_t path) {
+    return path < LATENCY_TRACE_PATH_COUNT ? &stats[path] : NULL;
+}
+
+static uint8_t *put_u32(uint8_t *out, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++, value >>= 8) {
+        *out++ = value;
+    }
+    return out;
+}
+
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length <= LATENCY_TRACE_HEADER || data[0] != LATENCY_TRACE_RAW_HID_ID) {
+        return false;
+    }
+
+    const latency_trace_stats_t *path = latency_trace_get_stats(data[2]);
+    uint8_t                     *out  = &data[LATENCY_TRACE_HEADER];
+    uint8_t                     *end  = &data[length];
+    memset(out, 0, end - out);
+
+    if (!path) {
+        data[1] = 0xFF;
+        return true;
+    }
+
+    switch (data[1]) {
+        case LATENCY_TRACE_GET_SUMMARY:
+            out  = put_u32(out, path->count);
+            out  = put_u32(out, path->min);
+            out  = put_u32(out, path->max);
+            *out = LATENCY_TRACE_BUCKETS;
+            break;
+        case LATENCY_TRACE_GET_STAGES:
+            for (uint8_t stage = 0; stage < LATENCY_TRACE_STAGE_COUNT && end - out >= 8; stage++) {
+                out = put_u32(out, path->stage_total[stage]);
+                out = put_u32(out, path->stage_total[stage] >> 32);
+            }
+            break;
+        case LATENCY_TRACE_GET_HISTOGRAM:
+            for (uint8_t bucket = data[3]; bucket < LATENCY_TRACE_BUCKETS && end - out >= 2; bucket++) {
+                *out++ = path->histogram[bucket];
+                *out++ = path->histogram[bucket] >> 8;
+            }
+            break;
+        case LATENCY_TRACE_RESET:
+            latency_trace_reset();
+            break;
+        default:
+            data[1] = 0xFF;
+            break;
+    }
+    return true;
+}
@@ -0,0 +1,124 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "action.h"
+
+/**
+ * @file latency_trace.h
+ * @brief Key to report latency tracing.
+ *
+ * When `LATENCY_TRACE_ENABLE` is set, every key event is timestamped as it
+ * leaves the debounced matrix scan, when it enters `action_exec()`, when it
+ * reaches `process_record()`, and when the keyboard report it causes is handed
+ * to the host driver. Completed events are added to a histogram for the path
+ * they took, so the latency of plain keys can be told apart from tap-hold keys,
+ * which wait on the tapping decision, and from combos, which wait on the other
+ * keys of the chord. Events that do not change the report are not counted.
+ *
+ * The statistics can be read over raw HID, see latency_trace_raw_hid_receive().
+ */
+
+#ifndef LATENCY_TRACE_BUCKETS
+#    define LATENCY_TRACE_BUCKETS 20
+#endif
+
+// Number of key events that can wait on their report at the same time
+#ifndef LATENCY_TRACE_PENDING
+#    define LATENCY_TRACE_PENDING 8
+#endif
+
+// Milliseconds after which an event whose report has not been sent is dropped
+#ifndef LATENCY_TRACE_TIMEOUT
+#    define LATENCY_TRACE_TIMEOUT 1000
+#endif
+
+// First byte of the raw HID commands handled by latency_trace_raw_hid_receive()
+#ifndef LATENCY_TRACE_RAW_HID_ID
+#    define LATENCY_TRACE_RAW_HID_ID 0xFA
+#endif
+
+typedef enum latency_trace_path_t {
+    LATENCY_TRACE_PLAIN,
+    LATENCY_TRACE_TAP_HOLD,
+    LATENCY_TRACE_COMBO,
+    LATENCY_TRACE_PATH_COUNT,
+} latency_trace_path_t;
+
+typedef enum latency_trace_stage_t {
+    LATENCY_TRACE_DEBOUNCE,       // debounce output to action_exec()
+    LATENCY_TRACE_ACTION_EXEC,    // action_exec() to process_record()
+    LATENCY_TRACE_PROCESS_RECORD, // process_record() to the report reaching the host driver
+    LATENCY_TRACE_STAGE_COUNT,
+} latency_trace_stage_t;
+
+typedef enum latency_trace_command_t {
+    LATENCY_TRACE_GET_SUMMARY   = 0x01,
+    LATENCY_TRACE_GET_STAGES    = 0x02,
+    LATENCY_TRACE_GET_HISTOGRAM = 0x03,
+    LATENCY_TRACE_RESET         = 0x04,
+} latency_trace_command_t;
+
+typedef struct latency_trace_stats_t {
+    uint32_t count;
+    uint32_t min; // microseconds
+    uint32_t max;
+    uint64_t stage_total[LATENCY_TRACE_STAGE_COUNT];
+    uint16_t histogram[LATENCY_TRACE_BUCKETS]; // bucket n counts latencies of n bits in microseconds, the last one also everything longer
+} latency_trace_stats_t;
+
+/**
+ * @brief Timestamps the end of a matrix scan, the debounce output of the key
+ * events it produces.
+ */
+void latency_trace_matrix_scanned(void);
+
+/**
+ * @brief Starts tracing a key event from the last matrix scan.
+ */
+void latency_trace_key_event(keypos_t key, bool pressed);
+
+void latency_trace_action_exec(keyevent_t *event);
+void latency_trace_process_record(keyrecord_t *record);
+
+/**
+ * @brief Marks the traced events processed since the last call as waiting on
+ * the report just handed to host_keyboard_send(), which is sent after `ahead`
+ * other reports held back by the report scheduler.
+ */
+void latency_trace_report_queued(uint8_t ahead);
+
+/**
+ * @brief Completes the traced events waiting on the report that just reached
+ * the host driver.
+ */
+void latency_trace_report(void);
+
+/**
+ * @brief Drops the traced events that were processed without changing the
+ * report, and those whose report never went out.
+ */
+void latency_trace_task(void);
+
+void latency_trace_reset(void);
+
+const latency_trace_stats_t *latency_trace_get_stats(latency_trace_path_t path);
+
+/**
+ * @brief Handles a latency trace command, replying in place.
+ *
+ * Commands are LATENCY_TRACE_RAW_HID_ID, a latency_trace_command_t, a path
+ * and, for histograms, the first bucket. The reply repeats those four bytes,
+ * or 0xFF as the command when it is not valid, followed by little endian
+ * values:
+ *
+ *     summary    u32 count, u32 min, u32 max, u8 bucket count
+ *     stages     u64 total microseconds of each latency_trace_stage_t
+ *     histogram  u16 counts of up to 14 buckets
+ *
+ * @return true if the report was a latency trace command
+ */
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length);
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
+#include "adaptive_tick.h"
+#include "deferred_exec.h"
 #include "timer.h"
 #include "util.h"
 
@@ -17,6 +19,30 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef DEFERRED_EXEC_ENABLE
+static deferred_timer_t leader_timer;
+
+static uint32_t leader_timeout_callback(uint32_t trigger_time, void *cb_arg);
+
+// Counts from leader_time, which may have moved on since the timer was last scheduled
+static void leader_schedule_timeout(void) {
+    uint16_t elapsed = timer_elapsed(leader_time);
+    deferred_timer_schedule(&leader_timer, elapsed > LEADER_TIMEOUT ? 1 : LEADER_TIMEOUT + 1 - elapsed, leader_timeout_callback, NULL);
+}
+
+static uint32_t leader_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    if (!leader_sequence_active()) {
+        return 0;
+    }
+    if (leader_sequence_timed_out()) {
+        leader_end();
+    } else {
+        leader_schedule_timeout();
+    }
+    return 0;
+}
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -30,13 +56,22 @@ void leader_start(void) {
         return;
     }
     leader_start_user();
+#ifdef ADAPTIVE_TICK_ENABLE
+    adaptive_tick_wake();
+#endif
     leading              = true;
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#if defined(DEFERRED_EXEC_ENABLE) && !defined(LEADER_NO_TIMEOUT)
+    leader_schedule_timeout();
+#endif
 }
 
 void leader_end(void) {
+#ifdef DEFERRED_EXEC_ENABLE
+    deferred_timer_cancel(&leader_timer);
+#endif
     leading = false;
     leader_end_user();
 }
@@ -47,6 +82,19 @@ void leader_task(void) {
     }
 }
 
+uint32_t leader_task_deadline(void) {
+#if defined(LEADER_NO_TIMEOUT)
+    if (!leading || leader_sequence_size == 0) {
+#else
+    if (!leading) {
+#endif
+        return DEADLINE_NONE;
+    }
+
+    uint16_t elapsed = timer_elapsed(leader_time);
+    return elapsed > LEADER_TIMEOUT ? 0 : LEADER_TIMEOUT - elapsed + 1;
+}
+
 bool leader_sequence_active(void) {
     return leading;
 }
@@ -81,6 +129,11 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+#ifdef DEFERRED_EXEC_ENABLE
+    if (leading) {
+        leader_schedule_timeout();
+    }
+#endif
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -42,6 +42,12 @@ void leader_end(void);
 
 void leader_task(void);
 
+/**
+ * Milliseconds until leader_task() times out the sequence, DEADLINE_NONE if
+ * there is none.
+ */
+uint32_t leader_task_deadline(void);
+
 /**
  * Whether the leader sequence is active.
  */
@@ -0,0 +1,21 @@
+#pragma once
+
+typedef uint8_t (*angle_f)(uint8_t val, uint8_t angle, uint8_t time);
+
+bool effect_runner_angle(effect_params_t* params, angle_f effect_func) {
+    LED_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t time = scale16by8(g_led_timer, led_matrix_eeconfig.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        LED_MATRIX_TEST_LED_FLAGS();
+#ifdef LED_MATRIX_GEOMETRY_TABLE
+        uint8_t angle = pgm_read_byte(&g_led_geometry[i].angle);
+#else
+        int16_t dx    = g_led_config.point[i].x - k_led_matrix_center.x;
+        int16_t dy    = g_led_config.point[i].y - k_led_matrix_center.y;
+        uint8_t angle = atan2_8(dy, dx);
+#endif
+        led_matrix_set_value(i, effect_func(led_matrix_eeconfig.val, angle, time));
+    }
+    return led_matrix_check_finished_leds(led_max);
+}
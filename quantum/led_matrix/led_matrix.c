@@ -95,6 +95,15 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_led_matrix_split[2] = LED_MATRIX_SPLIT;
 #endif
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+// render scheduler: the LEDs rendered by the current iteration, and the
+// measured cost of rendering one LED with the current effect, in 1/16 us
+static uint8_t  led_render_led_min    = 0;
+static uint8_t  led_render_led_max    = 0;
+static uint16_t led_render_cost       = 0;
+static uint8_t  led_render_last_iters = 0;
+#endif
+
 EECONFIG_DEBOUNCE_HELPER(led_matrix, led_matrix_eeconfig);
 
 void eeconfig_force_flush_led_matrix(void) {
@@ -283,6 +292,49 @@ static void led_task_start(void) {
     led_task_state = RENDERING;
 }
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+static void led_render_schedule(void) {
+    uint8_t first = 0;
+    uint8_t last  = LED_MATRIX_LED_COUNT;
+#    if defined(LED_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        last = k_led_matrix_split[0];
+    } else {
+        first = k_led_matrix_split[0];
+    }
+#    endif
+
+    if (led_effect_params.iter == 0) {
+        led_render_led_min = first;
+        if (led_effect_params.init) {
+            // start over with a conservative chunk size for a new effect
+            led_render_cost = 0;
+        }
+    } else {
+        led_render_led_min = led_render_led_max;
+    }
+
+    uint8_t count = last > led_render_led_min ? last - led_render_led_min : 0;
+    if (led_render_cost == 0) {
+        if (count > LED_MATRIX_LED_PROCESS_LIMIT) count = LED_MATRIX_LED_PROCESS_LIMIT;
+    } else {
+        uint32_t affordable = (uint32_t)LED_MATRIX_RENDER_BUDGET_US * 16 / led_render_cost;
+        if (affordable < count) count = affordable > 0 ? affordable : 1;
+    }
+    led_render_led_max = led_render_led_min + count;
+}
+
+static void led_render_measure(uint32_t elapsed_us) {
+    uint8_t count = led_render_led_max - led_render_led_min;
+    if (count == 0) return;
+
+    // keep a running average, never reporting a cost of zero once measured
+    uint32_t sample = MIN(elapsed_us, UINT16_MAX) * 16 / count;
+    sample          = MAX(MIN(sample, UINT16_MAX), 1);
+    led_render_cost = led_render_cost ? (3 * (uint32_t)led_render_cost + sample) / 4 : sample;
+}
+#endif
+
 static void led_task_render(uint8_t effect) {
     bool rendering         = false;
     led_effect_params.init = (effect != led_last_effect) || (led_matrix_eeconfig.enable != led_last_enable);
@@ -291,6 +343,11 @@ static void led_task_render(uint8_t effect) {
         led_matrix_set_value_all(0);
     }
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+    led_render_schedule();
+    uint32_t render_start = timer_read_us();
+#endif
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -333,10 +390,20 @@ static void led_task_render(uint8_t effect) {
             // ---------------------------------------------
     }
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+    led_render_measure(timer_elapsed_us(render_start));
+#endif
+
     led_effect_params.iter++;
 
     // next task
     if (!rendering) {
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+        if (led_effect_params.iter != led_render_last_iters) {
+            led_render_last_iters = led_effect_params.iter;
+            dprintf("led matrix: effect %u renders in %u iterations, %lu ns per LED\n", effect, led_effect_params.iter, (unsigned long)led_render_cost * 1000 / 16);
+        }
+#endif
         led_task_state = FLUSHING;
         if (!led_effect_params.init && effect == LED_MATRIX_NONE) {
             // We only need to flush once if we are LED_MATRIX_NONE
@@ -426,7 +493,12 @@ __attribute__((weak)) bool led_matrix_indicators_advanced_user(uint8_t led_min,
 
 struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter) {
     struct led_matrix_limits_t limits = {0};
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_LED_COUNT
+#if defined(LED_MATRIX_RENDER_BUDGET_US)
+    // the scheduler has already sized the chunk for the current iteration
+    (void)iter;
+    limits.led_min_index = led_render_led_min;
+    limits.led_max_index = led_render_led_max;
+#elif defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_LED_COUNT
 #    if defined(LED_MATRIX_SPLIT)
     limits.led_min_index = LED_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + LED_MATRIX_LED_PROCESS_LIMIT;
@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "progmem.h"
 #include "led_matrix_types.h"
 #include "led_matrix_drivers.h"
 #include "keyboard.h"
@@ -211,6 +212,13 @@ extern led_config_t g_led_config;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
+#ifdef LED_MATRIX_GEOMETRY_TABLE
+// Generated from the LED layout in info.json, instead of being worked out on every frame
+extern const led_geometry_t PROGMEM g_led_geometry[LED_MATRIX_LED_COUNT];
+#    ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+extern const uint8_t PROGMEM g_led_distance[LED_MATRIX_LED_COUNT][LED_MATRIX_LED_COUNT];
+#    endif
+#endif
 #ifdef LED_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
@@ -73,6 +73,11 @@ typedef struct PACKED {
     uint8_t     flags[LED_MATRIX_LED_COUNT];
 } led_config_t;
 
+typedef struct PACKED {
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy) from the center
+    uint8_t angle; // atan2_8(dy, dx) around the center
+} led_geometry_t;
+
 typedef union led_eeconfig_t {
     uint32_t raw;
     struct PACKED {
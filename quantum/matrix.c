@@ -22,6 +22,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debounce.h"
 #include "atomic_util.h"
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+#    include "matrix_event_queue.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -333,6 +337,17 @@ uint8_t matrix_scan(void) {
 #endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    for (uint8_t row = 0; changed && row < MATRIX_ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] != curr_matrix[row]) {
+#    ifdef SPLIT_KEYBOARD
+            matrix_event_queue_mark_row(thisHand + row, curr_matrix[row]);
+#    else
+            matrix_event_queue_mark_row(row, curr_matrix[row]);
+#    endif
+        }
+    }
+#endif
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
 #ifdef SPLIT_KEYBOARD
@@ -341,5 +356,9 @@ uint8_t matrix_scan(void) {
     changed = debounce(raw_matrix, matrix, changed);
     matrix_scan_kb();
 #endif
+
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    matrix_event_queue_sync();
+#endif
     return (uint8_t)changed;
 }
@@ -4,6 +4,10 @@
 #include "print.h"
 #include "debug.h"
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+#    include "matrix_event_queue.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -105,6 +109,13 @@ bool matrix_post_scan(void) {
             last_connected = false;
         }
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+        for (uint8_t row = 0; changed && row < MATRIX_ROWS_PER_HAND; row++) {
+            if (matrix[thatHand + row] != slave_matrix[row]) {
+                matrix_event_queue_mark_row(thatHand + row, slave_matrix[row]);
+            }
+        }
+#endif
         if (changed) memcpy(matrix + thatHand, slave_matrix, sizeof(slave_matrix));
 
         matrix_scan_kb();
@@ -164,6 +175,17 @@ __attribute__((weak)) void matrix_init(void) {
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    // matrix_scan_custom() does not say which rows changed, so mark them all; unchanged rows settle on the next sync
+    for (uint8_t row = 0; changed && row < MATRIX_ROWS_PER_HAND; row++) {
+#    ifdef SPLIT_KEYBOARD
+        matrix_event_queue_mark_row(thisHand + row, raw_matrix[row]);
+#    else
+        matrix_event_queue_mark_row(row, raw_matrix[row]);
+#    endif
+    }
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, changed) | matrix_post_scan();
 #else
@@ -171,6 +193,10 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     matrix_scan_kb();
 #endif
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    matrix_event_queue_sync();
+#endif
+
     return changed;
 }
 
@@ -0,0 +1,122 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_event_queue.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef MATRIX_HAS_GHOST
+#    error "MATRIX_EVENT_QUEUE_ENABLE is not compatible with MATRIX_HAS_GHOST"
+#endif
+
+#define MATRIX_EVENT_QUEUE_MASK (MATRIX_EVENT_QUEUE_SIZE - 1)
+
+// Free-running indices; only the producer writes `head` and only the consumer
+// writes `tail`, so no critical section is needed on single-byte accesses.
+static volatile matrix_event_t events[MATRIX_EVENT_QUEUE_SIZE];
+static volatile uint8_t        head          = 0;
+static volatile uint8_t        tail          = 0;
+static volatile bool           resync_needed = false;
+static bool                    synced        = false;
+
+static matrix_row_t synced_matrix[MATRIX_ROWS];
+
+// Rows which may still change, and the raw state each one settles on once debounced
+static uint32_t     pending_rows[(MATRIX_ROWS + 31) / 32];
+static matrix_row_t pending_target[MATRIX_ROWS];
+
+#ifdef MATRIX_MASKED
+extern const matrix_row_t matrix_mask[];
+#endif
+
+void matrix_event_queue_push(uint8_t row, uint8_t col, bool pressed) {
+    uint8_t current_head = head;
+    if ((uint8_t)(current_head - tail) >= MATRIX_EVENT_QUEUE_SIZE) {
+        resync_needed = true;
+        return;
+    }
+
+    volatile matrix_event_t *event = &events[current_head & MATRIX_EVENT_QUEUE_MASK];
+    event->row                     = row;
+    event->col                     = col;
+    event->pressed                 = pressed;
+    event->time                    = timer_read();
+
+    head = current_head + 1;
+}
+
+void matrix_event_queue_mark_row(uint8_t row, matrix_row_t raw_row) {
+#ifdef MATRIX_MASKED
+    raw_row &= matrix_mask[row];
+#endif
+    pending_target[row] = raw_row;
+    pending_rows[row / 32] |= (uint32_t)1 << (row % 32);
+}
+
+void matrix_event_queue_sync(void) {
+    synced = true;
+
+    for (uint8_t word = 0; word < ARRAY_SIZE(pending_rows); word++) {
+        uint32_t rows = pending_rows[word];
+
+        while (rows) {
+            const uint8_t      row         = word * 32 + __builtin_ctz(rows);
+            const matrix_row_t current_row = matrix_get_row(row);
+            matrix_row_t       row_changes = current_row ^ synced_matrix[row];
+
+            // Only visit the columns that actually changed, lowest column first
+            while (row_changes) {
+                const uint8_t      col      = __builtin_ctz(row_changes);
+                const matrix_row_t col_mask = (matrix_row_t)1 << col;
+
+                matrix_event_queue_push(row, col, current_row & col_mask);
+                row_changes &= ~col_mask;
+            }
+
+            synced_matrix[row] = current_row;
+
+            // Once debounced, the row cannot change again until its raw state does
+            if (current_row == pending_target[row]) {
+                pending_rows[word] &= ~((uint32_t)1 << (row % 32));
+            }
+            rows &= rows - 1;
+        }
+    }
+}
+
+bool matrix_event_queue_pop(matrix_event_t *event) {
+    uint8_t current_tail = tail;
+    if (current_tail == head) {
+        return false;
+    }
+
+    volatile matrix_event_t *queued = &events[current_tail & MATRIX_EVENT_QUEUE_MASK];
+    event->row                      = queued->row;
+    event->col                      = queued->col;
+    event->pressed                  = queued->pressed;
+    event->time                     = queued->time;
+
+    tail = current_tail + 1;
+    return true;
+}
+
+bool matrix_event_queue_is_empty(void) {
+    return tail == head;
+}
+
+void matrix_event_queue_invalidate(void) {
+    resync_needed = true;
+}
+
+bool matrix_event_queue_take_resync(void) {
+    // A matrix_scan() which did not sync is not reporting to the queue, so only a full comparison finds its changes
+    if (synced && !resync_needed) {
+        synced = false;
+        return false;
+    }
+
+    synced        = false;
+    resync_needed = false;
+    tail          = head;
+    return true;
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "matrix.h"
+
+/**
+ * @file matrix_event_queue.h
+ * @brief Queue of debounced matrix changes consumed by `matrix_task()`.
+ *
+ * When `MATRIX_EVENT_QUEUE_ENABLE` is set, the matrix scanning code records
+ * every debounced key change into a single-producer/single-consumer ring
+ * buffer. `matrix_task()` then only drains that ring, instead of comparing
+ * every matrix row against the previous state on every scan. Only the rows
+ * whose raw state changed are compared, until their debounced state settles.
+ *
+ * If the ring overflows, the queued events are invalidated, or a scan did
+ * not call `matrix_event_queue_sync()`, the next `matrix_task()` falls back to
+ * a full matrix comparison to resynchronise.
+ */
+
+#ifndef MATRIX_EVENT_QUEUE_SIZE
+#    define MATRIX_EVENT_QUEUE_SIZE 32
+#endif
+
+#if (MATRIX_EVENT_QUEUE_SIZE & (MATRIX_EVENT_QUEUE_SIZE - 1)) != 0 || MATRIX_EVENT_QUEUE_SIZE > 128
+#    error "MATRIX_EVENT_QUEUE_SIZE must be a power of two no larger than 128"
+#endif
+
+/**
+ * @brief A single debounced key change.
+ */
+typedef struct {
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+    uint16_t time;
+} matrix_event_t;
+
+/**
+ * @brief Records a debounced key change.
+ *
+ * If the queue is full, the event is dropped and a resync is requested.
+ */
+void matrix_event_queue_push(uint8_t row, uint8_t col, bool pressed);
+
+/**
+ * @brief Marks a row whose raw state changed, so that its debounced state is
+ * compared by `matrix_event_queue_sync()` until it matches `raw_row`.
+ *
+ * @param row the matrix row
+ * @param raw_row the new raw state of the row
+ */
+void matrix_event_queue_mark_row(uint8_t row, matrix_row_t raw_row);
+
+/**
+ * @brief Records the changes between the last synchronised matrix state and
+ * the current result of `matrix_get_row()`, for every marked row.
+ *
+ * Matrix implementations call this at the end of every `matrix_scan()`. If a
+ * scan does not, `matrix_task()` compares every row instead.
+ */
+void matrix_event_queue_sync(void);
+
+/**
+ * @brief Retrieves the oldest queued event.
+ *
+ * @param event[out] the dequeued event
+ * @return true if an event was dequeued
+ */
+bool matrix_event_queue_pop(matrix_event_t *event);
+
+/**
+ * @brief Returns true if no events are queued.
+ */
+bool matrix_event_queue_is_empty(void);
+
+/**
+ * @brief Discards all queued events and requests a full matrix resync.
+ *
+ * Used when the matrix state has been reconciled outside of the queue, for
+ * example after waking from suspend.
+ */
+void matrix_event_queue_invalidate(void);
+
+/**
+ * @brief Checks whether a full matrix resync is required, because the queue
+ * overflowed, was invalidated, or was not synced since the last call,
+ * discarding any queued events if so.
+ *
+ * @return true if the caller must compare the whole matrix against its
+ * previous state
+ */
+bool matrix_event_queue_take_resync(void);
@@ -0,0 +1,158 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+#include "compiler_support.h"
+#include "eeprom.h"
+#include "timer.h"
+#include "util.h"
+#include "nvm_cache.h"
+#include "nvm_eeprom_cache_internal.h"
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "nvm_eeprom_dynamic_keymap_internal.h"
+#endif
+
+// By default, cover VIA's configuration, the keymaps and the encoder maps -- everything read while typing
+#ifndef NVM_CACHE_START
+#    if defined(VIA_ENABLE)
+#        define NVM_CACHE_START (VIA_EEPROM_MAGIC_ADDR)
+#    elif defined(DYNAMIC_KEYMAP_ENABLE)
+#        define NVM_CACHE_START (DYNAMIC_KEYMAP_EEPROM_ADDR)
+#    else
+#        error NVM_CACHE_START has not been defined, and there is no dynamic keymap to cache.
+#    endif
+#endif
+
+#ifndef NVM_CACHE_SIZE
+#    define NVM_CACHE_SIZE ((DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) - (NVM_CACHE_START))
+#endif
+
+#define NVM_CACHE_PAGE_COUNT (((NVM_CACHE_SIZE) + (NVM_CACHE_PAGE_SIZE) - 1) / (NVM_CACHE_PAGE_SIZE))
+
+STATIC_ASSERT((NVM_CACHE_SIZE) > 0, "NVM cache must cover at least one byte");
+STATIC_ASSERT((NVM_CACHE_START) + (NVM_CACHE_SIZE) <= (TOTAL_EEPROM_BYTE_COUNT), "NVM cache is configured to cover more than the available EEPROM");
+
+static uint8_t  nvm_cache[NVM_CACHE_SIZE];
+static uint8_t  nvm_cache_dirty_pages[((NVM_CACHE_PAGE_COUNT) + 7) / 8];
+static bool     nvm_cache_loaded = false;
+static bool     nvm_cache_dirty  = false;
+static uint32_t nvm_cache_last_write;
+
+static bool nvm_cache_overlaps(uintptr_t address, size_t length) {
+    return address < (NVM_CACHE_START) + (NVM_CACHE_SIZE) && address + length > (NVM_CACHE_START);
+}
+
+static bool nvm_cache_contains(uintptr_t address, size_t length) {
+    return address >= (NVM_CACHE_START) && address + length <= (NVM_CACHE_START) + (NVM_CACHE_SIZE);
+}
+
+static void nvm_cache_load(void) {
+    if (!nvm_cache_loaded) {
+        eeprom_read_block(nvm_cache, (const void *)(uintptr_t)(NVM_CACHE_START), NVM_CACHE_SIZE);
+        nvm_cache_loaded = true;
+    }
+}
+
+/**
+ * Commits a single page to the EEPROM, only writing the span of bytes which actually changed.
+ */
+static void nvm_cache_flush_page(uint16_t page) {
+    const uint32_t offset = (uint32_t)page * (NVM_CACHE_PAGE_SIZE);
+    const uint32_t length = MIN((uint32_t)(NVM_CACHE_PAGE_SIZE), (uint32_t)(NVM_CACHE_SIZE) - offset);
+    uint8_t        stored[NVM_CACHE_PAGE_SIZE];
+    eeprom_read_block(stored, (const void *)(uintptr_t)(NVM_CACHE_START + offset), length);
+
+    uint32_t first = 0;
+    uint32_t last  = length;
+    while (first < length && stored[first] == nvm_cache[offset + first]) {
+        ++first;
+    }
+    while (last > first && stored[last - 1] == nvm_cache[offset + last - 1]) {
+        --last;
+    }
+    if (first < last) {
+        eeprom_write_block(&nvm_cache[offset + first], (void *)(uintptr_t)(NVM_CACHE_START + offset + first), last - first);
+    }
+
+    nvm_cache_dirty_pages[page / 8] &= ~(1 << (page % 8));
+}
+
+/**
+ * Commits the first dirty page to the EEPROM.
+ *
+ * @return false if there were no dirty pages left
+ */
+static bool nvm_cache_flush_next(void) {
+    for (uint16_t page = 0; page < (NVM_CACHE_PAGE_COUNT); ++page) {
+        if (nvm_cache_dirty_pages[page / 8] & (1 << (page % 8))) {
+            nvm_cache_flush_page(page);
+            return true;
+        }
+    }
+    nvm_cache_dirty = false;
+    return false;
+}
+
+void nvm_eeprom_cache_read_block(void *buf, const void *addr, size_t len) {
+    const uintptr_t address = (uintptr_t)addr;
+    if (nvm_cache_contains(address, len)) {
+        nvm_cache_load();
+        memcpy(buf, &nvm_cache[address - (NVM_CACHE_START)], len);
+        return;
+    }
+
+    // Reads straddling the edge of the cache bypass it, so anything pending in the overlap needs to be committed first
+    if (nvm_cache_overlaps(address, len)) {
+        nvm_cache_flush();
+    }
+    eeprom_read_block(buf, addr, len);
+}
+
+void nvm_eeprom_cache_update_block(const void *buf, void *addr, size_t len) {
+    const uintptr_t address = (uintptr_t)addr;
+    if (!nvm_cache_contains(address, len)) {
+        if (nvm_cache_overlaps(address, len)) {
+            // Writes straddling the edge of the cache bypass it, reload once it's next needed
+            nvm_cache_flush();
+            nvm_cache_loaded = false;
+        }
+        eeprom_update_block(buf, addr, len);
+        return;
+    }
+
+    nvm_cache_load();
+    const uint32_t offset = address - (NVM_CACHE_START);
+    if (memcmp(&nvm_cache[offset], buf, len) == 0) {
+        return;
+    }
+    memcpy(&nvm_cache[offset], buf, len);
+
+    for (uint32_t page = offset / (NVM_CACHE_PAGE_SIZE); page <= (offset + len - 1) / (NVM_CACHE_PAGE_SIZE); ++page) {
+        nvm_cache_dirty_pages[page / 8] |= 1 << (page % 8);
+    }
+    nvm_cache_dirty      = true;
+    nvm_cache_last_write = timer_read32();
+}
+
+void nvm_eeprom_cache_invalidate(void) {
+    // Pending writes are dropped along with the cached data, the EEPROM has been changed underneath the cache
+    memset(nvm_cache_dirty_pages, 0, sizeof(nvm_cache_dirty_pages));
+    nvm_cache_dirty  = false;
+    nvm_cache_loaded = false;
+}
+
+void nvm_cache_task(void) {
+    // One page per invocation, so that committing a whole keymap does not stall the keyboard
+    if (nvm_cache_dirty && timer_elapsed32(nvm_cache_last_write) >= (NVM_CACHE_FLUSH_DELAY)) {
+        nvm_cache_flush_next();
+    }
+}
+
+void nvm_cache_flush(void) {
+    while (nvm_cache_dirty && nvm_cache_flush_next()) {
+    }
+}
+
+bool nvm_cache_is_dirty(void) {
+    return nvm_cache_dirty;
+}
@@ -8,6 +8,7 @@
 #include "debug.h"
 #include "eeprom.h"
 #include "keycode_config.h"
+#include "nvm_eeprom_cache_internal.h"
 
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
@@ -49,6 +50,7 @@ void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
 #endif // EEPROM_DRIVER
+    nvm_eeprom_cache_invalidate();
 }
 
 bool nvm_eeconfig_is_enabled(void) {
@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "eeprom.h"
+
+// EEPROM accessors used by the NVM repositories which may be served by the RAM write-back cache.
+// Without NVM_CACHE_ENABLE, these go straight to the EEPROM API.
+
+#ifdef NVM_CACHE_ENABLE
+
+void nvm_eeprom_cache_read_block(void *buf, const void *addr, size_t len);
+void nvm_eeprom_cache_update_block(const void *buf, void *addr, size_t len);
+void nvm_eeprom_cache_invalidate(void);
+
+static inline uint8_t nvm_eeprom_cache_read_byte(const void *addr) {
+    uint8_t value;
+    nvm_eeprom_cache_read_block(&value, addr, 1);
+    return value;
+}
+
+static inline void nvm_eeprom_cache_update_byte(void *addr, uint8_t value) {
+    nvm_eeprom_cache_update_block(&value, addr, 1);
+}
+
+#else // NVM_CACHE_ENABLE
+
+static inline void nvm_eeprom_cache_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_read_block(buf, addr, len);
+}
+
+static inline void nvm_eeprom_cache_update_block(const void *buf, void *addr, size_t len) {
+    eeprom_update_block(buf, addr, len);
+}
+
+static inline void nvm_eeprom_cache_invalidate(void) {}
+
+static inline uint8_t nvm_eeprom_cache_read_byte(const void *addr) {
+    return eeprom_read_byte((const uint8_t *)addr);
+}
+
+static inline void nvm_eeprom_cache_update_byte(void *addr, uint8_t value) {
+    eeprom_update_byte((uint8_t *)addr, value);
+}
+
+#endif // NVM_CACHE_ENABLE
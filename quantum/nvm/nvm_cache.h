@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+
+#ifndef NVM_CACHE_PAGE_SIZE
+#    define NVM_CACHE_PAGE_SIZE 32
+#endif
+
+#ifndef NVM_CACHE_FLUSH_DELAY
+#    define NVM_CACHE_FLUSH_DELAY 1000
+#endif
+
+// RAM write-back cache in front of the NVM repositories for the dynamic keymap and VIA.
+// Reads are served from RAM, and writes are committed to the underlying storage in page-sized batches once they have
+// stopped for NVM_CACHE_FLUSH_DELAY milliseconds.
+
+// Commits one batch of pending writes if writes have stopped for long enough, called from the main loop.
+void nvm_cache_task(void);
+
+// Commits all pending writes, e.g. before suspending or resetting.
+void nvm_cache_flush(void);
+
+// Whether there are writes which have not been committed yet.
+bool nvm_cache_is_dirty(void);
@@ -28,4 +28,12 @@ else
 
     QUANTUM_SRC += nvm_eeconfig.c
 
+    ifeq ($(strip $(NVM_CACHE_ENABLE)), yes)
+        ifneq ($(NVM_DRIVER_LOWER),eeprom)
+            $(call CATASTROPHIC_ERROR,Invalid NVM_DRIVER,NVM_CACHE_ENABLE requires NVM_DRIVER=eeprom)
+        endif
+        OPT_DEFS += -DNVM_CACHE_ENABLE
+        QUANTUM_SRC += nvm_cache.c
+    endif
+
 endif
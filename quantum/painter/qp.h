@@ -56,6 +56,24 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the maximum number of decoded glyphs that Quantum Painter keeps in RAM, shared between all loaded
+ *      fonts. Cached glyphs skip the lookup and decompression of the font data, and consecutive cached glyphs are sent
+ *      to the display in a single transaction. The least recently used glyph is replaced when the cache is full. Set
+ *      to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 16
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES
+/**
+ * @def This controls the maximum size of each glyph held by the glyph cache, in bytes. Glyphs need width * height *
+ *      bpp / 8 bytes, and any which are larger are decoded from the font each time they are drawn.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES 64
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
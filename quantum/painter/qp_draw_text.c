@@ -36,6 +36,69 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decoded glyph cache
+
+#    if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 255
+#        error "QUANTUM_PAINTER_GLYPH_CACHE_SIZE must be 255 or less"
+#    endif
+
+typedef struct qp_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if this entry is unused
+    uint32_t           code_point;
+    uint32_t           last_used;
+    uint8_t            width;
+    bool               in_run; // part of the text run being composed, so it can't be replaced yet
+    uint8_t            data[QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE] = {0};
+static uint32_t               glyph_cache_clock                             = 0;
+
+// Number of bytes needed to hold the decompressed pixel data of a glyph
+static inline uint32_t qp_glyph_cache_bytes(qff_font_handle_t *qff_font, uint8_t width) {
+    return ((uint32_t)width * qff_font->base.line_height * qff_font->bpp + 7) / 8;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(qff_font_handle_t *qff_font, uint32_t code_point) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font && glyph_cache[i].code_point == code_point) {
+            glyph_cache[i].last_used = ++glyph_cache_clock;
+            return &glyph_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Picks an unused entry if there is one, otherwise the least recently used entry which isn't part of the current run
+static qp_glyph_cache_entry_t *qp_glyph_cache_find_free(void) {
+    qp_glyph_cache_entry_t *oldest = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->in_run) {
+            continue;
+        }
+        if (!entry->font) {
+            return entry;
+        }
+        if (!oldest || entry->last_used < oldest->last_used) {
+            oldest = entry;
+        }
+    }
+    return oldest;
+}
+
+// Drops every glyph belonging to a font, as its slot may be reused by a different font
+static void qp_glyph_cache_evict_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,6 +214,10 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    qp_glyph_cache_evict_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -292,6 +359,18 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
+// Finds the width of a glyph. Unless it's already in the glyph cache, the stream is also positioned at the start of its pixel data
+static inline bool qp_drawtext_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(qff_font, code_point);
+    if (entry) {
+        *width = entry->width;
+        return true;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    return qp_drawtext_prepare_glyph_for_render(qff_font, code_point, width);
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
@@ -303,7 +382,7 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
         }
 
         uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        if (!qp_drawtext_lookup_glyph(qff_font, code_point, &width)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
@@ -345,13 +424,155 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t   *input_state;
     qp_internal_pixel_output_state_t *output_state;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Cached glyphs waiting to be sent to the display together, ending at xpos
+    uint8_t run[QUANTUM_PAINTER_GLYPH_CACHE_SIZE]; // indices into the glyph cache
+    uint8_t run_length;
+    int16_t run_width;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 } code_point_iter_drawglyph_state_t;
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+// Decompresses the glyph at the current stream position into the supplied cache entry
+static bool qp_glyph_cache_decode(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, code_point_iter_drawglyph_state_t *state, qp_glyph_cache_entry_t *entry) {
+    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
+    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+
+    uint32_t byte_count = qp_glyph_cache_bytes(qff_font, width);
+    entry->font         = NULL;
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        int16_t byteval = state->input_callback(state->input_state);
+        if (byteval < 0) {
+            qp_dprintf("Failed to decode glyph for caching\n");
+            return false;
+        }
+        entry->data[i] = byteval;
+    }
+
+    entry->font       = qff_font;
+    entry->code_point = code_point;
+    entry->width      = width;
+    entry->last_used  = ++glyph_cache_clock;
+    return true;
+}
+
+// Appends palette indices to the pixdata buffer in bulk, sending it to the display whenever it fills up
+static bool qp_drawtext_append_indices(qp_internal_pixel_output_state_t *output_state, uint8_t *indices, uint32_t count) {
+    painter_driver_t *driver = (painter_driver_t *)output_state->device;
+    while (count > 0) {
+        uint32_t batch = MIN(count, output_state->max_pixels - output_state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(output_state->device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, output_state->pixel_write_pos, batch, indices)) {
+            return false;
+        }
+        output_state->pixel_write_pos += batch;
+        indices += batch;
+        count -= batch;
+
+        if (output_state->pixel_write_pos == output_state->max_pixels) {
+            if (!driver->driver_vtable->pixdata(output_state->device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+                return false;
+            }
+            output_state->pixel_write_pos = 0;
+        }
+    }
+    return true;
+}
+
+static void qp_drawtext_release_run(code_point_iter_drawglyph_state_t *state) {
+    for (uint8_t i = 0; i < state->run_length; ++i) {
+        glyph_cache[state->run[i]].in_run = false;
+    }
+    state->run_length = 0;
+    state->run_width  = 0;
+}
+
+// Sends the pending run of cached glyphs to the display as a single block, a row at a time
+static bool qp_drawtext_flush_run(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state) {
+    if (state->run_length == 0) {
+        return true;
+    }
+
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+    int16_t           left   = state->xpos - state->run_width;
+    uint8_t           height = qff_font->base.line_height;
+    bool              ok     = driver->driver_vtable->viewport(state->device, left, state->ypos, left + state->run_width - 1, state->ypos + height - 1);
+
+    // Convert the cached palette indices to native pixels, using the palette set up for this string
+    qp_internal_pixel_output_state_t output_state  = {.device = state->device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(state->device)};
+    const uint8_t                    bpp           = qff_font->bpp;
+    const uint8_t                    pixel_bitmask = (1 << bpp) - 1;
+
+    // Indices are gathered into small batches to cut down on calls into the driver
+    uint8_t indices[32];
+    uint8_t index_count = 0;
+    for (uint8_t y = 0; ok && y < height; ++y) {
+        for (uint8_t i = 0; ok && i < state->run_length; ++i) {
+            qp_glyph_cache_entry_t *entry = &glyph_cache[state->run[i]];
+            uint32_t                bit   = (uint32_t)y * entry->width * bpp;
+            for (uint8_t x = 0; ok && x < entry->width; ++x, bit += bpp) {
+                indices[index_count++] = (entry->data[bit / 8] >> (bit % 8)) & pixel_bitmask;
+                if (index_count == sizeof(indices)) {
+                    ok          = qp_drawtext_append_indices(&output_state, indices, index_count);
+                    index_count = 0;
+                }
+            }
+        }
+    }
+    if (ok && index_count > 0) {
+        ok = qp_drawtext_append_indices(&output_state, indices, index_count);
+    }
+
+    // Any leftovers need transmission as well.
+    if (ok && output_state.pixel_write_pos > 0) {
+        ok = driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+    }
+
+    qp_drawtext_release_run(state);
+    return ok;
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t                  *driver = (painter_driver_t *)state->device;
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Native pixel glyphs and glyphs too large for the cache are drawn directly from the font
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(qff_font, code_point);
+    if (!entry && qff_font->bpp <= 8 && qp_glyph_cache_bytes(qff_font, width) <= QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES) {
+        // If every entry is part of the pending run, send it first so the entries can be reused
+        entry = qp_glyph_cache_find_free();
+        if (!entry) {
+            if (!qp_drawtext_flush_run(qff_font, state)) {
+                return false;
+            }
+            entry = qp_glyph_cache_find_free();
+        }
+        if (!qp_glyph_cache_decode(qff_font, code_point, width, state, entry)) {
+            return false;
+        }
+    }
+
+    if (entry) {
+        if (state->run_length == QUANTUM_PAINTER_GLYPH_CACHE_SIZE && !qp_drawtext_flush_run(qff_font, state)) {
+            return false;
+        }
+
+        // Queue up the glyph, it gets drawn along with its neighbours
+        entry->in_run                   = true;
+        state->run[state->run_length++] = entry - glyph_cache;
+        state->run_width += width;
+        state->xpos += width;
+        return true;
+    }
+
+    // Keep everything in order on the display by sending the glyphs before this one
+    if (!qp_drawtext_flush_run(qff_font, state)) {
+        return false;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
@@ -451,6 +672,15 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Send the final run of glyphs, or let go of them if something went wrong
+    if (ret) {
+        ret = qp_drawtext_flush_run(qff_font, &state);
+    } else {
+        qp_drawtext_release_run(&state);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret ? (state.xpos - x) : 0;
@@ -321,6 +321,22 @@ void autoshift_matrix_scan(void) {
     }
 }
 
+/** \brief Milliseconds until autoshift_matrix_scan() times out the key in progress, DEADLINE_NONE if there is none. */
+uint32_t autoshift_matrix_scan_deadline(void) {
+    if (!autoshift_flags.in_progress) {
+        return DEADLINE_NONE;
+    }
+
+    const uint16_t timeout =
+#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+        get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord);
+#else
+        autoshift_timeout;
+#endif
+    const uint16_t elapsed = TIMER_DIFF_16(timer_read(), autoshift_time);
+    return elapsed >= timeout ? 0 : timeout - elapsed;
+}
+
 void autoshift_toggle(void) {
     autoshift_flags.enabled = !autoshift_flags.enabled;
     autoshift_flush_shift();
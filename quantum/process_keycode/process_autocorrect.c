@@ -19,9 +19,27 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifdef AUTOCORRECT_AUTOMATON
+#    if AUTOCORRECT_LINK_SIZE > 2
+typedef uint32_t autocorrect_state_t;
+#    else
+typedef uint16_t autocorrect_state_t;
+#    endif
+
+// Automaton state after each keycode in `typo_buffer`, so backspace can go back to it.
+static autocorrect_state_t state_buffer[AUTOCORRECT_MAX_LENGTH] = {AUTOCORRECT_START_STATE};
+#endif
+
+// Ring buffer of the typed keycodes, oldest first from `typo_buffer_start`.
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+static uint8_t typo_buffer_start                   = 0;
 static uint8_t typo_buffer_size                    = 1;
 
+static inline uint8_t typo_buffer_index(uint8_t i) {
+    i += typo_buffer_start;
+    return i < AUTOCORRECT_MAX_LENGTH ? i : i - AUTOCORRECT_MAX_LENGTH;
+}
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +207,138 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_AUTOMATON
+static inline autocorrect_state_t read_link(autocorrect_state_t offset) {
+    autocorrect_state_t link = 0;
+    for (uint8_t i = 0; i < AUTOCORRECT_LINK_SIZE; ++i) {
+        link |= (autocorrect_state_t)pgm_read_byte(autocorrect_data + offset + i) << (8 * i);
+    }
+    return link;
+}
+
+/**
+ * @brief Advances the automaton in `autocorrect_data` by one keycode
+ *
+ * Follows failure links until a state has a transition for `keycode`, or the
+ * root is reached. Each failure link shortens the matched suffix, so this takes
+ * constant time per keycode on average, whatever the size of the dictionary.
+ *
+ * @param state byte offset of the current state
+ * @param keycode keycode appended to the buffer
+ * @return byte offset of the next state
+ */
+static autocorrect_state_t autocorrect_step(autocorrect_state_t state, uint8_t keycode) {
+    for (;;) {
+        uint8_t             children = pgm_read_byte(autocorrect_data + state);
+        autocorrect_state_t child    = state + 1 + AUTOCORRECT_LINK_SIZE;
+        // Children are sorted by keycode.
+        for (; children > 0; --children, child += 1 + AUTOCORRECT_LINK_SIZE) {
+            uint8_t const code = pgm_read_byte(autocorrect_data + child);
+            if (code == keycode) {
+                return read_link(child + 1);
+            } else if (code > keycode) {
+                break;
+            }
+        }
+        if (state == 0) {
+            return 0;
+        }
+        state = read_link(state + 1);
+    }
+}
+#endif
+
+/**
+ * @brief Applies the correction of the typo found at the end of the buffer
+ *
+ * @param keycode keycode that completed the typo
+ * @param code first byte of the correction in `autocorrect_data`
+ * @param changes pointer to PROGMEM string to replace mistyped seletion with
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_apply_correction(uint16_t keycode, uint8_t code, const char *changes) {
+    const uint8_t backspaces = code & 63;
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_index(typo_buffer_size - 1)] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[typo_buffer_index(i - 1)] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_buffer_index(typo_start + i)] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        bool queued = false;
+#ifdef SEND_STRING_ASYNC_ENABLE
+        // A word boundary key is sent to the host as soon as this returns, so
+        // it can only follow the correction if that is typed straight away
+        if (keycode != KC_SPC) {
+            for (uint8_t i = 0; i < backspaces; ++i) {
+                send_string_async("\b");
+            }
+            send_string_async_P(changes);
+            queued = true;
+        }
+#endif
+        if (!queued) {
+            for (uint8_t i = 0; i < backspaces; ++i) {
+                tap_code(KC_BSPC);
+            }
+            send_string_P(changes);
+        }
+    }
+
+    typo_buffer_start = 0;
+    if (keycode == KC_SPC) {
+        typo_buffer[0] = KC_SPC;
+#ifdef AUTOCORRECT_AUTOMATON
+        state_buffer[0] = AUTOCORRECT_START_STATE;
+#endif
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -266,14 +416,35 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
     }
 
+#ifdef AUTOCORRECT_AUTOMATON
+    // Continue from the state after the last keycode left in the buffer.
+    autocorrect_state_t state = typo_buffer_size ? state_buffer[typo_buffer_index(typo_buffer_size - 1)] : 0;
+#endif
+
     // Rotate oldest character if buffer is full.
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
-        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
-        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+        typo_buffer_start = typo_buffer_index(1);
+        typo_buffer_size  = AUTOCORRECT_MAX_LENGTH - 1;
     }
 
     // Append `keycode` to buffer.
-    typo_buffer[typo_buffer_size++] = keycode;
+    typo_buffer[typo_buffer_index(typo_buffer_size++)] = keycode;
+
+#ifdef AUTOCORRECT_AUTOMATON
+    state = autocorrect_step(state, keycode);
+    // Stop if `state` becomes an invalid index. This should not normally
+    // happen, it is a safeguard in case of a bug, data corruption, etc.
+    if (state >= DICTIONARY_SIZE) {
+        typo_buffer_size = 0;
+        return true;
+    }
+    state_buffer[typo_buffer_index(typo_buffer_size - 1)] = state;
+
+    uint8_t const code = pgm_read_byte(autocorrect_data + state);
+    if (code & 128) { // A typo was found! Apply autocorrect.
+        return autocorrect_apply_correction(keycode, code, (const char *)(autocorrect_data + state + 1));
+    }
+#else
     // Return if buffer is smaller than the shortest word.
     if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
         return true;
@@ -283,7 +454,7 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     uint16_t state = 0;
     uint8_t  code  = pgm_read_byte(autocorrect_data + state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
+        uint8_t const key_i = typo_buffer[typo_buffer_index(i)];
 
         if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
@@ -308,69 +479,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char   *changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_apply_correction(keycode, code, (const char *)(autocorrect_data + state + 1));
         }
     }
+#endif
     return true;
 }
@@ -16,8 +16,10 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
+#include "deferred_exec.h"
 #include "timer.h"
 #include "wait.h"
 #include "keyboard.h"
@@ -26,6 +28,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "debug.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -81,6 +84,10 @@ typedef enum { COMBO_KEY_NOT_PRESSED, COMBO_KEY_PRESSED, COMBO_KEY_REPRESSED } c
 
 #ifndef COMBO_NO_TIMER
 static uint16_t timer = 0;
+#    ifdef DEFERRED_EXEC_ENABLE
+static deferred_timer_t combo_timer;
+static void             combo_schedule_timeout(void);
+#    endif
 #endif
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
@@ -102,6 +109,94 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_INDEX_SIZE
+/* Inverted index from keycode to the combos containing it, sorted by keycode
+ * and then by combo index, so that process_combo() only visits the combos a
+ * key can contribute to, in the same order as a full scan would. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+
+typedef enum { COMBO_INDEX_STALE, COMBO_INDEX_READY, COMBO_INDEX_OVERFLOW } combo_index_status_t;
+
+static combo_index_entry_t  combo_index[COMBO_INDEX_SIZE];
+static uint16_t             combo_index_length = 0;
+static combo_index_status_t combo_index_status = COMBO_INDEX_STALE;
+
+/* Combos whose state may be non-zero, so clear_combos() only resets those.
+ * Every combo has at least one key, so the combo count is bounded by the index size. */
+static uint8_t combo_touched[(COMBO_INDEX_SIZE + 7) / 8];
+
+#    define COMBO_TOUCH(combo_index)                                          \
+        do {                                                                  \
+            combo_touched[(combo_index) / 8] |= (1 << ((combo_index) % 8)); \
+        } while (0)
+
+static void combo_index_build(void) {
+    combo_index_length = 0;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+
+        for (uint8_t key_i = 0; (key = pgm_read_word(&keys[key_i])) != COMBO_END; key_i++) {
+            // Combos are visited once per keycode, even if it is listed twice
+            bool duplicate = false;
+            for (uint8_t prev_i = 0; prev_i < key_i; prev_i++) {
+                duplicate |= pgm_read_word(&keys[prev_i]) == key;
+            }
+            if (duplicate) {
+                continue;
+            }
+
+            if (combo_index_length >= COMBO_INDEX_SIZE) {
+                dprintf("combo: COMBO_INDEX_SIZE too small, falling back to scanning all combos\n");
+                combo_index_status = COMBO_INDEX_OVERFLOW;
+                return;
+            }
+
+            // Stable insertion by keycode keeps combos of equal keycodes in index order
+            uint16_t pos = combo_index_length++;
+            while (pos > 0 && combo_index[pos - 1].keycode > key) {
+                combo_index[pos] = combo_index[pos - 1];
+                pos--;
+            }
+            combo_index[pos] = (combo_index_entry_t){.keycode = key, .combo_index = idx};
+        }
+    }
+
+    combo_index_status = COMBO_INDEX_READY;
+}
+
+static inline bool combo_index_ready(void) {
+    if (combo_index_status == COMBO_INDEX_STALE) {
+        combo_index_build();
+    }
+    return combo_index_status == COMBO_INDEX_READY;
+}
+
+/* Returns the position of the first entry for `keycode`, or where it would be. */
+static uint16_t combo_index_lower_bound(uint16_t keycode) {
+    uint16_t low = 0, high = combo_index_length;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void combo_index_invalidate(void) {
+    combo_index_status = COMBO_INDEX_STALE;
+    // States of the previous combo set are no longer tracked, so reset them all once
+    memset(combo_touched, 0xFF, sizeof(combo_touched));
+}
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -202,6 +297,30 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_INDEX_SIZE
+    if (combo_index_status == COMBO_INDEX_READY) {
+        for (uint16_t byte = 0; byte < sizeof(combo_touched); byte++) {
+            if (!combo_touched[byte]) {
+                continue;
+            }
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                index = byte * 8 + bit;
+                if (!(combo_touched[byte] & (1 << bit))) {
+                    continue;
+                }
+                if (index < combo_count()) {
+                    combo_t *combo = combo_get(index);
+                    if (COMBO_ACTIVE(combo)) {
+                        continue;
+                    }
+                    RESET_COMBO_STATE(combo);
+                }
+                combo_touched[byte] &= ~(1 << bit);
+            }
+        }
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -585,10 +704,21 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_SIZE
+    if (combo_index_ready()) {
+        for (uint16_t entry = combo_index_lower_bound(keycode); entry < combo_index_length && combo_index[entry].keycode == keycode; ++entry) {
+            uint16_t idx = combo_index[entry].combo_index;
+            COMBO_TOUCH(idx);
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -628,6 +758,9 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
             clear_combos();
         }
     }
+#if !defined(COMBO_NO_TIMER) && defined(DEFERRED_EXEC_ENABLE)
+    combo_schedule_timeout();
+#endif
     return !is_combo_key;
 }
 
@@ -651,6 +784,36 @@ void combo_task(void) {
 #endif
 }
 
+uint32_t combo_task_deadline(void) {
+#ifndef COMBO_NO_TIMER
+    if (b_combo_enable && timer) {
+        uint16_t elapsed = timer_elapsed(timer);
+        return elapsed > longest_term ? 0 : longest_term - elapsed + 1;
+    }
+#endif
+    return DEADLINE_NONE;
+}
+
+#if !defined(COMBO_NO_TIMER) && defined(DEFERRED_EXEC_ENABLE)
+static uint32_t combo_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    combo_task();
+    // The longest term may have been extended since this was scheduled
+    combo_schedule_timeout();
+    return 0;
+}
+
+/* Times out the pressed keys once the longest term of the combos they are part of has passed. */
+static void combo_schedule_timeout(void) {
+    uint32_t remaining = combo_task_deadline();
+    if (remaining == DEADLINE_NONE) {
+        deferred_timer_cancel(&combo_timer);
+        return;
+    }
+
+    deferred_timer_schedule(&combo_timer, remaining ? remaining : 1, combo_timeout_callback, NULL);
+}
+#endif
+
 void combo_enable(void) {
     b_combo_enable = true;
 }
@@ -658,6 +821,9 @@ void combo_enable(void) {
 void combo_disable(void) {
 #ifndef COMBO_NO_TIMER
     timer = 0;
+#    ifdef DEFERRED_EXEC_ENABLE
+    deferred_timer_cancel(&combo_timer);
+#    endif
 #endif
     b_combo_enable    = false;
     combo_buffer_read = combo_buffer_write;
@@ -73,9 +73,15 @@ typedef struct combo_t {
 
 bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
+/** Milliseconds until combo_task() times out the pressed keys, DEADLINE_NONE if there are none. */
+uint32_t combo_task_deadline(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_INDEX_SIZE
+void combo_index_invalidate(void);
+#endif
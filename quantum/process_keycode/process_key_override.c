@@ -406,7 +406,16 @@ void key_override_task(void) {
     }
 }
 
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
+uint32_t key_override_task_deadline(void) {
+    if (deferred_register == 0) {
+        return DEADLINE_NONE;
+    }
+
+    uint32_t elapsed = timer_elapsed32(defer_reference_time);
+    return elapsed >= defer_delay ? 0 : defer_delay - elapsed;
+}
+
+bool process_key_override(uint16_t keycode, keyrecord_t *record) {
 #ifdef BENCH_KEY_OVERRIDE
     uint16_t start = timer_read();
 #endif
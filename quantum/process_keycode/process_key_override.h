@@ -100,11 +100,14 @@ void key_override_toggle(void);
 bool key_override_is_enabled(void);
 
 /** Handling of key overrides and its implemented keycodes */
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
+bool process_key_override(uint16_t keycode, keyrecord_t *record);
 
 /** Perform any deferred keys */
 void key_override_task(void);
 
+/** Milliseconds until key_override_task() registers the deferred key, DEADLINE_NONE if there is none */
+uint32_t key_override_task_deadline(void);
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
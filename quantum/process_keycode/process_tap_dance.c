@@ -20,6 +20,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "timer.h"
+#include "deferred_exec.h"
 #include "wait.h"
 #include "keymap_introspection.h"
 
@@ -29,8 +30,24 @@ static uint16_t active_td;
 #    define TAP_DANCE_MAX_SIMULTANEOUS 3
 #endif
 
+#if TAP_DANCE_MAX_SIMULTANEOUS > 32
+#    error "TAP_DANCE_MAX_SIMULTANEOUS must not be more than 32"
+#endif
+
 static tap_dance_state_t tap_dance_states[TAP_DANCE_MAX_SIMULTANEOUS];
 
+// Bit i is set while tap_dance_states[i] is in use, so that states are handed out and looked up without visiting the free ones
+static uint32_t tap_dance_states_in_use;
+
+#ifdef DEFERRED_EXEC_ENABLE
+// Times out the dance of the state with the same index, only pending while that dance is the active one
+static deferred_timer_t tap_dance_timers[TAP_DANCE_MAX_SIMULTANEOUS];
+
+static inline deferred_timer_t *tap_dance_get_timer(tap_dance_state_t *state) {
+    return &tap_dance_timers[state - tap_dance_states];
+}
+#endif
+
 static uint16_t last_tap_time;
 
 static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx, bool allocate) {
@@ -38,9 +55,10 @@ static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx,
     if (tap_dance_idx >= tap_dance_count()) {
         return NULL;
     }
-    // Search for a state already used for this keycode
-    for (i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
-        if (tap_dance_states[i].in_use && tap_dance_states[i].index == tap_dance_idx) {
+    // Search the states in use for one already used for this keycode
+    for (uint32_t in_use = tap_dance_states_in_use; in_use; in_use &= ~(1UL << i)) {
+        i = biton32(in_use);
+        if (tap_dance_states[i].index == tap_dance_idx) {
             return &tap_dance_states[i];
         }
     }
@@ -48,16 +66,18 @@ static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx,
     if (!allocate) {
         return NULL;
     }
-    // Search for the first available state
-    for (i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
-        if (!tap_dance_states[i].in_use) {
-            tap_dance_states[i].index  = tap_dance_idx;
-            tap_dance_states[i].in_use = true;
-            return &tap_dance_states[i];
-        }
+    // Take any available state
+    uint32_t available = ~tap_dance_states_in_use & (UINT32_MAX >> (32 - TAP_DANCE_MAX_SIMULTANEOUS));
+    if (!available) {
+        // No states are available, tap dance won't happen
+        return NULL;
     }
-    // No states are available, tap dance won't happen
-    return NULL;
+    i = biton32(available);
+    tap_dance_states_in_use |= 1UL << i;
+
+    tap_dance_states[i].index  = tap_dance_idx;
+    tap_dance_states[i].in_use = true;
+    return &tap_dance_states[i];
 }
 
 tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx) {
@@ -145,11 +165,18 @@ static inline void process_tap_dance_action_on_reset(tap_dance_action_t *action,
     del_mods(state->oneshot_mods);
 #endif
     send_keyboard_report();
+#ifdef DEFERRED_EXEC_ENABLE
+    deferred_timer_cancel(tap_dance_get_timer(state));
+#endif
     // Clear the tap dance state and mark it as unused
+    tap_dance_states_in_use &= ~(1UL << (state - tap_dance_states));
     memset(state, 0, sizeof(tap_dance_state_t));
 }
 
 static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t *action, tap_dance_state_t *state) {
+#ifdef DEFERRED_EXEC_ENABLE
+    deferred_timer_cancel(tap_dance_get_timer(state));
+#endif
     if (!state->finished) {
         state->finished = true;
         add_weak_mods(state->weak_mods);
@@ -166,6 +193,17 @@ static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t
     }
 }
 
+#ifdef DEFERRED_EXEC_ENABLE
+static uint32_t tap_dance_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    tap_dance_state_t *state = (tap_dance_state_t *)cb_arg;
+
+    if (state->in_use && !state->interrupted) {
+        process_tap_dance_action_on_dance_finished(tap_dance_get(state->index), state);
+    }
+    return 0;
+}
+#endif
+
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
     tap_dance_action_t *action;
     tap_dance_state_t  *state;
@@ -215,6 +253,14 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action, state);
                 active_td = state->finished ? 0 : keycode;
+#ifdef DEFERRED_EXEC_ENABLE
+                if (active_td) {
+                    // Finish the dance once the tapping term has passed since this tap
+                    deferred_timer_schedule(tap_dance_get_timer(state), GET_TAPPING_TERM(active_td, &(keyrecord_t){}) + 1, tap_dance_timeout_callback, state);
+                } else {
+                    deferred_timer_cancel(tap_dance_get_timer(state));
+                }
+#endif
             } else {
                 process_tap_dance_action_on_each_release(action, state);
                 if (state->finished) {
@@ -231,6 +277,7 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
+// Polled from quantum_task() when there is no timer wheel to finish the dance
 void tap_dance_task(void) {
     tap_dance_action_t *action;
     tap_dance_state_t  *state;
@@ -244,6 +291,14 @@ void tap_dance_task(void) {
     }
 }
 
+uint32_t tap_dance_task_deadline(void) {
+    if (!active_td) return DEADLINE_NONE;
+
+    uint16_t term    = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    uint16_t elapsed = timer_elapsed(last_tap_time);
+    return elapsed > term ? 0 : term - elapsed + 1;
+}
+
 void reset_tap_dance(tap_dance_state_t *state) {
     active_td = 0;
     process_tap_dance_action_on_reset(tap_dance_get(state->index), state);
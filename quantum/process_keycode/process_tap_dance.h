@@ -106,6 +106,8 @@ tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx);
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record);
 bool process_tap_dance(uint16_t keycode, keyrecord_t *record);
 void tap_dance_task(void);
+/** Milliseconds until tap_dance_task() finishes the active tap dance, DEADLINE_NONE if there is none. */
+uint32_t tap_dance_task_deadline(void);
 
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data);
 void tap_dance_pair_finished(tap_dance_state_t *state, void *user_data);
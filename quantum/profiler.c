@@ -0,0 +1,299 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiler.h"
+#include "timer.h"
+#include "print.h"
+#include "util.h"
+#include "compiler_support.h"
+
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#    if defined(PROTOCOL_LUFA) || defined(PROTOCOL_CHIBIOS)
+#        include "usb_descriptor.h"
+#        define PROFILER_RAW_HID_REPORT RAW_EPSIZE
+#    else
+// V-USB reassembles its 8 byte packets into 32 byte reports
+#        define PROFILER_RAW_HID_REPORT 32
+#    endif
+#endif
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#    define PROFILER_TIMESTAMP() chSysGetRealtimeCounterX()
+#    define PROFILER_TIMESTAMP_FREQUENCY REALTIME_COUNTER_CLOCK
+#else
+#    define PROFILER_TIMESTAMP() timer_read_us()
+#    define PROFILER_TIMESTAMP_FREQUENCY 1000000
+#endif
+
+STATIC_ASSERT(PROFILER_ZONE_COUNT < PROFILER_ZONE_NONE, "PROFILER_ZONE_COUNT too large");
+STATIC_ASSERT(PROFILER_RING_SIZE <= UINT8_MAX, "PROFILER_RING_SIZE too large");
+
+static profiler_zone_stats_t zones[PROFILER_ZONE_COUNT];
+static uint8_t               zone_count = 0;
+static profiler_sample_t     ring[PROFILER_RING_SIZE];
+static uint8_t               ring_head  = 0;
+static uint8_t               ring_count = 0;
+static uint8_t               depth      = 0;
+static uint32_t              reset_time = 0;
+static bool                  frozen     = false; // a raw HID dump is being sent
+
+uint8_t profiler_zone(const char *name) {
+    for (uint8_t i = 0; i < zone_count; i++) {
+        if (zones[i].name == name || strcmp(zones[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (zone_count >= PROFILER_ZONE_COUNT) {
+        return PROFILER_ZONE_NONE;
+    }
+
+    profiler_zone_stats_t *zone = &zones[zone_count];
+    memset(zone, 0, sizeof(profiler_zone_stats_t));
+    zone->name = name;
+    zone->min  = UINT32_MAX;
+    return zone_count++;
+}
+
+uint32_t profiler_begin(void) {
+    depth++;
+    return PROFILER_TIMESTAMP();
+}
+
+void profiler_end(uint8_t zone, uint32_t start) {
+    uint32_t duration = PROFILER_TIMESTAMP() - start;
+    depth--;
+    if (zone >= zone_count || frozen) return;
+
+    profiler_zone_stats_t *stats = &zones[zone];
+    stats->count++;
+    stats->total += duration;
+    stats->min = MIN(stats->min, duration);
+    stats->max = MAX(stats->max, duration);
+
+    uint8_t bucket = 0;
+    for (uint32_t remaining = duration; remaining && bucket < PROFILER_HISTOGRAM_BUCKETS - 1; remaining >>= 1) {
+        bucket++;
+    }
+    if (stats->histogram[bucket] < UINT16_MAX) {
+        stats->histogram[bucket]++;
+    }
+
+    ring[ring_head] = (profiler_sample_t){.zone = zone, .depth = depth, .duration = duration};
+    ring_head       = (ring_head + 1) % PROFILER_RING_SIZE;
+    if (ring_count < PROFILER_RING_SIZE) {
+        ring_count++;
+    }
+}
+
+void profiler_reset(void) {
+    for (uint8_t i = 0; i < zone_count; i++) {
+        const char *name = zones[i].name;
+        memset(&zones[i], 0, sizeof(profiler_zone_stats_t));
+        zones[i].name = name;
+        zones[i].min  = UINT32_MAX;
+    }
+    ring_head  = 0;
+    ring_count = 0;
+    reset_time = timer_read32();
+}
+
+const profiler_zone_stats_t *profiler_get_zone(const char *name) {
+    for (uint8_t i = 0; i < zone_count; i++) {
+        if (strcmp(zones[i].name, name) == 0) {
+            return &zones[i];
+        }
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////
+// Dump
+
+static uint8_t *put_u16(uint8_t *out, uint16_t value) {
+    *out++ = value;
+    *out++ = value >> 8;
+    return out;
+}
+
+static uint8_t *put_u32(uint8_t *out, uint32_t value) {
+    out = put_u16(out, value);
+    return put_u16(out, value >> 16);
+}
+
+static void profiler_write_dump(profiler_writer_t writer, uint8_t zone_total, uint32_t elapsed) {
+    uint8_t  buffer[20];
+    uint8_t *out = buffer;
+
+    *out++ = 'Q';
+    *out++ = 'P';
+    *out++ = PROFILER_DUMP_VERSION;
+    *out++ = zone_total;
+    *out++ = PROFILER_HISTOGRAM_BUCKETS;
+    *out++ = ring_count;
+    out    = put_u32(out, PROFILER_TIMESTAMP_FREQUENCY);
+    out    = put_u32(out, elapsed);
+    writer(buffer, out - buffer);
+
+    for (uint8_t i = 0; i < zone_total; i++) {
+        const profiler_zone_stats_t *zone   = &zones[i];
+        uint8_t                      length = MIN(strlen(zone->name), UINT8_MAX);
+        writer(&length, 1);
+        writer((const uint8_t *)zone->name, length);
+
+        out = put_u32(buffer, zone->count);
+        out = put_u32(out, zone->total);
+        out = put_u32(out, zone->total >> 32);
+        out = put_u32(out, zone->count ? zone->min : 0);
+        out = put_u32(out, zone->max);
+        writer(buffer, out - buffer);
+
+        for (uint8_t bucket = 0; bucket < PROFILER_HISTOGRAM_BUCKETS; bucket++) {
+            put_u16(buffer, zone->histogram[bucket]);
+            writer(buffer, 2);
+        }
+    }
+
+    uint8_t index = (ring_head + PROFILER_RING_SIZE - ring_count) % PROFILER_RING_SIZE;
+    for (uint8_t i = 0; i < ring_count; i++) {
+        const profiler_sample_t *sample = &ring[(index + i) % PROFILER_RING_SIZE];
+        buffer[0]                       = sample->zone;
+        buffer[1]                       = sample->depth;
+        out                             = put_u32(&buffer[2], sample->duration);
+        writer(buffer, out - buffer);
+    }
+}
+
+void profiler_dump(profiler_writer_t writer) {
+    profiler_write_dump(writer, zone_count, timer_elapsed32(reset_time));
+}
+
+#ifdef CONSOLE_ENABLE
+#    define PROFILER_CONSOLE_LINE 16
+
+static uint8_t console_line[PROFILER_CONSOLE_LINE];
+static uint8_t console_length;
+
+static void profiler_console_flush(void) {
+    if (console_length == 0) return;
+    xprintf("profiler: ");
+    for (uint8_t i = 0; i < console_length; i++) {
+        xprintf("%02X", console_line[i]);
+    }
+    xprintf("\n");
+    console_length = 0;
+}
+
+static void profiler_console_writer(const uint8_t *data, uint8_t length) {
+    while (length--) {
+        console_line[console_length++] = *data++;
+        if (console_length == PROFILER_CONSOLE_LINE) {
+            profiler_console_flush();
+        }
+    }
+}
+#endif
+
+void profiler_dump_console(void) {
+#ifdef CONSOLE_ENABLE
+    xprintf("profiler: begin\n");
+    console_length = 0;
+    profiler_dump(&profiler_console_writer);
+    profiler_console_flush();
+    xprintf("profiler: end\n");
+#endif
+}
+
+#ifdef RAW_ENABLE
+#    define PROFILER_RAW_HID_HEADER 3
+#    define PROFILER_RAW_HID_PAYLOAD (PROFILER_RAW_HID_REPORT - PROFILER_RAW_HID_HEADER)
+
+static uint8_t  raw_hid_report[PROFILER_RAW_HID_REPORT];
+static bool     raw_hid_reset_after = false;
+static uint16_t raw_hid_chunk;
+static uint16_t raw_hid_skip;
+static uint8_t  raw_hid_zone_count;
+static uint32_t raw_hid_elapsed;
+
+// Keeps only the payload of the current chunk, the dump is regenerated for each one
+static void profiler_raw_hid_writer(const uint8_t *data, uint8_t length) {
+    for (; length; length--, data++) {
+        if (raw_hid_skip) {
+            raw_hid_skip--;
+        } else if (raw_hid_report[2] < PROFILER_RAW_HID_PAYLOAD) {
+            raw_hid_report[PROFILER_RAW_HID_HEADER + raw_hid_report[2]++] = *data;
+        }
+    }
+}
+
+static void profiler_raw_hid_send_chunk(void) {
+    memset(raw_hid_report, 0, sizeof(raw_hid_report));
+    raw_hid_report[0] = PROFILER_RAW_HID_ID;
+    raw_hid_report[1] = raw_hid_chunk;
+    raw_hid_skip      = raw_hid_chunk * PROFILER_RAW_HID_PAYLOAD;
+    profiler_write_dump(&profiler_raw_hid_writer, raw_hid_zone_count, raw_hid_elapsed);
+    raw_hid_send(raw_hid_report, sizeof(raw_hid_report));
+    raw_hid_chunk++;
+
+    // Always ends with a short report, even an empty one
+    if (raw_hid_report[2] < PROFILER_RAW_HID_PAYLOAD) {
+        frozen = false;
+        if (raw_hid_reset_after) {
+            profiler_reset();
+        }
+    }
+}
+#endif
+
+static void profiler_start_raw_hid_dump(bool reset_after) {
+#ifdef RAW_ENABLE
+    if (frozen) return;
+    frozen              = true;
+    raw_hid_reset_after = reset_after;
+    raw_hid_chunk       = 0;
+    raw_hid_zone_count  = zone_count;
+    raw_hid_elapsed     = timer_elapsed32(reset_time);
+#else
+    if (reset_after) {
+        profiler_reset();
+    }
+#endif
+}
+
+void profiler_dump_raw_hid(void) {
+    profiler_start_raw_hid_dump(false);
+}
+
+bool profiler_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != PROFILER_RAW_HID_ID) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case PROFILER_DUMP:
+            profiler_start_raw_hid_dump(false);
+            break;
+        case PROFILER_DUMP_AND_RESET:
+            profiler_start_raw_hid_dump(true);
+            break;
+    }
+    return true;
+}
+
+void profiler_task(void) {
+#ifdef RAW_ENABLE
+    if (frozen) {
+        profiler_raw_hid_send_chunk();
+        return;
+    }
+#endif
+#if PROFILER_DUMP_INTERVAL > 0
+    if (timer_elapsed32(reset_time) >= PROFILER_DUMP_INTERVAL) {
+        profiler_dump_console();
+        profiler_reset();
+    }
+#endif
+}
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file profiler.h
+ * @brief Hot path profiler.
+ *
+ * When `PROFILER_ENABLE` is set, code wrapped in `PROFILE_ZONE()` is timed
+ * with the highest resolution counter of the platform: the realtime (cycle)
+ * counter on ChibiOS, `timer_read_us()` elsewhere. Each named zone keeps its
+ * call count, total, minimum and maximum, and a histogram of durations in
+ * power of two buckets that percentiles can be estimated from. The most recent
+ * samples are also kept, with their nesting depth, in a fixed-size ring so
+ * that time can be attributed to callers.
+ *
+ * The keyboard task loop instruments its main tasks. Results are read out as a
+ * compact binary dump, see `profiler_dump()`, which `qmk profile` decodes. The
+ * dump can also be requested over raw HID, see `profiler_raw_hid_receive()`.
+ *
+ *     PROFILE_ZONE("my_task", my_task());
+ */
+
+#ifndef PROFILER_ZONE_COUNT
+#    define PROFILER_ZONE_COUNT 16
+#endif
+
+#ifndef PROFILER_HISTOGRAM_BUCKETS
+#    define PROFILER_HISTOGRAM_BUCKETS 24
+#endif
+
+#ifndef PROFILER_RING_SIZE
+#    define PROFILER_RING_SIZE 32
+#endif
+
+// Console dump interval in milliseconds, 0 to only dump on request
+#ifndef PROFILER_DUMP_INTERVAL
+#    define PROFILER_DUMP_INTERVAL 0
+#endif
+
+// First byte of each raw HID report carrying a dump, and of the commands handled by profiler_raw_hid_receive()
+#ifndef PROFILER_RAW_HID_ID
+#    define PROFILER_RAW_HID_ID 0xFB
+#endif
+
+#define PROFILER_DUMP_VERSION 1
+#define PROFILER_ZONE_NONE 0xFF
+// Not looked up yet, as PROFILER_ZONE_NONE is remembered by PROFILE_ZONE() so that the zones are only searched once
+#define PROFILER_ZONE_UNSET 0xFE
+
+typedef enum profiler_command_t {
+    PROFILER_DUMP           = 0x01,
+    PROFILER_DUMP_AND_RESET = 0x02,
+} profiler_command_t;
+
+typedef struct profiler_zone_stats_t {
+    const char *name;
+    uint32_t    count;
+    uint64_t    total;
+    uint32_t    min;
+    uint32_t    max;
+    uint16_t    histogram[PROFILER_HISTOGRAM_BUCKETS]; // bucket n counts durations of n bits, the last one also everything longer
+} profiler_zone_stats_t;
+
+typedef struct profiler_sample_t {
+    uint8_t  zone;
+    uint8_t  depth;
+    uint32_t duration;
+} profiler_sample_t;
+
+typedef void (*profiler_writer_t)(const uint8_t *data, uint8_t length);
+
+/**
+ * @brief Finds the zone with the given name, registering it on first use.
+ *
+ * @return the zone, or PROFILER_ZONE_NONE when all zones are taken
+ */
+uint8_t profiler_zone(const char *name);
+
+/**
+ * @brief Starts timing a zone, returns the timestamp to pass to profiler_end().
+ */
+uint32_t profiler_begin(void);
+
+/**
+ * @brief Records a sample for a zone started at start.
+ */
+void profiler_end(uint8_t zone, uint32_t start);
+
+/**
+ * @brief Clears the statistics of every zone, zones stay registered.
+ */
+void profiler_reset(void);
+
+/**
+ * @brief Returns the statistics of the named zone, or NULL if it has not been used.
+ */
+const profiler_zone_stats_t *profiler_get_zone(const char *name);
+
+/**
+ * @brief Streams the binary dump of all zones and the sample ring to writer.
+ *
+ * All values are little endian:
+ *
+ *     header  'Q' 'P' version zone_count bucket_count sample_count
+ *             u32 timestamp frequency in Hz, u32 milliseconds since reset
+ *     zone    u8 name length, name, u32 count, u64 total, u32 min, u32 max,
+ *             u16 histogram[bucket_count]
+ *     sample  u8 zone, u8 depth, u32 duration, oldest first
+ */
+void profiler_dump(profiler_writer_t writer);
+
+/**
+ * @brief Prints the dump to the console as lines of hex.
+ */
+void profiler_dump_console(void);
+
+/**
+ * @brief Starts sending the dump as raw HID reports of PROFILER_RAW_HID_ID, chunk
+ * index, payload length and payload. A report with less than a full payload ends it.
+ *
+ * profiler_task() sends one report per call, so the main loop keeps running.
+ * Nothing is recorded until the last report is sent.
+ */
+void profiler_dump_raw_hid(void);
+
+/**
+ * @brief Handles a profiler command, PROFILER_RAW_HID_ID followed by a
+ * profiler_command_t.
+ *
+ * The reply is the dump sent by profiler_dump_raw_hid(), unknown commands are
+ * ignored. The reset of PROFILER_DUMP_AND_RESET happens once the dump is sent.
+ *
+ * @return true if the report was a profiler command
+ */
+bool profiler_raw_hid_receive(uint8_t *data, uint8_t length);
+
+void profiler_task(void);
+
+#ifdef PROFILER_ENABLE
+#    define PROFILE_ZONE(name, call)                                 \
+        do {                                                         \
+            static uint8_t profiler_zone_id = PROFILER_ZONE_UNSET;   \
+            if (profiler_zone_id == PROFILER_ZONE_UNSET) {           \
+                profiler_zone_id = profiler_zone(name);              \
+            }                                                        \
+            uint32_t profiler_zone_start = profiler_begin();         \
+            call;                                                    \
+            profiler_end(profiler_zone_id, profiler_zone_start);     \
+        } while (0)
+#else
+#    define PROFILE_ZONE(name, call) \
+        do {                         \
+            call;                    \
+        } while (0)
+#endif
@@ -249,6 +249,10 @@ extern layer_state_t layer_state;
 #    include "layer_lock.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #ifdef COMMUNITY_MODULES_ENABLE
 #    include "community_modules.h"
 #endif
@@ -272,6 +276,17 @@ bool     process_record_user(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_kb(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_user(uint16_t keycode, keyrecord_t *record);
 
+typedef bool (*process_record_func_t)(uint16_t keycode, keyrecord_t *record);
+
+/* Handler of process_record_quantum(), only called for keycodes in [first, last] */
+typedef struct process_record_range_t {
+    uint16_t              first;
+    uint16_t              last;
+    process_record_func_t process;
+} process_record_range_t;
+
+const process_record_range_t *process_record_quantum_ranges(uint8_t *count);
+
 void reset_keyboard(void);
 void soft_reset_keyboard(void);
 
@@ -4,6 +4,13 @@
 #include "raw_hid.h"
 #include "host.h"
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef PROFILER_ENABLE
+#    include "profiler.h"
+#endif
+
 void raw_hid_send(uint8_t *data, uint8_t length) {
     host_raw_hid_send(data, length);
 }
@@ -12,4 +19,15 @@ __attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
     // Users should #include "raw_hid.h" in their own code
     // and implement this function there. Leave this as weak linkage
     // so users can opt to not handle data coming in.
+#ifdef LATENCY_TRACE_ENABLE
+    if (latency_trace_raw_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
+#endif
+#ifdef PROFILER_ENABLE
+    if (profiler_raw_hid_receive(data, length)) {
+        return;
+    }
+#endif
 }
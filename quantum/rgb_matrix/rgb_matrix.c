@@ -97,6 +97,15 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// render scheduler: the LEDs rendered by the current iteration, and the
+// measured cost of rendering one LED with the current effect, in 1/16 us
+static uint8_t  rgb_render_led_min    = 0;
+static uint8_t  rgb_render_led_max    = 0;
+static uint16_t rgb_render_cost       = 0;
+static uint8_t  rgb_render_last_iters = 0;
+#endif
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
 
 void eeconfig_force_flush_rgb_matrix(void) {
@@ -311,6 +320,49 @@ static void rgb_task_start(void) {
     rgb_task_state = RENDERING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static void rgb_render_schedule(void) {
+    uint8_t first = 0;
+    uint8_t last  = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        last = k_rgb_matrix_split[0];
+    } else {
+        first = k_rgb_matrix_split[0];
+    }
+#    endif
+
+    if (rgb_effect_params.iter == 0) {
+        rgb_render_led_min = first;
+        if (rgb_effect_params.init) {
+            // start over with a conservative chunk size for a new effect
+            rgb_render_cost = 0;
+        }
+    } else {
+        rgb_render_led_min = rgb_render_led_max;
+    }
+
+    uint8_t count = last > rgb_render_led_min ? last - rgb_render_led_min : 0;
+    if (rgb_render_cost == 0) {
+        if (count > RGB_MATRIX_LED_PROCESS_LIMIT) count = RGB_MATRIX_LED_PROCESS_LIMIT;
+    } else {
+        uint32_t affordable = (uint32_t)RGB_MATRIX_RENDER_BUDGET_US * 16 / rgb_render_cost;
+        if (affordable < count) count = affordable > 0 ? affordable : 1;
+    }
+    rgb_render_led_max = rgb_render_led_min + count;
+}
+
+static void rgb_render_measure(uint32_t elapsed_us) {
+    uint8_t count = rgb_render_led_max - rgb_render_led_min;
+    if (count == 0) return;
+
+    // keep a running average, never reporting a cost of zero once measured
+    uint32_t sample = MIN(elapsed_us, UINT16_MAX) * 16 / count;
+    sample          = MAX(MIN(sample, UINT16_MAX), 1);
+    rgb_render_cost = rgb_render_cost ? (3 * (uint32_t)rgb_render_cost + sample) / 4 : sample;
+}
+#endif
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
@@ -319,6 +371,11 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_schedule();
+    uint32_t render_start = timer_read_us();
+#endif
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -368,10 +425,20 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_measure(timer_elapsed_us(render_start));
+#endif
+
     rgb_effect_params.iter++;
 
     // next task
     if (!rendering) {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+        if (rgb_effect_params.iter != rgb_render_last_iters) {
+            rgb_render_last_iters = rgb_effect_params.iter;
+            dprintf("rgb matrix: effect %u renders in %u iterations, %lu ns per LED\n", effect, rgb_effect_params.iter, (unsigned long)rgb_render_cost * 1000 / 16);
+        }
+#endif
         rgb_task_state = FLUSHING;
         if (!rgb_effect_params.init && effect == RGB_MATRIX_NONE) {
             // We only need to flush once if we are RGB_MATRIX_NONE
@@ -438,7 +505,12 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+    // the scheduler has already sized the chunk for the current iteration
+    (void)iter;
+    limits.led_min_index = rgb_render_led_min;
+    limits.led_max_index = rgb_render_led_max;
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
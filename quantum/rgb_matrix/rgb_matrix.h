@@ -20,6 +20,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "progmem.h"
 #include "rgb_matrix_types.h"
 #include "rgb_matrix_drivers.h"
 #include "color.h"
@@ -291,6 +292,13 @@ extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+// Generated from the LED layout in info.json, instead of being worked out on every frame
+extern const led_geometry_t PROGMEM g_led_geometry[RGB_MATRIX_LED_COUNT];
+#    ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+extern const uint8_t PROGMEM g_led_distance[RGB_MATRIX_LED_COUNT][RGB_MATRIX_LED_COUNT];
+#    endif
+#endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
@@ -75,6 +75,11 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+typedef struct PACKED {
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy) from the center
+    uint8_t angle; // atan2_8(dy, dx) around the center
+} led_geometry_t;
+
 typedef union rgb_config_t {
     uint64_t raw;
     struct PACKED {
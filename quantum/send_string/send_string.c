@@ -24,6 +24,11 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "timer.h"
+#    include "util.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,11 +151,170 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+_Static_assert(SEND_STRING_QUEUE_SIZE > 0 && SEND_STRING_QUEUE_SIZE <= UINT8_MAX, "SEND_STRING_QUEUE_SIZE must be between 1 and 255");
+
+typedef enum send_string_op_t {
+    SEND_STRING_DOWN,
+    SEND_STRING_UP,
+    SEND_STRING_WAIT,
+    SEND_STRING_BELL,
+} send_string_op_t;
+
+typedef struct send_string_entry_t {
+    uint8_t op;
+    uint8_t arg;
+} send_string_entry_t;
+
+static send_string_entry_t queue[SEND_STRING_QUEUE_SIZE];
+static uint8_t             queue_head;
+static uint8_t             queue_count;
+static bool                queueing;
+static uint32_t            report_time = -SEND_STRING_REPORT_INTERVAL; // as if the last report was sent just before boot
+static uint16_t            report_delay; // milliseconds to wait after report_time before the next report
+
+/* Sends the report at the head of the queue, first consuming the delays and
+ * bells in front of it. Returns false without waiting if the report is not due
+ * yet, unless block is set.
+ */
+static bool send_string_step(bool block) {
+    while (queue_count) {
+        send_string_entry_t entry = queue[queue_head];
+        if (entry.op == SEND_STRING_DOWN || entry.op == SEND_STRING_UP) {
+            uint16_t gap     = MAX(report_delay, SEND_STRING_REPORT_INTERVAL);
+            uint32_t elapsed = timer_elapsed32(report_time);
+            if (elapsed < gap) {
+                if (!block) return false;
+                wait_ms(gap - elapsed);
+            }
+        }
+
+        queue_head = (queue_head + 1) % SEND_STRING_QUEUE_SIZE;
+        queue_count--;
+
+        switch (entry.op) {
+            case SEND_STRING_DOWN:
+                register_code(entry.arg);
+                break;
+            case SEND_STRING_UP:
+                unregister_code(entry.arg);
+                break;
+            case SEND_STRING_WAIT:
+                report_delay = MIN((uint32_t)report_delay + entry.arg, UINT16_MAX);
+                continue;
+            case SEND_STRING_BELL:
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+                PLAY_SONG(bell_song);
+#    endif
+                continue;
+        }
+
+        report_time  = timer_read32();
+        report_delay = 0;
+        return true;
+    }
+    return false;
+}
+
+static void send_string_push(send_string_op_t op, uint8_t arg) {
+    if (queue_count == SEND_STRING_QUEUE_SIZE) {
+        // Type the oldest entries synchronously to make room
+        send_string_step(true);
+    }
+    queue[(queue_head + queue_count) % SEND_STRING_QUEUE_SIZE] = (send_string_entry_t){.op = op, .arg = arg};
+    queue_count++;
+}
+
+bool send_string_busy(void) {
+    return queue_count || timer_elapsed32(report_time) < report_delay;
+}
+
+void send_string_flush(void) {
+    while (send_string_step(true)) {
+    }
+
+    uint32_t elapsed = timer_elapsed32(report_time);
+    if (elapsed < report_delay) {
+        wait_ms(report_delay - elapsed);
+    }
+    report_delay = 0;
+}
+
+void send_string_task(void) {
+    send_string_step(false);
+}
+#endif
+
+/* The actions below either happen immediately or, while a string is being
+ * queued, are added to the end of the queue.
+ */
+static void send_string_register(uint8_t keycode) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (queueing) {
+        send_string_push(SEND_STRING_DOWN, keycode);
+        return;
+    }
+#endif
+    register_code(keycode);
+}
+
+static void send_string_unregister(uint8_t keycode) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (queueing) {
+        send_string_push(SEND_STRING_UP, keycode);
+        return;
+    }
+#endif
+    unregister_code(keycode);
+}
+
+static void send_string_wait(uint16_t ms) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (queueing) {
+        while (ms) {
+            uint8_t chunk = MIN(ms, UINT8_MAX);
+            send_string_push(SEND_STRING_WAIT, chunk);
+            ms -= chunk;
+        }
+        return;
+    }
+#endif
+    wait_ms(ms);
+}
+
+static void send_string_tap_delay(uint8_t keycode, uint16_t delay) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (queueing) {
+        send_string_register(keycode);
+        send_string_wait(delay);
+        send_string_unregister(keycode);
+        return;
+    }
+#endif
+    tap_code_delay(keycode, delay);
+}
+
+static void send_string_tap(uint8_t keycode) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (queueing) {
+        send_string_tap_delay(keycode, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+        return;
+    }
+#endif
+    tap_code(keycode);
+}
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (!queueing) {
+        send_string_flush();
+    }
+#endif
+
     while (1) {
         char ascii_code = getter(arg);
         if (!ascii_code) break;
@@ -160,15 +324,15 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = getter(arg);
-                tap_code(keycode);
+                send_string_tap(keycode);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = getter(arg);
-                register_code(keycode);
+                send_string_register(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = getter(arg);
-                unregister_code(keycode);
+                send_string_unregister(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int ms     = 0;
@@ -180,10 +344,10 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
                     ascii_code = getter(arg);
                 }
 
-                wait_ms(ms);
+                send_string_wait(ms);
             }
 
-            wait_ms(interval);
+            send_string_wait(interval);
 
             // if we had a delay that terminated with a null, we're done
             if (ascii_code == 0) break;
@@ -209,13 +373,42 @@ void send_string_with_delay(const char *string, uint8_t interval) {
     send_string_with_delay_impl(send_string_get_next_ram, &state, interval);
 }
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+void send_string_with_delay_async_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    queueing = true;
+    send_string_with_delay_impl(getter, arg, interval);
+    queueing = false;
+}
+
+void send_string_async(const char *string) {
+    send_string_with_delay_async(string, TAP_CODE_DELAY);
+}
+
+void send_string_with_delay_async(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_with_delay_async_impl(send_string_get_next_ram, &state, interval);
+}
+#endif
+
 void send_char(char ascii_code) {
     send_char_with_delay(ascii_code, TAP_CODE_DELAY);
 }
 
 void send_char_with_delay(char ascii_code, uint8_t interval) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (!queueing) {
+        send_string_flush();
+    }
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
+#    ifdef SEND_STRING_ASYNC_ENABLE
+        if (queueing) {
+            send_string_push(SEND_STRING_BELL, 0);
+            return;
+        }
+#    endif
         PLAY_SONG(bell_song);
         return;
     }
@@ -227,31 +420,31 @@ void send_char_with_delay(char ascii_code, uint8_t interval) {
     bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
 
     if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        send_string_register(KC_LEFT_SHIFT);
+        send_string_wait(interval);
     }
 
     if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        send_string_register(KC_RIGHT_ALT);
+        send_string_wait(interval);
     }
 
-    tap_code_delay(keycode, interval);
-    wait_ms(interval);
+    send_string_tap_delay(keycode, interval);
+    send_string_wait(interval);
 
     if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        send_string_unregister(KC_RIGHT_ALT);
+        send_string_wait(interval);
     }
 
     if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        send_string_unregister(KC_LEFT_SHIFT);
+        send_string_wait(interval);
     }
 
     if (is_dead) {
-        tap_code(KC_SPACE);
-        wait_ms(interval);
+        send_string_tap(KC_SPACE);
+        send_string_wait(interval);
     }
 }
 
@@ -329,4 +522,15 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_memory_state_t state = {string};
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
+
+#    ifdef SEND_STRING_ASYNC_ENABLE
+void send_string_async_P(const char *string) {
+    send_string_with_delay_async_P(string, TAP_CODE_DELAY);
+}
+
+void send_string_with_delay_async_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_with_delay_async_impl(send_string_get_next_progmem, &state, interval);
+}
+#    endif
 #endif
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -169,4 +170,99 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief The number of key presses, releases and delays that can wait in the asynchronous queue.
+ *
+ * A string that does not fit is typed synchronously until the rest of it does.
+ */
+#    ifndef SEND_STRING_QUEUE_SIZE
+#        define SEND_STRING_QUEUE_SIZE 64
+#    endif
+
+/**
+ * \brief The minimum time, in milliseconds, between two reports sent from the asynchronous queue.
+ */
+#    ifndef SEND_STRING_REPORT_INTERVAL
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define SEND_STRING_REPORT_INTERVAL USB_POLLING_INTERVAL_MS
+#        else
+#            define SEND_STRING_REPORT_INTERVAL 1
+#        endif
+#    endif
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * This function simply calls `send_string_with_delay_async(string, TAP_CODE_DELAY)`.
+ *
+ * The string is converted to key presses as it is queued, so it does not have to outlive the call. The queue is
+ * drained by `send_string_task()`, one report at a time, so the keyboard keeps scanning while the string is typed.
+ *
+ * \param string The string to type out.
+ */
+void send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background, with a delay between each character.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+void send_string_with_delay_async(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background.
+ *
+ * On ARM devices, this function is simply an alias for send_string_with_delay_async(string, 0).
+ *
+ * \param string The string to type out.
+ */
+void send_string_async_P(const char *string);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_with_delay_async(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+void send_string_with_delay_async_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_P(string) send_string_with_delay_async(string, 0)
+#        define send_string_with_delay_async_P(string, interval) send_string_with_delay_async(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_with_delay_async_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_with_delay_async_P(PSTR(string), 0)
+
+/**
+ * \brief Queues the string returned by the getter function, see send_string_with_delay_impl().
+ */
+void send_string_with_delay_async_impl(char (*getter)(void *), void *arg, uint8_t interval);
+
+/**
+ * \brief Whether queued key presses or their delays are still pending.
+ *
+ * Key events are not processed while this is true, as they would otherwise be typed in the middle of the string.
+ */
+bool send_string_busy(void);
+
+/**
+ * \brief Type out everything still queued, waiting as the synchronous functions do.
+ *
+ * The synchronous functions call this first, so they are typed after anything queued before them.
+ */
+void send_string_flush(void);
+
+/**
+ * \brief Sends the next queued report once its delay has passed. Called from `host_task()`.
+ */
+void send_string_task(void);
+#endif
+
 /** \} */
@@ -0,0 +1,8 @@
+transaction_batch_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSACTION_BATCH_ENABLE
+transaction_batch_INC := $(QUANTUM_PATH)/split_common
+transaction_batch_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_batch.h
+
+transaction_batch_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/transaction_batch_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transaction_batch.c \
+	$(QUANTUM_PATH)/crc.c
@@ -0,0 +1 @@
+TEST_LIST += transaction_batch
@@ -0,0 +1,292 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "transaction_batch.h"
+
+split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
+}
+
+#define sizeof_member(type, member) sizeof(((type *)NULL)->member)
+
+#define trans_initiator2target(member) {sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), 0, 0, NULL}
+#define trans_target2initiator(member) {0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), NULL}
+
+/* Same layout as transactions.c for the features enabled in config_batch.h. */
+static void register_transactions(void) {
+    memset(split_transaction_table, 0, sizeof(split_transaction_table));
+    split_transaction_table[GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator(smatrix.checksum);
+    split_transaction_table[GET_SLAVE_MATRIX_DATA]     = trans_target2initiator(smatrix.matrix);
+    split_transaction_table[PUT_MASTER_MATRIX]         = trans_initiator2target(mmatrix.matrix);
+    split_transaction_table[PUT_SYNC_TIMER]            = trans_initiator2target(sync_timer);
+    split_transaction_table[PUT_LAYER_STATE]           = trans_initiator2target(layers.layer_state);
+    split_transaction_table[PUT_DEFAULT_LAYER_STATE]   = trans_initiator2target(layers.default_layer_state);
+    split_transaction_table[PUT_LED_STATE]             = trans_initiator2target(led_state);
+    split_transaction_table[PUT_MODS]                  = trans_initiator2target(mods);
+    split_transaction_table[EXCHANGE_BATCH]            = {sizeof_member(split_shared_memory_t, batch.m2s), offsetof(split_shared_memory_t, batch.m2s), sizeof_member(split_shared_memory_t, batch.s2m), offsetof(split_shared_memory_t, batch.s2m), NULL};
+}
+
+static uint32_t callbacks = 0;
+
+static void count_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    callbacks++;
+}
+
+enum fault { NONE, DROP_M2S, CORRUPT_M2S, DROP_S2M, CORRUPT_S2M, NUM_FAULTS };
+
+class TransactionBatch : public ::testing::Test {
+   protected:
+    split_shared_memory_t master_mem;
+    split_shared_memory_t slave_mem;
+    uint8_t               master_shadow[offsetof(split_shared_memory_t, batch)];
+    uint8_t               slave_shadow[offsetof(split_shared_memory_t, batch)];
+    split_batch_t         master;
+    split_batch_t         slave;
+
+    // Set by the last exchange
+    bool slave_got_complete;
+    bool master_got_complete;
+
+    void SetUp() override {
+        register_transactions();
+        callbacks = 0;
+        memset(&master_mem, 0, sizeof(master_mem));
+        memset(&slave_mem, 0, sizeof(slave_mem));
+        split_batch_init(&master, &master_mem, master_shadow, true);
+        split_batch_init(&slave, &slave_mem, slave_shadow, false);
+    }
+
+    /* Runs one EXCHANGE_BATCH the way transport.c and the slave callback in
+     * transactions.c do, with the given fault injected on the wire. Returns
+     * what batch_handlers_master() would. */
+    bool exchange(fault f = NONE) {
+        split_batch_frame_t m2s, s2m;
+
+        slave_got_complete  = false;
+        master_got_complete = false;
+
+        split_batch_build(&master, &m2s);
+        if (f == DROP_M2S) return false;
+        slave_mem.batch.m2s = m2s;
+        if (f == CORRUPT_M2S) slave_mem.batch.m2s.data[0] ^= 0x10;
+
+        slave_got_complete = split_batch_receive(&slave, &slave_mem.batch.m2s, &slave_mem.batch.s2m) && (slave_mem.batch.m2s.flags & SPLIT_BATCH_FLAG_COMPLETE);
+        split_batch_build(&slave, &slave_mem.batch.s2m);
+        if (f == DROP_S2M) return false;
+        s2m = slave_mem.batch.s2m;
+        if (f == CORRUPT_S2M) s2m.crc ^= 0x01;
+
+        bool valid          = split_batch_receive(&master, &s2m, &m2s);
+        master_got_complete = valid && (s2m.flags & SPLIT_BATCH_FLAG_COMPLETE);
+        return valid && s2m.ack == m2s.seq;
+    }
+
+    /* Compares every batched region, which is what the per-transaction
+     * transport leaves behind after a successful scan. */
+    bool m2s_in_sync(void) {
+        for (int8_t id = 0; id < EXCHANGE_BATCH; id++) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (memcmp((uint8_t *)&master_mem + trans->initiator2target_offset, (uint8_t *)&slave_mem + trans->initiator2target_offset, trans->initiator2target_buffer_size) != 0) return false;
+        }
+        return true;
+    }
+
+    bool s2m_in_sync(void) {
+        for (int8_t id = 0; id < EXCHANGE_BATCH; id++) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (memcmp((uint8_t *)&master_mem + trans->target2initiator_offset, (uint8_t *)&slave_mem + trans->target2initiator_offset, trans->target2initiator_buffer_size) != 0) return false;
+        }
+        return true;
+    }
+
+    void settle(void) {
+        for (int i = 0; i < 10; i++) {
+            exchange();
+        }
+        ASSERT_TRUE(m2s_in_sync());
+        ASSERT_TRUE(s2m_in_sync());
+    }
+};
+
+TEST_F(TransactionBatch, idle_link_sends_empty_frames) {
+    settle();
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(master_mem.batch.m2s.length, 0);
+    EXPECT_EQ(slave_mem.batch.s2m.length, 0);
+    EXPECT_EQ(slave_mem.batch.m2s.flags, SPLIT_BATCH_FLAG_COMPLETE);
+    EXPECT_EQ(slave_mem.batch.s2m.flags, SPLIT_BATCH_FLAG_COMPLETE);
+}
+
+TEST_F(TransactionBatch, only_changed_bytes_are_sent) {
+    settle();
+
+    uint8_t led_state = 0x02;
+    split_batch_write(&master, PUT_LED_STATE, &led_state, sizeof(led_state));
+    slave_mem.smatrix.matrix[1] = 0x04;
+    slave_mem.smatrix.checksum  = 0x55;
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(slave_mem.batch.m2s.length, SPLIT_BATCH_RECORD_HEADER + 1);
+    EXPECT_EQ(slave_mem.batch.s2m.length, 2 * (SPLIT_BATCH_RECORD_HEADER + 1));
+    EXPECT_EQ(slave_mem.led_state, 0x02);
+    EXPECT_EQ(master_mem.smatrix.matrix[1], 0x04);
+    EXPECT_EQ(master_mem.smatrix.checksum, 0x55);
+
+    // Acknowledged changes are not sent again
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(slave_mem.batch.m2s.length, 0);
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(slave_mem.batch.s2m.length, 0);
+}
+
+TEST_F(TransactionBatch, oversized_change_is_applied_at_once) {
+    settle();
+
+    memset(&master_mem.mmatrix, 0xAA, sizeof(master_mem.mmatrix));
+    memset(&master_mem.layers, 0x55, sizeof(master_mem.layers));
+    memset(&master_mem.mods, 0x0F, sizeof(master_mem.mods));
+    master_mem.sync_timer = 0x12345678;
+    master_mem.led_state  = 0x07;
+
+    // Nothing becomes visible on the slave until the frame that completes the change
+    int frames = 0;
+    do {
+        ASSERT_TRUE(exchange());
+        frames++;
+        if (!slave_got_complete) {
+            EXPECT_EQ(slave_mem.led_state, 0);
+            EXPECT_EQ(slave_mem.mmatrix.matrix[0], 0);
+        }
+    } while (!slave_got_complete && frames < 10);
+    EXPECT_GT(frames, 1);
+    EXPECT_TRUE(m2s_in_sync());
+}
+
+TEST_F(TransactionBatch, exec_runs_callback_until_acknowledged) {
+    settle();
+    split_transaction_table[PUT_LED_STATE].slave_callback = count_callback;
+
+    split_batch_exec(&master, PUT_LED_STATE);
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(callbacks, 1);
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(callbacks, 1);
+
+    // A lost reply means the master sends it again
+    split_batch_exec(&master, PUT_LED_STATE);
+    EXPECT_FALSE(exchange(DROP_S2M));
+    EXPECT_EQ(callbacks, 2);
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(callbacks, 3);
+    EXPECT_TRUE(exchange());
+    EXPECT_EQ(callbacks, 3);
+}
+
+TEST_F(TransactionBatch, restarted_half_gets_everything_again) {
+    master_mem.layers.layer_state = 0x10;
+    slave_mem.smatrix.matrix[0]   = 0x01;
+    settle();
+
+    // Slave reboots and loses its shared memory
+    memset(&slave_mem, 0, sizeof(slave_mem));
+    split_batch_init(&slave, &slave_mem, slave_shadow, false);
+    slave_mem.smatrix.matrix[0] = 0x01;
+    settle();
+    EXPECT_EQ(slave_mem.layers.layer_state, 0x10);
+
+    // Master reboots and loses its shared memory
+    memset(&master_mem, 0, sizeof(master_mem));
+    split_batch_init(&master, &master_mem, master_shadow, true);
+    master_mem.layers.layer_state = 0x10;
+    settle();
+    EXPECT_EQ(master_mem.smatrix.matrix[0], 0x01);
+}
+
+/* Replays random state changes on both halves over a link that loses and
+ * corrupts frames. Every complete frame must leave the receiver with exactly
+ * the sender's regions, which is what the per-transaction transport gives, and
+ * both halves must converge once the link is clean again. */
+TEST_F(TransactionBatch, soak_lossy_link_matches_per_transaction_result) {
+    uint32_t seed = 1;
+    auto     next = [&](uint32_t range) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % range;
+    };
+
+    for (int scan = 0; scan < 100000; scan++) {
+        // Mutate a few random bytes of random regions, like the handlers would
+        for (int8_t id = 0; id < EXCHANGE_BATCH; id++) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (next(100) >= 5) continue;
+            if (trans->initiator2target_buffer_size) {
+                ((uint8_t *)&master_mem)[trans->initiator2target_offset + next(trans->initiator2target_buffer_size)] = next(256);
+            }
+            if (trans->target2initiator_buffer_size) {
+                ((uint8_t *)&slave_mem)[trans->target2initiator_offset + next(trans->target2initiator_buffer_size)] = next(256);
+            }
+        }
+
+        fault f = next(100) < 10 ? (fault)(1 + next(NUM_FAULTS - 1)) : NONE;
+        exchange(f);
+        if (slave_got_complete) {
+            ASSERT_TRUE(m2s_in_sync()) << "scan " << scan;
+        }
+        if (master_got_complete) {
+            ASSERT_TRUE(s2m_in_sync()) << "scan " << scan;
+        }
+    }
+
+    settle();
+}
+
+/* Reports the bytes on the wire for a typical scan pattern, against what the
+ * per-transaction transport sends: a checksum read of the slave matrix every
+ * scan, plus a full write or read for every transaction that changed. Each
+ * transfer costs an extra two bytes for the transaction id and handshake. */
+TEST_F(TransactionBatch, traffic_compared_to_per_transaction) {
+    const uint32_t scans            = 10000;
+    uint32_t       legacy_transfers = 0;
+    uint32_t       legacy_bytes     = 0;
+    uint32_t       seed             = 1;
+    auto           next             = [&](uint32_t range) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % range;
+    };
+
+    settle();
+    for (uint32_t scan = 0; scan < scans; scan++) {
+        split_shared_memory_t before = master_mem;
+
+        legacy_transfers++;
+        legacy_bytes += 2 + 1;
+        if (next(100) < 2) {
+            slave_mem.smatrix.matrix[next(MATRIX_ROWS / 2)] ^= 1 << next(MATRIX_COLS);
+            slave_mem.smatrix.checksum++;
+            legacy_transfers++;
+            legacy_bytes += 2 + sizeof(slave_mem.smatrix.matrix);
+        }
+        if (next(100) < 2) master_mem.mods.real_mods ^= 1 << next(8);
+        if (next(1000) < 5) master_mem.layers.layer_state ^= 1 << next(4);
+        if (scan % 100 == 0) master_mem.sync_timer = scan;
+
+        for (int8_t id = 0; id < EXCHANGE_BATCH; id++) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            uint8_t                  *now   = (uint8_t *)&master_mem + trans->initiator2target_offset;
+            if (trans->initiator2target_buffer_size && memcmp(now, (uint8_t *)&before + trans->initiator2target_offset, trans->initiator2target_buffer_size)) {
+                legacy_transfers++;
+                legacy_bytes += 2 + trans->initiator2target_buffer_size;
+            }
+        }
+        ASSERT_TRUE(exchange());
+    }
+
+    const uint32_t batch_bytes = scans * (2 + 2 * sizeof(split_batch_frame_t));
+    printf("%-18s %10s %10s\n", "", "transfers", "bytes");
+    printf("%-18s %10u %10u\n", "per-transaction", legacy_transfers, legacy_bytes);
+    printf("%-18s %10u %10u\n", "batched", scans, batch_bytes);
+    EXPECT_LT(scans, legacy_transfers);
+}
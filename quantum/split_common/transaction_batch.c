@@ -0,0 +1,255 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+
+#    include <stdint.h>
+#    include <string.h>
+#    include <stddef.h>
+
+#    include "crc.h"
+#    include "util.h"
+#    include "compiler_support.h"
+#    include "transaction_batch.h"
+#    include "transaction_id_define.h"
+
+// The serial transports size their buffers with a uint8_t
+STATIC_ASSERT(sizeof(split_batch_frame_t) <= UINT8_MAX, "SPLIT_TRANSACTION_BATCH_SIZE too large");
+
+#    define SPLIT_BATCH_BIT(id) ((uint32_t)1 << (id))
+
+////////////////////////////////////////////////////
+// Helpers
+
+static bool split_batch_includes(int8_t id) {
+#    ifdef USE_I2C
+    if (id == I2C_EXECUTE_CALLBACK) return false;
+#    endif // USE_I2C
+
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // RPC transfers have runtime sized buffers and keep going out on their own
+#        if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+    if (id >= PUT_RPC_INFO && id < PUT_DETECTED_OS) return false;
+#        else
+    if (id >= PUT_RPC_INFO) return false;
+#        endif
+#    endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+
+    return id != EXCHANGE_BATCH;
+}
+
+static void split_batch_region(const split_batch_t *batch, int8_t id, bool outgoing, uint16_t *offset, uint8_t *size) {
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (outgoing == batch->initiator) {
+        *offset = trans->initiator2target_offset;
+        *size   = trans->initiator2target_buffer_size;
+    } else {
+        *offset = trans->target2initiator_offset;
+        *size   = trans->target2initiator_buffer_size;
+    }
+}
+
+static uint8_t split_batch_crc(const split_batch_frame_t *frame) {
+    return crc8(frame, offsetof(split_batch_frame_t, data) + frame->length);
+}
+
+// Make every outgoing byte differ from its shadow, so that everything is sent again
+static void split_batch_invalidate(split_batch_t *batch) {
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!split_batch_includes(id)) continue;
+        uint16_t offset;
+        uint8_t  size;
+        split_batch_region(batch, id, true, &offset, &size);
+        for (uint8_t i = 0; i < size; i++) {
+            batch->shadow[offset + i] = ~batch->shmem[offset + i];
+        }
+    }
+}
+
+typedef void (*split_batch_record_handler_t)(split_batch_t *batch, int8_t id, uint8_t *region, const uint8_t *data, uint8_t count);
+
+// Walks the records of a frame, skipping any that do not describe a batched region
+static void split_batch_each_record(split_batch_t *batch, const split_batch_frame_t *frame, bool outgoing, split_batch_record_handler_t handler) {
+    uint8_t pos = 0;
+    while (pos + SPLIT_BATCH_RECORD_HEADER <= frame->length) {
+        int8_t  id    = frame->data[pos];
+        uint8_t start = frame->data[pos + 1];
+        uint8_t count = frame->data[pos + 2];
+        pos += SPLIT_BATCH_RECORD_HEADER;
+        if (count > frame->length - pos) break;
+
+        if (id >= 0 && id < NUM_TOTAL_TRANSACTIONS && split_batch_includes(id)) {
+            uint16_t offset;
+            uint8_t  size;
+            split_batch_region(batch, id, outgoing, &offset, &size);
+            if (start + count <= size) {
+                handler(batch, id, &batch->shadow[offset + start], &frame->data[pos], count);
+            }
+        }
+        pos += count;
+    }
+}
+
+static void split_batch_commit_record(split_batch_t *batch, int8_t id, uint8_t *region, const uint8_t *data, uint8_t count) {
+    if (count == 0) {
+        batch->pending_exec &= ~SPLIT_BATCH_BIT(id);
+    } else {
+        memcpy(region, data, count);
+    }
+}
+
+static void split_batch_run_callback(split_batch_t *batch, int8_t id) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (!batch->initiator && trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, batch->shmem + trans->initiator2target_offset, trans->target2initiator_buffer_size, batch->shmem + trans->target2initiator_offset);
+    }
+}
+
+static void split_batch_stage_record(split_batch_t *batch, int8_t id, uint8_t *region, const uint8_t *data, uint8_t count) {
+    if (count == 0) {
+        split_batch_run_callback(batch, id);
+    } else {
+        memcpy(region, data, count);
+        batch->staged |= SPLIT_BATCH_BIT(id);
+    }
+}
+
+////////////////////////////////////////////////////
+// Public API
+
+void split_batch_init(split_batch_t *batch, void *shmem, void *shadow, bool initiator) {
+    memset(batch, 0, sizeof(split_batch_t));
+    batch->shmem     = shmem;
+    batch->shadow    = shadow;
+    batch->initiator = initiator;
+    batch->resync    = true;
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!split_batch_includes(id)) continue;
+        uint16_t offset;
+        uint8_t  size;
+        split_batch_region(batch, id, false, &offset, &size);
+        memcpy(&batch->shadow[offset], &batch->shmem[offset], size);
+    }
+    // Nothing is known about the other half yet
+    split_batch_invalidate(batch);
+}
+
+bool split_batch_write(split_batch_t *batch, int8_t id, const void *data, uint16_t length) {
+    uint16_t offset;
+    uint8_t  size;
+    split_batch_region(batch, id, true, &offset, &size);
+    memcpy(&batch->shmem[offset], data, MIN(size, length));
+    return true;
+}
+
+bool split_batch_read(split_batch_t *batch, int8_t id, void *data, uint16_t length) {
+    uint16_t offset;
+    uint8_t  size;
+    split_batch_region(batch, id, false, &offset, &size);
+    memcpy(data, &batch->shmem[offset], MIN(size, length));
+    return true;
+}
+
+bool split_batch_exec(split_batch_t *batch, int8_t id) {
+    batch->pending_exec |= SPLIT_BATCH_BIT(id);
+    return true;
+}
+
+void split_batch_build(split_batch_t *batch, split_batch_frame_t *frame) {
+    uint8_t *out      = frame->data;
+    uint8_t  length   = 0;
+    bool     complete = true;
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!(batch->pending_exec & SPLIT_BATCH_BIT(id))) continue;
+        if (length + SPLIT_BATCH_RECORD_HEADER > SPLIT_TRANSACTION_BATCH_SIZE) break;
+        out[length++] = id;
+        out[length++] = 0;
+        out[length++] = 0;
+    }
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS && complete; id++) {
+        if (!split_batch_includes(id)) continue;
+        uint16_t offset;
+        uint8_t  size;
+        split_batch_region(batch, id, true, &offset, &size);
+
+        const uint8_t *current = &batch->shmem[offset];
+        const uint8_t *acked   = &batch->shadow[offset];
+        uint8_t        i       = 0;
+        while (i < size) {
+            if (current[i] == acked[i]) {
+                i++;
+                continue;
+            }
+
+            // Bridge short runs of unchanged bytes, a new record header would cost more
+            uint8_t end = i + 1;
+            for (uint8_t j = end; j < size && j < end + SPLIT_BATCH_RECORD_HEADER; j++) {
+                if (current[j] != acked[j]) end = j + 1;
+            }
+
+            uint8_t space = SPLIT_TRANSACTION_BATCH_SIZE - length;
+            if (space <= SPLIT_BATCH_RECORD_HEADER) {
+                complete = false;
+                break;
+            }
+            uint8_t count = MIN(end - i, space - SPLIT_BATCH_RECORD_HEADER);
+            out[length++] = id;
+            out[length++] = i;
+            out[length++] = count;
+            memcpy(&out[length], &current[i], count);
+            length += count;
+            if (count < end - i) {
+                complete = false;
+                break;
+            }
+            i = end;
+        }
+    }
+
+    if (++batch->seq == 0) {
+        batch->seq = 1;
+    }
+    frame->seq    = batch->seq;
+    frame->ack    = batch->received;
+    frame->flags  = (batch->resync ? SPLIT_BATCH_FLAG_RESYNC : 0) | (complete ? SPLIT_BATCH_FLAG_COMPLETE : 0);
+    frame->length = length;
+    frame->crc    = split_batch_crc(frame);
+}
+
+bool split_batch_receive(split_batch_t *batch, const split_batch_frame_t *frame, const split_batch_frame_t *last_sent) {
+    if (frame->seq == 0 || frame->length > SPLIT_TRANSACTION_BATCH_SIZE || frame->crc != split_batch_crc(frame)) {
+        return false;
+    }
+
+    // The other half has what we last sent, so that becomes the baseline for the next delta
+    if (frame->ack != 0 && frame->ack == last_sent->seq) {
+        split_batch_each_record(batch, last_sent, true, &split_batch_commit_record);
+        batch->resync = false;
+    }
+
+    // The other half (re)started and lost its copy of our state
+    if (frame->flags & SPLIT_BATCH_FLAG_RESYNC) {
+        split_batch_invalidate(batch);
+    }
+
+    split_batch_each_record(batch, frame, false, &split_batch_stage_record);
+    if (frame->flags & SPLIT_BATCH_FLAG_COMPLETE) {
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+            if (!(batch->staged & SPLIT_BATCH_BIT(id))) continue;
+            uint16_t offset;
+            uint8_t  size;
+            split_batch_region(batch, id, false, &offset, &size);
+            memcpy(&batch->shmem[offset], &batch->shadow[offset], size);
+            split_batch_run_callback(batch, id);
+        }
+        batch->staged = 0;
+    }
+
+    batch->received = frame->seq;
+    return true;
+}
+
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
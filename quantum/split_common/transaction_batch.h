@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transactions.h"
+#include "transport.h"
+
+/* Batched split transactions.
+ *
+ * Instead of one transfer per transaction, each half sends a single framed,
+ * crc-protected message per exchange. Its payload is a list of records:
+ *
+ *   [id][offset][length][bytes...]  bytes of the transaction's shared memory region
+ *   [id][0][0]                      run the transaction's slave callback
+ *
+ * Data records are the difference between the live region and a shadow of
+ * what the other half last acknowledged, so an idle link carries an empty
+ * frame. Records are applied to a staging copy and only become visible once a
+ * frame flagged SPLIT_BATCH_FLAG_COMPLETE arrives, so readers never see half
+ * of a change that did not fit in one frame.
+ */
+
+#define SPLIT_BATCH_FLAG_RESYNC (1 << 0)   // sender has not yet been acknowledged since it started
+#define SPLIT_BATCH_FLAG_COMPLETE (1 << 1) // no changes were left out of this frame
+
+#define SPLIT_BATCH_RECORD_HEADER 3
+
+typedef struct split_batch_t {
+    uint8_t *shmem;        // live shared memory of this half
+    uint8_t *shadow;       // same layout; acknowledged state of outgoing regions, staged state of incoming ones
+    uint32_t pending_exec; // callbacks waiting to be sent
+    uint32_t staged;       // incoming transactions with staged data
+    uint8_t  seq;          // sequence number of the last frame built
+    uint8_t  received;     // sequence number of the last valid frame received
+    bool     initiator;
+    bool     resync;
+} split_batch_t;
+
+void split_batch_init(split_batch_t *batch, void *shmem, void *shadow, bool initiator);
+
+bool split_batch_write(split_batch_t *batch, int8_t id, const void *data, uint16_t length);
+bool split_batch_read(split_batch_t *batch, int8_t id, void *data, uint16_t length);
+bool split_batch_exec(split_batch_t *batch, int8_t id);
+
+void split_batch_build(split_batch_t *batch, split_batch_frame_t *frame);
+
+// returns false if the frame is corrupt; last_sent is the frame this half sent before
+bool split_batch_receive(split_batch_t *batch, const split_batch_frame_t *frame, const split_batch_frame_t *last_sent);
@@ -120,6 +120,10 @@ enum serial_transaction_id {
     PUT_DETECTED_OS,
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    EXCHANGE_BATCH,
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
     NUM_TOTAL_TRANSACTIONS
 };
 
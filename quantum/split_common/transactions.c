@@ -64,6 +64,9 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+#    include "transaction_batch.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -85,6 +88,22 @@
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+static split_batch_t split_batch;
+static uint8_t       split_batch_shadow[offsetof(split_shared_memory_t, batch)];
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+// Core sync data is exchanged by batch_handlers_master(), the handlers only see the local copy
+#    define sync_write(id, data, length) split_batch_write(&split_batch, id, data, length)
+#    define sync_read(id, data, length) split_batch_read(&split_batch, id, data, length)
+#    define sync_exec(id) split_batch_exec(&split_batch, id)
+#else // SPLIT_TRANSACTION_BATCH_ENABLE
+#    define sync_write(id, data, length) transport_write(id, data, length)
+#    define sync_read(id, data, length) transport_read(id, data, length)
+#    define sync_exec(id) transport_exec(id)
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -96,6 +115,10 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
     int num_retries = is_transport_connected() ? 10 : 1;
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    // Only the exchange touches the wire, retrying anything else cannot change the outcome
+    if (handler != &batch_handlers_master) num_retries = 1;
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
             for (int i = 0; i < iter * iter; ++i) {
@@ -143,9 +166,9 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
 
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
-    bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
+    bool    okay = sync_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
-        okay &= transport_read(trans_id_retrieve, destination, length);
+        okay &= sync_read(trans_id_retrieve, destination, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
             *last_update = timer_read32();
@@ -159,7 +182,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= sync_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -246,13 +269,14 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
             bool    actioned = false;
             uint8_t index;
             bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
+            // Dequeue from the copy, the shared memory has to keep matching the checksum it was received with
+            while (okay && encoder_dequeue_event_advanced(&temp_events, &index, &clockwise)) {
                 okay &= encoder_queue_event(index, clockwise);
                 actioned = true;
             }
 
             if (actioned) {
-                okay &= transport_exec(CMD_ENCODER_DRAIN);
+                okay &= sync_exec(CMD_ENCODER_DRAIN);
             }
             last_checksum = split_shmem->encoders.checksum;
         }
@@ -299,7 +323,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= sync_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
             last_update = timer_read32();
         }
@@ -424,7 +448,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= sync_write(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
         }
@@ -790,7 +814,7 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 static bool watchdog_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     bool okay = true;
     if (!split_watchdog_check()) {
-        okay = transport_write(PUT_WATCHDOG, &okay, sizeof(okay));
+        okay = sync_write(PUT_WATCHDOG, &okay, sizeof(okay));
         split_watchdog_update(okay);
     }
     return okay;
@@ -911,6 +935,52 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batch
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+
+static void batch_init(bool initiator) {
+    if (!split_batch.shmem) {
+        split_batch_init(&split_batch, split_shmem, split_batch_shadow, initiator);
+    }
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_batch_frame_t m2s;
+    split_batch_frame_t s2m;
+
+    batch_init(true);
+    split_batch_build(&split_batch, &m2s);
+    if (!transport_execute_transaction(EXCHANGE_BATCH, &m2s, sizeof(m2s), &s2m, sizeof(s2m))) {
+        return false;
+    }
+    // A valid reply that doesn't acknowledge this frame means the slave never got it
+    return split_batch_receive(&split_batch, &s2m, &m2s) && s2m.ack == m2s.seq;
+}
+
+static void batch_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    batch_init(false);
+    // The reply buffer still holds the previous reply, which the new frame may acknowledge
+    split_batch_receive(&split_batch, initiator2target_buffer, target2initiator_buffer);
+    split_batch_build(&split_batch, target2initiator_buffer);
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_SLAVE()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [EXCHANGE_BATCH] = {sizeof_member(split_shared_memory_t, batch.m2s), offsetof(split_shared_memory_t, batch.m2s), sizeof_member(split_shared_memory_t, batch.s2m), offsetof(split_shared_memory_t, batch.s2m), batch_handlers_slave_exchange},
+// clang-format on
+
+#else // SPLIT_TRANSACTION_BATCH_ENABLE
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_SLAVE()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -941,6 +1011,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -952,6 +1023,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_BATCH_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -994,6 +1066,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_BATCH_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
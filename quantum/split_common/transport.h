@@ -147,6 +147,26 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+#    ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#        define SPLIT_TRANSACTION_BATCH_SIZE 16
+#    endif // SPLIT_TRANSACTION_BATCH_SIZE
+
+typedef struct _split_batch_frame_t {
+    uint8_t seq;    // sequence number of this frame, never 0
+    uint8_t ack;    // sequence number of the last valid frame received, 0 if none
+    uint8_t flags;  // SPLIT_BATCH_FLAG_*
+    uint8_t length; // number of used bytes in data
+    uint8_t data[SPLIT_TRANSACTION_BATCH_SIZE];
+    uint8_t crc; // crc8 of the header and the used data
+} split_batch_frame_t;
+
+typedef struct _split_batch_sync_t {
+    split_batch_frame_t m2s;
+    split_batch_frame_t s2m;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -231,6 +251,11 @@ typedef struct _split_shared_memory_t {
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
     os_variant_t detected_os;
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    // Must stay last, everything before it is covered by the batch shadow copy
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
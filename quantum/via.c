@@ -65,6 +65,14 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(LATENCY_TRACE_ENABLE)
+#    include "latency_trace.h"
+#endif
+
+#if defined(PROFILER_ENABLE)
+#    include "profiler.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -297,6 +305,19 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         return;
     }
 
+#if defined(LATENCY_TRACE_ENABLE)
+    if (latency_trace_raw_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
+#endif
+
+#if defined(PROFILER_ENABLE)
+    if (profiler_raw_hid_receive(data, length)) {
+        return;
+    }
+#endif
+
     switch (*command_id) {
         case id_get_protocol_version: {
             command_data[0] = VIA_PROTOCOL_VERSION >> 8;
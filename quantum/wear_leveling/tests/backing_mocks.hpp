@@ -83,6 +83,8 @@ class MockBackingStore {
     storage_t backing_storage;
     // The number of erase cycles that have occurred
     std::uint64_t backing_erasure_count;
+    // The number of bytes erased by range erases
+    std::uint64_t backing_erased_range_bytes;
     // The max number of writes to an element of the backing store
     std::uint64_t backing_max_write_count;
     // The total number of writes to all elements of the backing store
@@ -94,12 +96,16 @@ class MockBackingStore {
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_range_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
 
+    // The number of reads, which are invoked through a const API
+    mutable std::uint64_t backing_read_invoke_count;
+
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
-    // Whether erase should succeed
+    // Whether erase should succeed, invoked for each element erased
     std::function<bool(std::uint64_t)> erase_success_callback;
     // Whether unlocks should succeed
     std::function<bool(std::uint64_t)> unlock_success_callback;
@@ -124,6 +130,9 @@ class MockBackingStore {
     std::uint64_t erasure_count() const {
         return backing_erasure_count;
     }
+    std::uint64_t erased_range_bytes() const {
+        return backing_erased_range_bytes;
+    }
     std::uint64_t max_write_count() const {
         return backing_max_write_count;
     }
@@ -141,12 +150,18 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_range_invoke_count() const {
+        return backing_erase_range_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,6 +174,7 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::size_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
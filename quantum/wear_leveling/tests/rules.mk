@@ -64,3 +64,83 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_incremental_2byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=256 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_INCREMENTAL_CONSOLIDATION \
+	-DBACKING_STORE_ERASE_SIZE=32 \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=8 \
+	-DWEAR_LEVELING_CONSOLIDATION_RESERVE=32
+wear_leveling_incremental_2byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_incremental.cpp
+wear_leveling_incremental_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_incremental_8byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=256 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_INCREMENTAL_CONSOLIDATION \
+	-DBACKING_STORE_ERASE_SIZE=32 \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=8 \
+	-DWEAR_LEVELING_CONSOLIDATION_RESERVE=32
+wear_leveling_incremental_8byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_incremental.cpp
+wear_leveling_incremental_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_checkpoint_2byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=512
+wear_leveling_checkpoint_2byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_checkpoint.cpp
+wear_leveling_checkpoint_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_checkpoint_4byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=512
+wear_leveling_checkpoint_4byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_checkpoint.cpp
+wear_leveling_checkpoint_4byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_checkpoint_8byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=512
+wear_leveling_checkpoint_8byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_checkpoint.cpp
+wear_leveling_checkpoint_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_checkpoint_incremental_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=512 \
+	-DWEAR_LEVELING_INCREMENTAL_CONSOLIDATION \
+	-DBACKING_STORE_ERASE_SIZE=1024
+wear_leveling_checkpoint_incremental_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_checkpoint.cpp
+wear_leveling_checkpoint_incremental_INC := \
+	$(wear_leveling_common_INC)
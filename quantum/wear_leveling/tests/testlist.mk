@@ -3,4 +3,10 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_incremental_2byte \
+	wear_leveling_incremental_8byte \
+	wear_leveling_checkpoint_2byte \
+	wear_leveling_checkpoint_4byte \
+	wear_leveling_checkpoint_8byte \
+	wear_leveling_checkpoint_incremental
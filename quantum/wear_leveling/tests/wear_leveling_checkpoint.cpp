@@ -0,0 +1,165 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <string>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingCheckpoint : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        wear_leveling_status_t status = wear_leveling_write(address, value, length);
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+        // Give any pending consolidation a few steps in between writes
+        while (status == WEAR_LEVELING_SUCCESS && rng() % 4) {
+            status = wear_leveling_task();
+        }
+#endif
+        return status;
+    }
+
+    // Writes a few bytes, mostly within a small part of the logical data like settings which are changed often
+    wear_leveling_status_t random_write(void) {
+        const std::size_t   length  = 1 + rng() % 4;
+        const std::uint32_t area    = rng() % 8 ? 128 : WEAR_LEVELING_LOGICAL_SIZE;
+        const std::uint32_t address = rng() % (area - length);
+        std::uint8_t        value[4];
+        for (auto& v : value) {
+            v = rng();
+        }
+        return test_write(address, value, length);
+    }
+
+    void verify_readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        wear_leveling_read(0, readback.data(), readback.size());
+        EXPECT_EQ(readback, verify_data) << "Read back data did not match what was written";
+    }
+
+    std::mt19937 rng{0x514B};
+};
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+static const std::size_t bank_size   = WEAR_LEVELING_BACKING_SIZE / 2;
+static const std::size_t header_size = 16;
+#else
+static const std::size_t bank_size   = WEAR_LEVELING_BACKING_SIZE;
+static const std::size_t header_size = 8;
+#endif
+
+// Layout of each bank, the checkpoint index follows the header
+static const std::size_t index_start = WEAR_LEVELING_LOGICAL_SIZE + header_size;
+static const std::size_t index_size  = (bank_size - index_start) / WEAR_LEVELING_CHECKPOINT_INTERVAL * BACKING_STORE_WRITE_SIZE;
+static const std::size_t log_size    = bank_size - index_start - index_size;
+
+#ifndef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * This benchmark records how long startup takes as the write log fills up, alongside the number of reads playing back
+ * the whole write log would take.
+ */
+TEST_F(WearLevelingCheckpoint, InitTimeAgainstLogFill) {
+    auto& inst = MockBackingStore::Instance();
+    RecordProperty("log_size", (int)log_size);
+
+    std::uint64_t empty_reads = 0;
+    for (int fill = 0; fill <= 90; fill += 10) {
+        inst.reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        while (inst.total_write_count() * BACKING_STORE_WRITE_SIZE < log_size * fill / 100) {
+            ASSERT_EQ(random_write(), WEAR_LEVELING_SUCCESS) << "Write log filled up before reaching " << fill << "%";
+        }
+
+        const std::uint64_t reads = inst.read_invoke_count();
+        wear_leveling_init();
+        const std::uint64_t init_reads = inst.read_invoke_count() - reads;
+        verify_readback();
+        if (fill == 0) {
+            empty_reads = init_reads;
+        }
+
+        const int  iterations = 100;
+        const auto start      = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            wear_leveling_init();
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start) / iterations;
+        // Every write so far went to the write log, bar the few to the checkpoint index
+        const std::uint64_t full_reads = empty_reads + inst.total_write_count();
+        const std::string   prefix     = "fill_" + std::to_string(fill) + "_";
+        RecordProperty(prefix + "init_reads", (int)init_reads);
+        RecordProperty(prefix + "init_ns", (int)elapsed.count());
+        RecordProperty(prefix + "full_log_reads", (int)full_reads);
+
+        EXPECT_LE(init_reads - empty_reads, inst.total_write_count() / 2 + WEAR_LEVELING_CHECKPOINT_INTERVAL / BACKING_STORE_WRITE_SIZE) << "Playback did not start from a checkpoint at " << fill << "%";
+    }
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+/**
+ * This test verifies that playing back the write log from the newest checkpoint restores everything written, across
+ * several consolidations.
+ */
+TEST_F(WearLevelingCheckpoint, PlaybackFromCheckpointMatches) {
+    int consolidations = 0;
+    for (int i = 0; i < 20000; ++i) {
+        wear_leveling_status_t status = random_write();
+        ASSERT_NE(status, WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            ++consolidations;
+        }
+        if (i % 97 == 0) {
+            wear_leveling_init();
+            verify_readback();
+        }
+    }
+    EXPECT_GT(consolidations, 2) << "Write log was never consolidated";
+
+    wear_leveling_init();
+    verify_readback();
+}
+
+/**
+ * This test verifies that a checkpoint which did not make it into the index is ignored on startup, with playback
+ * starting from the previous checkpoint instead.
+ */
+TEST_F(WearLevelingCheckpoint, IncompleteCheckpointIsIgnored) {
+    auto& inst       = MockBackingStore::Instance();
+    bool  fail_index = false;
+    bool  failed     = false;
+    inst.set_write_callback([&](std::uint64_t, std::uint32_t address) {
+        if (fail_index && address % bank_size >= index_start && address % bank_size < index_start + index_size) {
+            failed = true;
+            return false;
+        }
+        return true;
+    });
+
+    for (int i = 0; i < 2000 && !failed; ++i) {
+        // Let the first few checkpoints through before cutting the power while writing one
+        fail_index = i > 500;
+        random_write();
+    }
+    EXPECT_TRUE(failed) << "Checkpoint index was never written";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    wear_leveling_init();
+    verify_readback();
+
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_NE(random_write(), WEAR_LEVELING_FAILED) << "Write failed after power loss";
+    }
+    wear_leveling_init();
+    verify_readback();
+}
@@ -0,0 +1,245 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingIncremental : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        wear_leveling_read(0, readback.data(), readback.size());
+        EXPECT_EQ(readback, verify_data) << "Read back data did not match what was written";
+    }
+};
+
+// Longest step of a consolidation, the bigger of a copy step and writing the bank header
+static const std::size_t max_step_writes = std::max<std::size_t>(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE, 16) / BACKING_STORE_WRITE_SIZE;
+
+struct Pause {
+    std::uint64_t writes;
+    std::uint64_t erased_bytes;
+    std::uint64_t full_erases;
+};
+
+// Counts the backing store work done by the supplied call
+template <typename F>
+static Pause measure(F&& f) {
+    auto&       inst   = MockBackingStore::Instance();
+    const Pause before = {inst.total_write_count(), inst.erased_range_bytes(), inst.erase_invoke_count()};
+    f();
+    return {inst.total_write_count() - before.writes, inst.erased_range_bytes() - before.erased_bytes, inst.erase_invoke_count() - before.full_erases};
+}
+
+/**
+ * This test verifies that filling the write log moves the data over to the other bank a step at a time, with no step
+ * erasing or writing more than its share of the backing store.
+ */
+TEST_F(WearLevelingIncremental, ConsolidationPauseIsBounded) {
+    std::size_t consolidations = 0;
+    for (std::uint8_t i = 1; i < 200; ++i) {
+        const std::uint8_t value[2] = {i, (std::uint8_t)(i * 7)};
+        Pause              pause    = measure([&] { EXPECT_EQ(test_write((i * 3) % (WEAR_LEVELING_LOGICAL_SIZE - 1), value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status"; });
+        EXPECT_LE(pause.writes, 8 / BACKING_STORE_WRITE_SIZE) << "Write took more than one log entry";
+        EXPECT_EQ(pause.erased_bytes, 0) << "Write erased the backing store";
+        EXPECT_EQ(pause.full_erases, 0) << "Write erased the backing store";
+
+        for (int step = 0; step < 4; ++step) {
+            pause = measure([&] {
+                if (wear_leveling_task() == WEAR_LEVELING_CONSOLIDATED) {
+                    ++consolidations;
+                }
+            });
+            EXPECT_LE(pause.writes, max_step_writes) << "Consolidation step wrote too much";
+            EXPECT_LE(pause.erased_bytes, BACKING_STORE_ERASE_SIZE) << "Consolidation step erased too much";
+            EXPECT_EQ(pause.full_erases, 0) << "Consolidation step erased the whole backing store";
+        }
+        verify_readback();
+    }
+    EXPECT_GT(consolidations, 2) << "Write log was never consolidated";
+
+    // Both banks have been used, the newest one needs to be picked up after a restart
+    wear_leveling_init();
+    verify_readback();
+}
+
+/**
+ * This test verifies that writes made while the data is copied to the other bank are carried over to it, including
+ * ones to data that has already been copied.
+ */
+TEST_F(WearLevelingIncremental, WritesDuringConsolidationAreKept) {
+    // Fill the write log up to where consolidation starts
+    std::uint8_t value   = 0;
+    auto         started = [] {
+        Pause pause = measure([] { wear_leveling_task(); });
+        return pause.writes > 0 || pause.erased_bytes > 0;
+    };
+    while (!started()) {
+        ++value;
+        test_write(value % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    }
+
+    wear_leveling_status_t status;
+    std::uint8_t           address = 0;
+    int                    step    = 0;
+    do {
+        // Alternate between the start and end of the logical data, so that both copied and uncopied data is changed
+        if (++step % 4 == 0) {
+            ++value;
+            address = (WEAR_LEVELING_LOGICAL_SIZE - 1) - address;
+            EXPECT_EQ(test_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+        status = wear_leveling_task();
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Consolidation did not complete";
+
+    verify_readback();
+    wear_leveling_init();
+    verify_readback();
+}
+
+/**
+ * This test verifies that a write log which fills up before consolidation has a chance to complete gets consolidated
+ * in one go, without erasing the bank holding the live data.
+ */
+TEST_F(WearLevelingIncremental, LogOverflowConsolidatesInOneGo) {
+    auto&                  inst   = MockBackingStore::Instance();
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (std::uint8_t value = 1; status == WEAR_LEVELING_SUCCESS; ++value) {
+        status = test_write(value % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    }
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Whole backing store was erased";
+    EXPECT_EQ(inst.erased_range_bytes(), WEAR_LEVELING_BACKING_SIZE / 2) << "Other bank was not erased";
+
+    wear_leveling_init();
+    verify_readback();
+}
+
+// Stores raw bytes as if they had been written to the backing store
+static void store_raw(std::uint32_t address, const void* data, std::size_t length) {
+    auto& inst = MockBackingStore::Instance();
+    for (std::size_t i = 0; i < length; i += sizeof(backing_store_int_t)) {
+        backing_store_int_t value;
+        memcpy(&value, (const std::uint8_t*)data + i, sizeof(value));
+        (inst.storage_begin() + (address + i) / sizeof(backing_store_int_t))->set(~value);
+    }
+}
+
+/**
+ * This test verifies that data stored in the single bank layout, from before incremental consolidation was turned on,
+ * is moved into the dual bank layout on startup, including log entries past the middle of the backing store.
+ */
+TEST_F(WearLevelingIncremental, SingleBankLayoutIsMigrated) {
+    for (std::size_t i = 0; i < verify_data.size(); ++i) {
+        verify_data[i] = i * 5 + 1;
+    }
+    store_raw(0, verify_data.data(), verify_data.size());
+    const std::uint64_t hash = fnv_64a_buf(verify_data.data(), verify_data.size(), FNV1A_64_INIT);
+    store_raw(WEAR_LEVELING_LOGICAL_SIZE, &hash, sizeof(hash));
+
+    std::uint8_t value = 0;
+    for (std::uint32_t address = WEAR_LEVELING_LOGICAL_SIZE + 8; address < WEAR_LEVELING_BACKING_SIZE / 2 + 8; address += 8) {
+        const std::uint32_t offset = (value * 3) % (WEAR_LEVELING_LOGICAL_SIZE - LOG_ENTRY_MULTIBYTE_MAX_BYTES);
+        write_log_entry_t   entry  = LOG_ENTRY_MAKE_MULTIBYTE(offset, LOG_ENTRY_MULTIBYTE_MAX_BYTES);
+        for (int i = 0; i < LOG_ENTRY_MULTIBYTE_MAX_BYTES; ++i) {
+            entry.raw8[3 + i] = verify_data[offset + i] = ++value;
+        }
+        store_raw(address, entry.raw8, sizeof(entry.raw8));
+    }
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+
+    // The migrated data is picked up again, and can be written to
+    wear_leveling_init();
+    verify_readback();
+    value = 0xAA;
+    EXPECT_EQ(test_write(3, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    wear_leveling_init();
+    verify_readback();
+}
+
+/**
+ * This test cuts the power after a random number of backing store operations, then verifies that every completed
+ * write survives the restart and that the store can still be written to.
+ *
+ * A log entry takes more than one backing store write unless writes are 8 bytes wide, so with narrower writes the
+ * power is only cut during consolidation steps.
+ */
+TEST_F(WearLevelingIncremental, RandomPowerLoss) {
+    auto&        inst = MockBackingStore::Instance();
+    std::mt19937 rng(0x514B);
+
+    for (int run = 0; run < 500; ++run) {
+        inst.reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+
+        bool          powered       = true;
+        bool          consolidating = false;
+        std::uint64_t operations    = 0;
+        std::uint64_t power_loss    = 1 + rng() % 600;
+        auto          power         = [&] {
+            if (powered && (BACKING_STORE_WRITE_SIZE == 8 || consolidating) && ++operations >= power_loss) {
+                powered = false;
+            }
+            return powered;
+        };
+        inst.set_write_callback([&](std::uint64_t, std::uint32_t) { return power(); });
+        inst.set_erase_callback([&](std::uint64_t) { return power(); });
+
+        // Whatever was being written when the power went out may or may not have made it
+        std::uint32_t                                        pending_address = 0;
+        std::uint8_t                                         pending_value   = 0;
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> before          = verify_data;
+        while (powered) {
+            if (rng() % 2) {
+                pending_address = rng() % WEAR_LEVELING_LOGICAL_SIZE;
+                pending_value   = rng();
+                before          = verify_data;
+                if (wear_leveling_write(pending_address, &pending_value, 1) != WEAR_LEVELING_FAILED) {
+                    verify_data[pending_address] = pending_value;
+                }
+            } else {
+                consolidating = true;
+                wear_leveling_task();
+                consolidating = false;
+            }
+        }
+
+        inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+        inst.set_erase_callback([](std::uint64_t) { return true; });
+        wear_leveling_init();
+
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        wear_leveling_read(0, readback.data(), readback.size());
+        if (readback != verify_data) {
+            before[pending_address] = pending_value;
+            EXPECT_EQ(readback, before) << "Data was lost after power loss in run " << run;
+        }
+        verify_data = readback;
+
+        // Keep going from where the power came back
+        for (std::uint8_t i = 0; i < 40; ++i) {
+            EXPECT_NE(test_write(rng() % WEAR_LEVELING_LOGICAL_SIZE, &i, sizeof(i)), WEAR_LEVELING_FAILED) << "Write failed after power loss in run " << run;
+            wear_leveling_task();
+        }
+        wear_leveling_init();
+        verify_readback();
+    }
+}
@@ -154,7 +154,95 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Incremental consolidation:
+
+        If WEAR_LEVELING_INCREMENTAL_CONSOLIDATION is defined, the backing
+        store is split into two equally-sized banks, each laid out as above.
+        The FNV1a_64 hash is followed by the bank's sequence number, padded to
+        8 bytes and included in the hash, so that the newest intact bank can be
+        picked on startup.
+
+        Once less than WEAR_LEVELING_CONSOLIDATION_RESERVE bytes of the live
+        bank's write log are left, wear_leveling_task() moves the data across
+        to the other bank, one bounded step per invocation:
+            * The other bank is erased, BACKING_STORE_ERASE_SIZE at a time.
+            * The cache is copied into its consolidated data area,
+                WEAR_LEVELING_CONSOLIDATION_STEP_SIZE bytes at a time.
+            * Log entries appended to the live bank since the copy started are
+                carried over to its write log, covering changes to data which
+                had already been copied.
+            * The sequence number and hash are written last. Until then the
+                other bank fails its checksum and the live bank is used on
+                startup, so a power loss at any point does not lose data.
+
+        Writes keep being logged to the live bank in the meantime. If its log
+        fills up before the move completes, it is finished in one go.
+
+        A backing store still laid out as a single bank, from before the
+        option was turned on, is recognised on startup by its plain FNV1a_64
+        hash. Its write log is played back and the result consolidated into
+        the second bank, which then becomes the live bank.
+
+    Checkpoints:
+
+        If WEAR_LEVELING_CHECKPOINT_INTERVAL is defined, an index of
+        checkpoints sits between the header and the write log, one write unit
+        per checkpoint, holding the offset within the bank of the log entry the
+        checkpoint starts at.
+
+        The cache keeps track of which 4-byte regions differ from the
+        consolidated data. Once WEAR_LEVELING_CHECKPOINT_INTERVAL bytes have
+        been logged since the last checkpoint, the current values of all those
+        regions are appended to the write log as regular log entries, and the
+        offset of the first one is then appended to the index. Everything
+        logged before it is superseded, so on startup playback begins at the
+        newest checkpoint in the index instead of the start of the write log.
+
+        A checkpoint is skipped if it would take up more than half of the log
+        written since the last one, as it would not shorten playback by much.
+        If the power is lost before the index is updated, the entries already
+        written are simply played back on top of the previous checkpoint. */
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    define WEAR_LEVELING_HEADER_SIZE 16 // FNV1a_64 of the consolidated area, then the sequence number of the bank
+#    define WEAR_LEVELING_BANK_ADDRESS (wear_leveling.bank_address)
+
+/**
+ * Progress of an incremental consolidation into the other bank.
+ */
+typedef enum wear_leveling_phase_t {
+    CONSOLIDATION_IDLE = 0,
+    CONSOLIDATION_ERASE, // Erasing the other bank
+    CONSOLIDATION_COPY,  // Copying the cache into the other bank's consolidated area
+    CONSOLIDATION_LOG,   // Carrying over log entries written since the copy started, then committing the other bank
+} wear_leveling_phase_t;
+#else
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+#    define WEAR_LEVELING_HEADER_SIZE 8 // FNV1a_64 of the consolidated area
+#    define WEAR_LEVELING_BANK_ADDRESS 0
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+#    define WEAR_LEVELING_CHECKPOINT_SLOTS (((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE) - (WEAR_LEVELING_HEADER_SIZE)) / (WEAR_LEVELING_CHECKPOINT_INTERVAL))
+#    define WEAR_LEVELING_INDEX_SIZE ((WEAR_LEVELING_CHECKPOINT_SLOTS) * (BACKING_STORE_WRITE_SIZE))
+#    define WEAR_LEVELING_DIRTY_REGION_SIZE 4
+#    define WEAR_LEVELING_DIRTY_REGIONS (((WEAR_LEVELING_LOGICAL_SIZE) + (WEAR_LEVELING_DIRTY_REGION_SIZE) - 1) / (WEAR_LEVELING_DIRTY_REGION_SIZE))
+#    define WEAR_LEVELING_CHECKPOINT_ENTRY_SIZE 8 // Largest amount of write log needed per dirty region
+
+STATIC_ASSERT(WEAR_LEVELING_CHECKPOINT_SLOTS > 0, "Checkpoint interval must be smaller than the write log");
+#    if BACKING_STORE_WRITE_SIZE == 2
+STATIC_ASSERT((WEAR_LEVELING_BANK_SIZE) / 2 <= 0xFFFF, "Checkpoint offsets must fit into a single write unit");
+#    endif
+#else
+#    define WEAR_LEVELING_INDEX_SIZE 0
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
+#define WEAR_LEVELING_INDEX_START(bank) ((bank) + (WEAR_LEVELING_LOGICAL_SIZE) + (WEAR_LEVELING_HEADER_SIZE))
+#define WEAR_LEVELING_LOG_START(bank) (WEAR_LEVELING_INDEX_START(bank) + (WEAR_LEVELING_INDEX_SIZE))
+#define WEAR_LEVELING_BANK_END(bank) ((bank) + (WEAR_LEVELING_BANK_SIZE))
 
 /**
  * Storage area for the wear-leveling cache.
@@ -163,6 +251,20 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    uint32_t              bank_address;   // Start of the live bank
+    uint32_t              sequence;       // Sequence number of the live bank
+    wear_leveling_phase_t phase;          // Progress of the consolidation into the other bank
+    uint32_t              position;       // Next offset within the other bank to erase or copy
+    uint32_t              log_address;    // Next live log entry to carry over to the other bank
+    uint32_t              target_address; // Next write log location within the other bank
+    uint64_t              hash;           // FNV1a_64 of the data copied to the other bank so far
+#endif
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    uint32_t checkpoint_address;                             // Log entry playback starts at, the newest checkpoint
+    uint32_t checkpoint_count;                               // Number of checkpoints in the live bank's index
+    uint8_t  dirty[((WEAR_LEVELING_DIRTY_REGIONS) + 7) / 8]; // Regions differing from the consolidated data
+#endif
 } wear_leveling;
 
 /**
@@ -198,14 +300,298 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
     return STATUS_SUCCESS;
 }
 
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+/**
+ * Flags the regions covering the supplied range of logical data as differing from the consolidated data.
+ */
+static void wear_leveling_mark_dirty(uint32_t address, size_t length) {
+    const uint32_t last = (address + length - 1) / (WEAR_LEVELING_DIRTY_REGION_SIZE);
+    for (uint32_t region = address / (WEAR_LEVELING_DIRTY_REGION_SIZE); region <= last; ++region) {
+        wear_leveling.dirty[region / 8] |= 1 << (region % 8);
+    }
+}
+
+/**
+ * Checks whether a region differs from the consolidated data.
+ */
+static inline bool wear_leveling_is_dirty(uint32_t region) {
+    return (wear_leveling.dirty[region / 8] >> (region % 8)) & 1;
+}
+
+/**
+ * Starts the live bank's write log over without any checkpoints, e.g. after consolidation.
+ */
+static void wear_leveling_reset_checkpoints(void) {
+    wear_leveling.checkpoint_address = WEAR_LEVELING_LOG_START(WEAR_LEVELING_BANK_ADDRESS);
+    wear_leveling.checkpoint_count   = 0;
+}
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
 /**
  * Resets the cache, ensuring the write address is correctly initialised.
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    wear_leveling.bank_address = 0;
+    wear_leveling.sequence     = 0;
+    wear_leveling.phase        = CONSOLIDATION_IDLE;
+#endif
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START(WEAR_LEVELING_BANK_ADDRESS);
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    memset(wear_leveling.dirty, 0, sizeof(wear_leveling.dirty));
+    wear_leveling_reset_checkpoints();
+#endif
 }
 
+/**
+ * Reads an 8-byte value from the header following the consolidated data.
+ */
+static bool wear_leveling_read_header(uint32_t address, uint64_t *value) {
+    write_log_entry_t entry;
+#if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_read_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_read_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_read(address, &entry.raw64);
+#endif
+    *value = entry.raw64;
+    return ok;
+}
+
+/**
+ * Writes an 8-byte value to the header following the consolidated data.
+ */
+static bool wear_leveling_write_header(uint32_t address, uint64_t value) {
+    write_log_entry_t entry = {.raw64 = value};
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry.raw64);
+#endif
+}
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+static wear_leveling_status_t wear_leveling_playback_range(uint32_t address, uint32_t end);
+static wear_leveling_status_t wear_leveling_consolidate_force(void);
+
+/**
+ * Computes the hash stored in a bank's header from the hash of its consolidated data.
+ */
+static uint64_t wear_leveling_bank_hash(uint64_t hash, uint32_t sequence) {
+    return fnv_64a_buf(&sequence, sizeof(sequence), hash);
+}
+
+/**
+ * Reads the consolidated data of a bank from the backing store into the cache.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_read_bank(uint32_t bank, bool *intact, uint32_t *sequence) {
+    if (!backing_store_read_bulk(bank, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    uint64_t header;
+    uint64_t checksum;
+    if (!wear_leveling_read_header(bank + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &header) || !wear_leveling_read_header(bank + (WEAR_LEVELING_LOGICAL_SIZE), &checksum)) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    *sequence = (uint32_t)header;
+    *intact   = checksum == wear_leveling_bank_hash(fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT), *sequence);
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Checks whether bank 0 holds the layout used without incremental consolidation: the consolidated data, followed by
+ * its plain FNV1a_64 hash and a write log spanning the rest of the backing store.
+ * Pre-condition: the cache holds the consolidated data of bank 0.
+ */
+static bool wear_leveling_is_single_bank(void) {
+    uint64_t checksum;
+    return wear_leveling_read_header((WEAR_LEVELING_LOGICAL_SIZE), &checksum) && checksum == fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+}
+
+/**
+ * Replays the write log of the single bank layout, then moves the result into bank 1 as its first consolidation.
+ * The old log may run into bank 1, so a power loss before bank 1 is committed loses the entries stored there.
+ */
+static wear_leveling_status_t wear_leveling_migrate_single_bank(void) {
+    wl_dprintf("Migrating the single bank layout\n");
+
+    // A corrupted entry ends the old log, as it would have on playback, keeping what was read up to there
+    wear_leveling_playback_range((WEAR_LEVELING_LOGICAL_SIZE) + 8, (WEAR_LEVELING_BACKING_SIZE));
+    return wear_leveling_consolidate_force();
+}
+
+/**
+ * Reads the consolidated data from the newest intact bank into the cache.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+    wl_dprintf("Reading consolidated data\n");
+
+    // Bank 0 is read last, so that it is still in the cache if it gets picked
+    bool     intact[2];
+    uint32_t sequence[2];
+    for (int i = 1; i >= 0; --i) {
+        if (wear_leveling_read_bank(i * (WEAR_LEVELING_BANK_SIZE), &intact[i], &sequence[i]) == WEAR_LEVELING_FAILED) {
+            wl_dprintf("Failed to read from backing store\n");
+            wear_leveling_clear_cache();
+            return WEAR_LEVELING_FAILED;
+        }
+    }
+
+    int bank = 0;
+    if (intact[1] && (!intact[0] || (int32_t)(sequence[1] - sequence[0]) > 0)) {
+        bank = 1;
+        if (wear_leveling_read_bank((WEAR_LEVELING_BANK_SIZE), &intact[1], &sequence[1]) == WEAR_LEVELING_FAILED) {
+            wl_dprintf("Failed to read from backing store\n");
+            wear_leveling_clear_cache();
+            return WEAR_LEVELING_FAILED;
+        }
+    }
+
+    // If neither bank is intact, clear the cache but do not flag a failure, which will cater for the completely clean MCU case.
+    if (intact[bank]) {
+        wl_dprintf("Checksum matches, using bank %d\n", bank);
+        wear_leveling.bank_address  = bank * (WEAR_LEVELING_BANK_SIZE);
+        wear_leveling.sequence      = sequence[bank];
+        wear_leveling.phase         = CONSOLIDATION_IDLE;
+        wear_leveling.write_address = WEAR_LEVELING_LOG_START(wear_leveling.bank_address);
+    } else if (wear_leveling_is_single_bank()) {
+        return wear_leveling_migrate_single_bank();
+    } else {
+        wl_dprintf("Checksum mismatch, clearing cache\n");
+        wear_leveling_clear_cache();
+    }
+
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Performs a single step of the consolidation into the other bank.
+ * Pre-condition: the backing store is unlocked.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the other bank has become the live bank
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(void) {
+    const uint32_t target = (WEAR_LEVELING_BANK_SIZE) - wear_leveling.bank_address;
+    bool           ok     = true;
+    switch (wear_leveling.phase) {
+        case CONSOLIDATION_IDLE:
+            return WEAR_LEVELING_SUCCESS;
+
+        case CONSOLIDATION_ERASE:
+            wl_dprintf("Erasing bank at 0x%04X\n", (int)(target + wear_leveling.position));
+            ok = backing_store_erase_range(target + wear_leveling.position, (BACKING_STORE_ERASE_SIZE));
+            wear_leveling.position += (BACKING_STORE_ERASE_SIZE);
+            if (wear_leveling.position >= (WEAR_LEVELING_BANK_SIZE)) {
+                wear_leveling.phase       = CONSOLIDATION_COPY;
+                wear_leveling.position    = 0;
+                wear_leveling.log_address = wear_leveling.write_address;
+                wear_leveling.hash        = FNV1A_64_INIT;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+                // The cache about to be copied becomes the consolidated data, only writes from here on differ from it
+                memset(wear_leveling.dirty, 0, sizeof(wear_leveling.dirty));
+#endif
+            }
+            break;
+
+        case CONSOLIDATION_COPY: {
+            // Data changed after its part has been copied is carried over by the log entries for those changes
+            const uint32_t remaining = (WEAR_LEVELING_LOGICAL_SIZE) - wear_leveling.position;
+            const uint32_t length    = remaining >= (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) ? (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) : remaining;
+            wl_dprintf("Copying consolidated data at 0x%04X\n", (int)(target + wear_leveling.position));
+            ok                 = backing_store_write_bulk(target + wear_leveling.position, (backing_store_int_t *)&wear_leveling.cache[wear_leveling.position], length / sizeof(backing_store_int_t));
+            wear_leveling.hash = fnv_64a_buf(&wear_leveling.cache[wear_leveling.position], length, wear_leveling.hash);
+            wear_leveling.position += length;
+            if (wear_leveling.position >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                wear_leveling.phase          = CONSOLIDATION_LOG;
+                wear_leveling.target_address = WEAR_LEVELING_LOG_START(target);
+            }
+        } break;
+
+        case CONSOLIDATION_LOG: {
+            const uint32_t remaining = wear_leveling.write_address - wear_leveling.log_address;
+            if (remaining > 0) {
+                backing_store_int_t entries[(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) / sizeof(backing_store_int_t)];
+                const uint32_t      length = remaining >= sizeof(entries) ? sizeof(entries) : remaining;
+                wl_dprintf("Carrying over log entries at 0x%04X\n", (int)wear_leveling.log_address);
+                ok = backing_store_read_bulk(wear_leveling.log_address, entries, length / sizeof(backing_store_int_t)) && backing_store_write_bulk(wear_leveling.target_address, entries, length / sizeof(backing_store_int_t));
+                wear_leveling.log_address += length;
+                wear_leveling.target_address += length;
+                break;
+            }
+
+            // The other bank is up to date, writing its header makes it the live bank
+            const uint32_t sequence = wear_leveling.sequence + 1;
+            wl_dprintf("Writing bank header\n");
+            ok = wear_leveling_write_header(target + (WEAR_LEVELING_LOGICAL_SIZE) + 8, sequence) && wear_leveling_write_header(target + (WEAR_LEVELING_LOGICAL_SIZE), wear_leveling_bank_hash(wear_leveling.hash, sequence));
+            if (ok) {
+                wear_leveling.bank_address  = target;
+                wear_leveling.sequence      = sequence;
+                wear_leveling.write_address = wear_leveling.target_address;
+                wear_leveling.phase         = CONSOLIDATION_IDLE;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+                wear_leveling_reset_checkpoints();
+#endif
+                return WEAR_LEVELING_CONSOLIDATED;
+            }
+        } break;
+    }
+
+    if (!ok) {
+        // Start over with a fresh erase of the other bank next time around
+        wl_dprintf("Failed to consolidate into the other bank\n");
+        wear_leveling.phase    = CONSOLIDATION_ERASE;
+        wear_leveling.position = 0;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+        // Changes since the copy started no longer tell which data differs from the live bank
+        memset(wear_leveling.dirty, 0xFF, sizeof(wear_leveling.dirty));
+#endif
+        return WEAR_LEVELING_FAILED;
+    }
+
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Forces a write of the current cache.
+ * Moves the cache across to the other bank in one go, starting over if a consolidation was already in progress.
+ * The live bank is left untouched, so a power loss during this operation does not lose data.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    wl_dprintf("Consolidating into the other bank\n");
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling.phase    = CONSOLIDATION_ERASE;
+    wear_leveling.position = 0;
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_consolidate_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+    return status;
+}
+
+#else // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Reads the consolidated data from the backing store into the cache.
  * Does not consider the write log.
@@ -221,19 +607,13 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 
     // Verify the FNV1a_64 result
     if (status != WEAR_LEVELING_FAILED) {
-        uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        write_log_entry_t entry;
+        uint64_t expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        uint64_t checksum;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_header((WEAR_LEVELING_LOGICAL_SIZE), &checksum);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
-        if (entry.raw64 == expected) {
+        if (checksum == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
@@ -266,27 +646,10 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
-        write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_header((WEAR_LEVELING_LOGICAL_SIZE), fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT))) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -317,11 +680,17 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START(0);
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    memset(wear_leveling.dirty, status == WEAR_LEVELING_FAILED ? 0xFF : 0, sizeof(wear_leveling.dirty));
+    wear_leveling_reset_checkpoints();
+#endif
 
     return status;
 }
 
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Potential write of the current cache to the backing store.
  * Skipped if the current write log position is not at the end of the backing store.
@@ -330,10 +699,19 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.write_address >= WEAR_LEVELING_BANK_END(WEAR_LEVELING_BANK_ADDRESS)) {
         return wear_leveling_consolidate_force();
     }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Start moving across to the other bank while there is still room in the write log for the writes made meanwhile
+    if (wear_leveling.phase == CONSOLIDATION_IDLE && wear_leveling.write_address + (WEAR_LEVELING_CONSOLIDATION_RESERVE) >= WEAR_LEVELING_BANK_END(wear_leveling.bank_address)) {
+        wl_dprintf("Starting consolidation into the other bank\n");
+        wear_leveling.phase    = CONSOLIDATION_ERASE;
+        wear_leveling.position = 0;
+    }
+#endif
+
     return WEAR_LEVELING_SUCCESS;
 }
 
@@ -470,16 +848,102 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
 /**
- * "Replays" the write log from the backing store, updating the local cache with updated values.
+ * Potential write of a checkpoint to the write log.
+ * Skipped if not enough has been logged since the last one, or if it would not fit before the next consolidation.
+ * Pre-condition: the backing store is unlocked.
  */
-static wear_leveling_status_t wear_leveling_playback_log(void) {
-    wl_dprintf("Playback write log\n");
+static wear_leveling_status_t wear_leveling_checkpoint_if_needed(void) {
+    const uint32_t logged = wear_leveling.write_address - wear_leveling.checkpoint_address;
+    if (logged < (WEAR_LEVELING_CHECKPOINT_INTERVAL) || wear_leveling.checkpoint_count >= (WEAR_LEVELING_CHECKPOINT_SLOTS)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+#    ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Checkpoints are written relative to the live bank, which is about to be replaced
+    if (wear_leveling.phase != CONSOLIDATION_IDLE) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+    const uint32_t headroom = (WEAR_LEVELING_CONSOLIDATION_RESERVE);
+#    else
+    const uint32_t headroom = 0;
+#    endif
+
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < sizeof(wear_leveling.dirty); ++i) {
+        size += __builtin_popcount(wear_leveling.dirty[i]) * (WEAR_LEVELING_CHECKPOINT_ENTRY_SIZE);
+    }
+    if (size > logged / 2 || wear_leveling.write_address + size + headroom >= WEAR_LEVELING_BANK_END(WEAR_LEVELING_BANK_ADDRESS)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Writing checkpoint at 0x%04X\n", (int)wear_leveling.write_address);
+    const uint32_t checkpoint = wear_leveling.write_address;
+    for (uint32_t region = 0; region < (WEAR_LEVELING_DIRTY_REGIONS);) {
+        if (!wear_leveling_is_dirty(region)) {
+            ++region;
+            continue;
+        }
+
+        // Log each run of dirty regions in one go
+        const uint32_t address = region * (WEAR_LEVELING_DIRTY_REGION_SIZE);
+        while (region < (WEAR_LEVELING_DIRTY_REGIONS) && wear_leveling_is_dirty(region)) {
+            ++region;
+        }
+        const uint32_t end = region * (WEAR_LEVELING_DIRTY_REGION_SIZE) < (WEAR_LEVELING_LOGICAL_SIZE) ? region * (WEAR_LEVELING_DIRTY_REGION_SIZE) : (WEAR_LEVELING_LOGICAL_SIZE);
+
+        wear_leveling_status_t status = wear_leveling_write_raw(address, &wear_leveling.cache[address], end - address);
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
+    }
+
+    // Only once all of its entries are in the log can playback start from the checkpoint
+    if (!backing_store_write(WEAR_LEVELING_INDEX_START(WEAR_LEVELING_BANK_ADDRESS) + wear_leveling.checkpoint_count * (BACKING_STORE_WRITE_SIZE), (checkpoint - WEAR_LEVELING_BANK_ADDRESS) / (BACKING_STORE_WRITE_SIZE))) {
+        wl_dprintf("Failed to write to backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.checkpoint_address = checkpoint;
+    ++wear_leveling.checkpoint_count;
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Reads the live bank's checkpoint index from the backing store.
+ *
+ * @return the log entry playback starts at
+ */
+static uint32_t wear_leveling_read_index(void) {
+    wear_leveling_reset_checkpoints();
+    while (wear_leveling.checkpoint_count < (WEAR_LEVELING_CHECKPOINT_SLOTS)) {
+        backing_store_int_t offset;
+        if (!backing_store_read(WEAR_LEVELING_INDEX_START(WEAR_LEVELING_BANK_ADDRESS) + wear_leveling.checkpoint_count * (BACKING_STORE_WRITE_SIZE), &offset) || offset == 0) {
+            break;
+        }
 
+        // Checkpoints only ever move forwards through the write log, anything else means the index is corrupted
+        const uint32_t address = WEAR_LEVELING_BANK_ADDRESS + (uint32_t)offset * (BACKING_STORE_WRITE_SIZE);
+        if (address <= wear_leveling.checkpoint_address || address >= WEAR_LEVELING_BANK_END(WEAR_LEVELING_BANK_ADDRESS)) {
+            wl_dprintf("Invalid checkpoint, ignoring the rest of the index\n");
+            break;
+        }
+
+        wear_leveling.checkpoint_address = address;
+        ++wear_leveling.checkpoint_count;
+    }
+    return wear_leveling.checkpoint_address;
+}
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
+/**
+ * "Replays" the log entries between the supplied addresses, updating the local cache with updated values.
+ * Leaves the write address after the last entry.
+ */
+static wear_leveling_status_t wear_leveling_playback_range(uint32_t address, uint32_t end) {
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    while (!cancel_playback && address < end) {
         backing_store_int_t value;
         bool                ok = backing_store_read(address, &value);
         if (!ok) {
@@ -563,6 +1027,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 #endif
 
                 memcpy(&wear_leveling.cache[a], &log.raw8[3], l);
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+                wear_leveling_mark_dirty(a, l);
+#endif
             } break;
 #if BACKING_STORE_WRITE_SIZE == 2
             case LOG_ENTRY_TYPE_OPTIMIZED_64: {
@@ -576,6 +1043,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 
                 wear_leveling.cache[a] = v;
+#    ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+                wear_leveling_mark_dirty(a, 1);
+#    endif
             } break;
             case LOG_ENTRY_TYPE_WORD_01: {
                 const uint32_t a = LOG_ENTRY_WORD_01_GET_ADDRESS(log);
@@ -589,6 +1059,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
                 wear_leveling.cache[a + 0] = v;
                 wear_leveling.cache[a + 1] = 0;
+#    ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+                wear_leveling_mark_dirty(a, 2);
+#    endif
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
             default: {
@@ -600,7 +1073,21 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     // We've reached the end of the log, so we're at the new write location
     wear_leveling.write_address = address;
+    return status;
+}
+
+/**
+ * "Replays" the write log from the backing store, updating the local cache with updated values.
+ */
+static wear_leveling_status_t wear_leveling_playback_log(void) {
+    wl_dprintf("Playback write log\n");
 
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    uint32_t address = wear_leveling_read_index();
+#else
+    uint32_t address = WEAR_LEVELING_LOG_START(WEAR_LEVELING_BANK_ADDRESS);
+#endif
+    wear_leveling_status_t status = wear_leveling_playback_range(address, WEAR_LEVELING_BANK_END(WEAR_LEVELING_BANK_ADDRESS));
     if (status == WEAR_LEVELING_FAILED) {
         // If we had a failure during readback, assume we're corrupted -- force a consolidation with the data we already have
         status = wear_leveling_consolidate_force();
@@ -691,6 +1178,9 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
 
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wear_leveling_mark_dirty(address, length);
+#endif
 
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
@@ -710,6 +1200,11 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         case WEAR_LEVELING_SUCCESS:
             // Consolidate the cache + write log if required
             status = wear_leveling_consolidate_if_needed();
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+            if (status == WEAR_LEVELING_SUCCESS) {
+                status = wear_leveling_checkpoint_if_needed();
+            }
+#endif
             break;
 
         default:
@@ -727,6 +1222,34 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Performs a single step of any pending consolidation.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    if (wear_leveling.phase == CONSOLIDATION_IDLE) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidate_step();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Reads logical data from the cache.
  */
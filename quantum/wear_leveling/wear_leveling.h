@@ -52,3 +52,15 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Performs a single, bounded step of any pending consolidation.
+ *
+ * Needs to be invoked periodically, so that the write log gets consolidated before it fills up and the rest of the
+ * consolidation has to be completed in one go.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED once the consolidation completes
+ */
+wear_leveling_status_t wear_leveling_task(void);
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
@@ -64,10 +64,32 @@ STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "T
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+// Number of bytes erased in one go by backing_store_erase_range(), provided by the driver or the keyboard
+#    ifndef BACKING_STORE_ERASE_SIZE
+#        error "Incremental consolidation needs BACKING_STORE_ERASE_SIZE, set it to the flash's sector size"
+#    endif
+
+// Number of bytes written to the other bank by each consolidation step
+#    ifndef WEAR_LEVELING_CONSOLIDATION_STEP_SIZE
+#        define WEAR_LEVELING_CONSOLIDATION_STEP_SIZE 64
+#    endif
+
+// Number of bytes left in the write log when consolidation starts, used up by writes until it completes
+#    ifndef WEAR_LEVELING_CONSOLIDATION_RESERVE
+#        define WEAR_LEVELING_CONSOLIDATION_RESERVE (((WEAR_LEVELING_BACKING_SIZE) / 2 - (WEAR_LEVELING_LOGICAL_SIZE) - 16) / 4 / (BACKING_STORE_WRITE_SIZE) * (BACKING_STORE_WRITE_SIZE))
+#    endif
+
+STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 4), "Total backing size must be at least four times the logical size for incremental consolidation");
+STATIC_ASSERT((WEAR_LEVELING_BACKING_SIZE / 2) % BACKING_STORE_ERASE_SIZE == 0, "Half of the backing size must be a multiple of erase size");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation step size must be a multiple of write size");
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+bool backing_store_erase_range(uint32_t address, size_t length); // only required for incremental consolidation, erases BACKING_STORE_ERASE_SIZE-aligned ranges
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
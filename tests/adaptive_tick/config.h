@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define ONESHOT_TIMEOUT 300
+#define CAPS_WORD_IDLE_TIMEOUT 1000
@@ -0,0 +1,41 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+}
+
+static deferred_timer_t timer;
+static uint32_t         fired_at;
+
+static uint32_t record_expiry(uint32_t trigger_time, void *cb_arg) {
+    fired_at = timer_read32();
+    return 0;
+}
+
+class AdaptiveTickDeferredExec : public TestFixture {
+   protected:
+    void SetUp() override {
+        deferred_timer_cancel(&timer);
+        fired_at = 0;
+    }
+};
+
+TEST_F(AdaptiveTickDeferredExec, TimerArmedOutsideOfAKeyExpiresOnTime) {
+    TestDriver driver;
+    set_keymap({});
+
+    idle_for(10);
+    EXPECT_FALSE(adaptive_tick_due());
+
+    // As housekeeping_task_user() or a raw HID command would
+    uint32_t armed_at = timer_read32();
+    EXPECT_TRUE(deferred_timer_schedule(&timer, 50, record_expiry, NULL));
+    idle_for(50);
+    EXPECT_EQ(fired_at, 0u);
+    run_one_scan_loop();
+    EXPECT_EQ(fired_at, armed_at + 50);
+    EXPECT_FALSE(adaptive_tick_due());
+}
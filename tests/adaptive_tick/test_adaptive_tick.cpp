@@ -0,0 +1,142 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+class AdaptiveTick : public TestFixture {};
+
+TEST_F(AdaptiveTick, IdleLoopSkipsTimedTasks) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(adaptive_tick_due());
+}
+
+TEST_F(AdaptiveTick, PendingTapHoldKeyKeepsTicking) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(adaptive_tick_due());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Until the tapping term has passed, another tap would be a repeated tap
+    EXPECT_TRUE(adaptive_tick_due());
+    idle_for(TAPPING_TERM);
+    EXPECT_FALSE(adaptive_tick_due());
+}
+
+TEST_F(AdaptiveTick, TapHoldKeySettlesOnTheTappingTerm) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AdaptiveTick, OneShotModTimesOut) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 2, 0, OSM(MOD_LSFT));
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    // The one shot starts on release, one loop before the end of tap_key()
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LEFT_SHIFT));
+    idle_for(ONESHOT_TIMEOUT - 1);
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LEFT_SHIFT));
+    idle_for(1);
+    EXPECT_EQ(get_oneshot_mods(), 0);
+}
+
+TEST_F(AdaptiveTick, CapsWordTurnedOnOutsideOfAKeyTimesOut) {
+    TestDriver driver;
+    set_keymap({});
+
+    idle_for(10);
+    EXPECT_FALSE(adaptive_tick_due());
+
+    caps_word_on();
+    idle_for(CAPS_WORD_IDLE_TIMEOUT);
+    EXPECT_TRUE(is_caps_word_on());
+    idle_for(1);
+    EXPECT_FALSE(is_caps_word_on());
+}
+
+TEST_F(AdaptiveTick, ComboTimesOutOnTheComboTerm) {
+    TestDriver driver;
+    auto       key_y = KeymapKey(0, 3, 0, KC_Y);
+    auto       key_u = KeymapKey(0, 4, 0, KC_U);
+    set_keymap({key_y, key_u});
+
+    // The combo timer can not start at 0
+    idle_for(10);
+
+    EXPECT_NO_REPORT(driver);
+    key_y.press();
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // Too late to complete the chord
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_REPORT(driver, (KC_Y, KC_U));
+    EXPECT_REPORT(driver, (KC_U));
+    EXPECT_EMPTY_REPORT(driver);
+    key_u.press();
+    run_one_scan_loop();
+    key_y.release();
+    run_one_scan_loop();
+    key_u.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AdaptiveTick, LayerChangedOutsideOfAKeyPollsTimedTasks) {
+    TestDriver driver;
+    set_keymap({});
+
+    idle_for(10);
+    EXPECT_FALSE(adaptive_tick_due());
+
+    // As VIA or the host would
+    layer_on(1);
+    EXPECT_TRUE(adaptive_tick_due());
+    run_one_scan_loop();
+    EXPECT_FALSE(adaptive_tick_due());
+
+    default_layer_set(1UL << 2);
+    EXPECT_TRUE(adaptive_tick_due());
+    run_one_scan_loop();
+    EXPECT_FALSE(adaptive_tick_due());
+}
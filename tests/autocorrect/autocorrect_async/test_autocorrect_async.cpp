@@ -0,0 +1,85 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+class AutoCorrectAsync : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+};
+
+// Test that the correction of "fales" is typed from the queue, and that a key
+// pressed while it is typed is processed after it
+TEST_F(AutoCorrectAsync, CorrectionIsTypedBeforeTheNextKey) {
+    TestDriver driver;
+    auto       key_f     = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l     = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e     = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s     = KeymapKey(0, 4, 0, KC_S);
+    auto       key_space = KeymapKey(0, 5, 0, KC_SPACE);
+    set_keymap({key_f, key_a, key_l, key_e, key_s, key_space});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_SPACE)));
+    }
+
+    for (KeymapKey key : {key_f, key_a, key_l, key_e, key_s}) {
+        tap_key(key);
+    }
+    EXPECT_TRUE(send_string_busy());
+    key_space.press();
+    idle_for(10);
+    EXPECT_FALSE(send_string_busy());
+    key_space.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that a correction triggered by a word boundary, "looses" followed by a
+// space, is typed before the space reaches the host
+TEST_F(AutoCorrectAsync, CorrectionIsTypedBeforeTheWordBoundary) {
+    TestDriver driver;
+    auto       key_l     = KeymapKey(0, 0, 0, KC_L);
+    auto       key_o     = KeymapKey(0, 1, 0, KC_O);
+    auto       key_s     = KeymapKey(0, 2, 0, KC_S);
+    auto       key_e     = KeymapKey(0, 3, 0, KC_E);
+    auto       key_space = KeymapKey(0, 4, 0, KC_SPACE);
+    set_keymap({key_l, key_o, key_s, key_e, key_space});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    {
+        InSequence s;
+        for (uint16_t keycode : {KC_L, KC_O, KC_O, KC_S, KC_E, KC_S}) {
+            EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(keycode)));
+        }
+        for (int i = 0; i < 4; i++) {
+            EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        }
+        for (uint16_t keycode : {KC_S, KC_E, KC_S, KC_SPACE}) {
+            EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(keycode)));
+        }
+    }
+
+    for (KeymapKey key : {key_l, key_o, key_o, key_s, key_e, key_s, key_space}) {
+        tap_key(key);
+    }
+    idle_for(10);
+    EXPECT_FALSE(send_string_busy());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (5 entries):
+//   :thier  -> their
+//   aparent -> apparent
+//   fales   -> false
+//   looses: -> loses
+//   parrent -> parent
+
+#define AUTOCORRECT_MIN_LENGTH 5 // "fales"
+#define AUTOCORRECT_MAX_LENGTH 7 // "aparent"
+#define DICTIONARY_SIZE 207
+
+#define AUTOCORRECT_AUTOMATON
+#define AUTOCORRECT_LINK_SIZE 2
+#define AUTOCORRECT_START_STATE 42
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x05, 0x00, 0x00, 0x04, 0x12, 0x00, 0x09, 0x18, 0x00, 0x0F, 0x1E, 0x00, 0x13, 0x24, 0x00, 0x2C,
+    0x2A, 0x00, 0x01, 0x00, 0x00, 0x13, 0x30, 0x00, 0x01, 0x00, 0x00, 0x04, 0x36, 0x00, 0x01, 0x00,
+    0x00, 0x12, 0x3C, 0x00, 0x01, 0x00, 0x00, 0x04, 0x42, 0x00, 0x01, 0x00, 0x00, 0x17, 0x48, 0x00,
+    0x01, 0x24, 0x00, 0x04, 0x4E, 0x00, 0x01, 0x12, 0x00, 0x0F, 0x54, 0x00, 0x01, 0x00, 0x00, 0x12,
+    0x5A, 0x00, 0x01, 0x12, 0x00, 0x15, 0x60, 0x00, 0x01, 0x00, 0x00, 0x0B, 0x66, 0x00, 0x01, 0x42,
+    0x00, 0x15, 0x6C, 0x00, 0x01, 0x1E, 0x00, 0x08, 0x72, 0x00, 0x01, 0x00, 0x00, 0x16, 0x78, 0x00,
+    0x01, 0x00, 0x00, 0x15, 0x7E, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x84, 0x00, 0x01, 0x60, 0x00, 0x08,
+    0x8A, 0x00, 0x01, 0x00, 0x00, 0x16, 0x90, 0x00, 0x01, 0x00, 0x00, 0x08, 0x94, 0x00, 0x01, 0x00,
+    0x00, 0x08, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x08, 0xA0, 0x00, 0x01, 0x00, 0x00, 0x11, 0xA6, 0x00,
+    0x81, 0x73, 0x65, 0x00, 0x01, 0x00, 0x00, 0x16, 0xAC, 0x00, 0x01, 0x00, 0x00, 0x11, 0xB2, 0x00,
+    0x01, 0x00, 0x00, 0x15, 0xB8, 0x00, 0x01, 0x00, 0x00, 0x17, 0xBD, 0x00, 0x01, 0x00, 0x00, 0x2C,
+    0xC5, 0x00, 0x01, 0x00, 0x00, 0x17, 0xCA, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x84, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0x00, 0x84, 0x73, 0x65, 0x73, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x00
+};
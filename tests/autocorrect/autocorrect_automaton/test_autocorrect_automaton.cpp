@@ -0,0 +1,155 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+// Dictionary in autocorrect_data.h, generated with --automaton:
+//   :thier  -> their
+//   aparent -> apparent
+//   fales   -> false
+//   looses: -> loses
+//   parrent -> parent
+
+class AutoCorrectAutomaton : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+
+    // Taps in order each key in `keys`.
+    template <typename... Ts>
+    void TapKeys(Ts... keys) {
+        for (KeymapKey key : {keys...}) {
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(AutoCorrectAutomaton, fales_to_false_autocorrection) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// "aparr" leaves the "aparent" branch, the failure link continues matching "parrent".
+TEST_F(AutoCorrectAutomaton, aparrent_follows_failure_link_to_parrent) {
+    TestDriver driver;
+    auto       key_a      = KeymapKey(0, 0, 0, KC_A);
+    auto       key_p      = KeymapKey(0, 1, 0, KC_P);
+    auto       key_r      = KeymapKey(0, 2, 0, KC_R);
+    auto       key_e      = KeymapKey(0, 3, 0, KC_E);
+    auto       key_n      = KeymapKey(0, 4, 0, KC_N);
+    auto       key_t_code = KeymapKey(0, 5, 0, KC_T);
+
+    set_keymap({key_a, key_p, key_r, key_e, key_n, key_t_code});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_P)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R))).Times(2);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_N)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(3);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_N)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+    }
+
+    // Longer than AUTOCORRECT_MAX_LENGTH, so the buffer wraps around.
+    TapKeys(key_a, key_p, key_a, key_r, key_r, key_e, key_n, key_t_code);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AutoCorrectAutomaton, backspace_returns_to_previous_state) {
+    TestDriver driver;
+    auto       key_f    = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a    = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l    = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e    = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s    = KeymapKey(0, 4, 0, KC_S);
+    auto       key_x    = KeymapKey(0, 5, 0, KC_X);
+    auto       key_bspc = KeymapKey(0, 6, 0, KC_BACKSPACE);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s, key_x, key_bspc});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_X)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_f, key_a, key_l, key_x, key_bspc, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AutoCorrectAutomaton, looses_corrected_at_word_break) {
+    TestDriver driver;
+    auto       key_l     = KeymapKey(0, 0, 0, KC_L);
+    auto       key_o     = KeymapKey(0, 1, 0, KC_O);
+    auto       key_s     = KeymapKey(0, 2, 0, KC_S);
+    auto       key_e     = KeymapKey(0, 3, 0, KC_E);
+    auto       key_space = KeymapKey(0, 4, 0, KC_SPACE);
+
+    set_keymap({key_l, key_o, key_s, key_e, key_space});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_O))).Times(2);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(4);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_SPACE)));
+    }
+
+    TapKeys(key_l, key_o, key_o, key_s, key_e, key_s, key_space);
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_combos.c
+
+# The combo tests again, timed out on the deferred execution timer wheel instead of by combo_task()
+SRC += $(TEST_PATH)/../test_combo.cpp
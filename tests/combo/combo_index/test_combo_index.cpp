@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// clang-format off
+static const uint16_t pool[] = {
+    KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J,
+    KC_K, KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T,
+    KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z, KC_0, KC_1, KC_2, KC_3,
+    KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_MINS, KC_EQL, KC_LBRC, KC_RBRC,
+};
+// clang-format on
+
+class ComboIndex : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    void SetUp() override {
+        for (uint8_t i = 0; i < sizeof(pool) / sizeof(pool[0]); i++) {
+            keys.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, pool[i]));
+            add_key(keys.back());
+        }
+    }
+
+    KeymapKey &key_for(uint16_t keycode) {
+        for (auto &key : keys) {
+            if (key.code == keycode) return key;
+        }
+        ADD_FAILURE() << "keycode " << keycode << " is not in the pool";
+        return keys.front();
+    }
+};
+
+TEST_F(ComboIndex, TwoKeyComboFires) {
+    TestDriver driver;
+    InSequence s;
+
+    /* stress_combo_0: KC_8 + KC_X -> KC_DOWN */
+    EXPECT_REPORT(driver, (KC_DOWN));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_for(KC_8), key_for(KC_X)});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, ThreeKeyComboFires) {
+    TestDriver driver;
+    InSequence s;
+
+    /* stress_combo_3: KC_N + KC_X + KC_G -> its result keycode, only checks that one report pair is sent */
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(2);
+    tap_combo({key_for(KC_N), key_for(KC_X), key_for(KC_G)});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, NonComboKeyTapIsSent) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_for(KC_A));
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Replays a pseudo-random typing trace over all 300 combos and compares a hash of every report
+ * sent to the host with the hash recorded from the full combo scan (built without COMBO_INDEX_SIZE). */
+TEST_F(ComboIndex, StressTraceMatchesFullScan) {
+    TestDriver driver;
+    uint32_t   hash    = 2166136261u;
+    uint32_t   reports = 0;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([&](report_keyboard_t &report) {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&report);
+        for (size_t i = 0; i < sizeof(report); i++) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        reports++;
+    });
+
+    uint32_t seed = 1;
+    auto     next = [&](uint32_t range) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % range;
+    };
+
+    for (int step = 0; step < 2000; step++) {
+        /* Press one to three keys, each within the combo term of the previous one */
+        const uint32_t         chord_size = 1 + next(3);
+        std::vector<KeymapKey> chord;
+        for (uint32_t i = 0; i < chord_size; i++) {
+            KeymapKey &key = keys[next(keys.size())];
+            bool       held = false;
+            for (auto &other : chord) {
+                held |= other.code == key.code;
+            }
+            if (held) continue;
+            chord.push_back(key);
+            key.press();
+            idle_for(1 + next(COMBO_TERM / 2));
+        }
+
+        idle_for(next(COMBO_TERM * 2));
+
+        for (auto &key : chord) {
+            key.release();
+            idle_for(1 + next(10));
+        }
+        idle_for(next(COMBO_TERM));
+    }
+    idle_for(COMBO_TERM * 2);
+
+    RecordProperty("reports", (int)reports);
+    RecordProperty("hash", std::to_string(hash));
+    EXPECT_EQ(reports, 6716u);
+    EXPECT_EQ(hash, 1687192556u);
+    VERIFY_AND_CLEAR(driver);
+}
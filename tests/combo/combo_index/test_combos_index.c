@@ -0,0 +1,612 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Generated with a fixed seed: 300 two and three key combos over the 40 keys of the test matrix.
+
+// clang-format off
+const uint16_t PROGMEM stress_combo_0[] = {KC_8, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_1[] = {KC_K, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_2[] = {KC_X, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_3[] = {KC_N, KC_X, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_4[] = {KC_Z, KC_E, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_5[] = {KC_Z, KC_T, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_6[] = {KC_3, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_7[] = {KC_U, KC_LBRC, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_8[] = {KC_M, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_9[] = {KC_RBRC, KC_MINS, COMBO_END};
+const uint16_t PROGMEM stress_combo_10[] = {KC_RBRC, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_11[] = {KC_M, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_12[] = {KC_MINS, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_13[] = {KC_RBRC, KC_V, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_14[] = {KC_9, KC_C, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_15[] = {KC_L, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_16[] = {KC_D, KC_5, COMBO_END};
+const uint16_t PROGMEM stress_combo_17[] = {KC_B, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_18[] = {KC_W, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_19[] = {KC_Q, KC_E, COMBO_END};
+const uint16_t PROGMEM stress_combo_20[] = {KC_K, KC_U, KC_F, COMBO_END};
+const uint16_t PROGMEM stress_combo_21[] = {KC_8, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_22[] = {KC_1, KC_W, COMBO_END};
+const uint16_t PROGMEM stress_combo_23[] = {KC_C, KC_1, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_24[] = {KC_3, KC_W, COMBO_END};
+const uint16_t PROGMEM stress_combo_25[] = {KC_W, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_26[] = {KC_M, KC_I, KC_4, COMBO_END};
+const uint16_t PROGMEM stress_combo_27[] = {KC_9, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_28[] = {KC_V, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_29[] = {KC_RBRC, KC_0, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_30[] = {KC_U, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_31[] = {KC_M, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_32[] = {KC_8, KC_U, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_33[] = {KC_T, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_34[] = {KC_Y, KC_J, COMBO_END};
+const uint16_t PROGMEM stress_combo_35[] = {KC_P, KC_Y, KC_F, COMBO_END};
+const uint16_t PROGMEM stress_combo_36[] = {KC_V, KC_F, COMBO_END};
+const uint16_t PROGMEM stress_combo_37[] = {KC_LBRC, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_38[] = {KC_6, KC_EQL, COMBO_END};
+const uint16_t PROGMEM stress_combo_39[] = {KC_2, KC_H, COMBO_END};
+const uint16_t PROGMEM stress_combo_40[] = {KC_5, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_41[] = {KC_R, KC_EQL, COMBO_END};
+const uint16_t PROGMEM stress_combo_42[] = {KC_J, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_43[] = {KC_C, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_44[] = {KC_J, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_45[] = {KC_RBRC, KC_5, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_46[] = {KC_M, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_47[] = {KC_C, KC_2, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_48[] = {KC_U, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_49[] = {KC_G, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_50[] = {KC_T, KC_M, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_51[] = {KC_K, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_52[] = {KC_P, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_53[] = {KC_0, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_54[] = {KC_M, KC_E, COMBO_END};
+const uint16_t PROGMEM stress_combo_55[] = {KC_I, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_56[] = {KC_B, KC_A, COMBO_END};
+const uint16_t PROGMEM stress_combo_57[] = {KC_9, KC_H, COMBO_END};
+const uint16_t PROGMEM stress_combo_58[] = {KC_7, KC_9, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_59[] = {KC_A, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_60[] = {KC_LBRC, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_61[] = {KC_D, KC_X, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_62[] = {KC_L, KC_A, COMBO_END};
+const uint16_t PROGMEM stress_combo_63[] = {KC_L, KC_M, KC_E, COMBO_END};
+const uint16_t PROGMEM stress_combo_64[] = {KC_9, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_65[] = {KC_LBRC, KC_F, COMBO_END};
+const uint16_t PROGMEM stress_combo_66[] = {KC_1, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_67[] = {KC_7, KC_8, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_68[] = {KC_U, KC_S, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_69[] = {KC_EQL, KC_V, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_70[] = {KC_B, KC_D, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_71[] = {KC_C, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_72[] = {KC_C, KC_RBRC, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_73[] = {KC_U, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_74[] = {KC_9, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_75[] = {KC_EQL, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_76[] = {KC_J, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_77[] = {KC_0, KC_K, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_78[] = {KC_Q, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_79[] = {KC_X, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_80[] = {KC_LBRC, KC_4, COMBO_END};
+const uint16_t PROGMEM stress_combo_81[] = {KC_F, KC_R, KC_4, COMBO_END};
+const uint16_t PROGMEM stress_combo_82[] = {KC_G, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_83[] = {KC_K, KC_J, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_84[] = {KC_W, KC_H, COMBO_END};
+const uint16_t PROGMEM stress_combo_85[] = {KC_E, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_86[] = {KC_MINS, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_87[] = {KC_L, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_88[] = {KC_7, KC_D, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_89[] = {KC_U, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_90[] = {KC_C, KC_Q, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_91[] = {KC_F, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_92[] = {KC_R, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_93[] = {KC_D, KC_I, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_94[] = {KC_MINS, KC_V, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_95[] = {KC_EQL, KC_M, COMBO_END};
+const uint16_t PROGMEM stress_combo_96[] = {KC_T, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_97[] = {KC_RBRC, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_98[] = {KC_EQL, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_99[] = {KC_Y, KC_L, COMBO_END};
+const uint16_t PROGMEM stress_combo_100[] = {KC_I, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_101[] = {KC_7, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_102[] = {KC_L, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_103[] = {KC_I, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_104[] = {KC_6, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_105[] = {KC_9, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_106[] = {KC_Y, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_107[] = {KC_B, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_108[] = {KC_P, KC_J, KC_O, COMBO_END};
+const uint16_t PROGMEM stress_combo_109[] = {KC_D, KC_RBRC, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_110[] = {KC_RBRC, KC_B, KC_MINS, COMBO_END};
+const uint16_t PROGMEM stress_combo_111[] = {KC_RBRC, KC_V, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_112[] = {KC_T, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_113[] = {KC_Z, KC_V, KC_L, COMBO_END};
+const uint16_t PROGMEM stress_combo_114[] = {KC_Z, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_115[] = {KC_O, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_116[] = {KC_LBRC, KC_EQL, COMBO_END};
+const uint16_t PROGMEM stress_combo_117[] = {KC_L, KC_E, COMBO_END};
+const uint16_t PROGMEM stress_combo_118[] = {KC_Q, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_119[] = {KC_S, KC_MINS, COMBO_END};
+const uint16_t PROGMEM stress_combo_120[] = {KC_Z, KC_H, COMBO_END};
+const uint16_t PROGMEM stress_combo_121[] = {KC_A, KC_O, COMBO_END};
+const uint16_t PROGMEM stress_combo_122[] = {KC_EQL, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_123[] = {KC_L, KC_7, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_124[] = {KC_Z, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_125[] = {KC_P, KC_4, COMBO_END};
+const uint16_t PROGMEM stress_combo_126[] = {KC_R, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_127[] = {KC_4, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_128[] = {KC_8, KC_3, KC_EQL, COMBO_END};
+const uint16_t PROGMEM stress_combo_129[] = {KC_1, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_130[] = {KC_G, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_131[] = {KC_9, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_132[] = {KC_K, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_133[] = {KC_G, KC_5, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_134[] = {KC_O, KC_M, COMBO_END};
+const uint16_t PROGMEM stress_combo_135[] = {KC_EQL, KC_0, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_136[] = {KC_I, KC_O, KC_MINS, COMBO_END};
+const uint16_t PROGMEM stress_combo_137[] = {KC_5, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_138[] = {KC_7, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_139[] = {KC_8, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_140[] = {KC_3, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_141[] = {KC_H, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_142[] = {KC_R, KC_F, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_143[] = {KC_X, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_144[] = {KC_R, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_145[] = {KC_M, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_146[] = {KC_L, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_147[] = {KC_5, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_148[] = {KC_R, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_149[] = {KC_S, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_150[] = {KC_RBRC, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_151[] = {KC_R, KC_9, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_152[] = {KC_T, KC_K, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_153[] = {KC_L, KC_V, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_154[] = {KC_8, KC_LBRC, KC_A, COMBO_END};
+const uint16_t PROGMEM stress_combo_155[] = {KC_O, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_156[] = {KC_4, KC_EQL, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_157[] = {KC_O, KC_W, COMBO_END};
+const uint16_t PROGMEM stress_combo_158[] = {KC_J, KC_T, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_159[] = {KC_D, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_160[] = {KC_B, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_161[] = {KC_H, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_162[] = {KC_F, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_163[] = {KC_5, KC_M, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_164[] = {KC_O, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_165[] = {KC_MINS, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_166[] = {KC_L, KC_MINS, KC_5, COMBO_END};
+const uint16_t PROGMEM stress_combo_167[] = {KC_T, KC_H, KC_MINS, COMBO_END};
+const uint16_t PROGMEM stress_combo_168[] = {KC_C, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_169[] = {KC_U, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_170[] = {KC_4, KC_T, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_171[] = {KC_2, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_172[] = {KC_Y, KC_W, KC_4, COMBO_END};
+const uint16_t PROGMEM stress_combo_173[] = {KC_Q, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_174[] = {KC_W, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_175[] = {KC_G, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_176[] = {KC_H, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_177[] = {KC_Z, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_178[] = {KC_S, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_179[] = {KC_O, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_180[] = {KC_G, KC_W, COMBO_END};
+const uint16_t PROGMEM stress_combo_181[] = {KC_Q, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_182[] = {KC_J, KC_9, KC_L, COMBO_END};
+const uint16_t PROGMEM stress_combo_183[] = {KC_1, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_184[] = {KC_F, KC_5, COMBO_END};
+const uint16_t PROGMEM stress_combo_185[] = {KC_9, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_186[] = {KC_U, KC_M, COMBO_END};
+const uint16_t PROGMEM stress_combo_187[] = {KC_L, KC_O, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_188[] = {KC_G, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_189[] = {KC_K, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_190[] = {KC_0, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_191[] = {KC_9, KC_O, COMBO_END};
+const uint16_t PROGMEM stress_combo_192[] = {KC_4, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_193[] = {KC_E, KC_0, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_194[] = {KC_B, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_195[] = {KC_9, KC_X, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_196[] = {KC_0, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_197[] = {KC_N, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_198[] = {KC_LBRC, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_199[] = {KC_Q, KC_F, COMBO_END};
+const uint16_t PROGMEM stress_combo_200[] = {KC_J, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_201[] = {KC_W, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_202[] = {KC_I, KC_O, KC_A, COMBO_END};
+const uint16_t PROGMEM stress_combo_203[] = {KC_O, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_204[] = {KC_K, KC_P, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_205[] = {KC_D, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_206[] = {KC_4, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_207[] = {KC_U, KC_G, COMBO_END};
+const uint16_t PROGMEM stress_combo_208[] = {KC_S, KC_E, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_209[] = {KC_R, KC_C, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_210[] = {KC_M, KC_C, KC_H, COMBO_END};
+const uint16_t PROGMEM stress_combo_211[] = {KC_Q, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_212[] = {KC_M, KC_2, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_213[] = {KC_I, KC_F, KC_J, COMBO_END};
+const uint16_t PROGMEM stress_combo_214[] = {KC_3, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_215[] = {KC_X, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_216[] = {KC_1, KC_D, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_217[] = {KC_O, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_218[] = {KC_M, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_219[] = {KC_2, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_220[] = {KC_E, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_221[] = {KC_Y, KC_V, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_222[] = {KC_H, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_223[] = {KC_1, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_224[] = {KC_L, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_225[] = {KC_J, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_226[] = {KC_N, KC_T, KC_M, COMBO_END};
+const uint16_t PROGMEM stress_combo_227[] = {KC_U, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_228[] = {KC_P, KC_N, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_229[] = {KC_R, KC_N, COMBO_END};
+const uint16_t PROGMEM stress_combo_230[] = {KC_I, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_231[] = {KC_E, KC_1, COMBO_END};
+const uint16_t PROGMEM stress_combo_232[] = {KC_2, KC_K, KC_3, COMBO_END};
+const uint16_t PROGMEM stress_combo_233[] = {KC_B, KC_RBRC, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_234[] = {KC_R, KC_1, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_235[] = {KC_EQL, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_236[] = {KC_EQL, KC_U, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_237[] = {KC_5, KC_LBRC, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_238[] = {KC_B, KC_LBRC, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_239[] = {KC_5, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_240[] = {KC_E, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_241[] = {KC_U, KC_MINS, KC_V, COMBO_END};
+const uint16_t PROGMEM stress_combo_242[] = {KC_K, KC_LBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_243[] = {KC_T, KC_A, KC_W, COMBO_END};
+const uint16_t PROGMEM stress_combo_244[] = {KC_C, KC_W, KC_O, COMBO_END};
+const uint16_t PROGMEM stress_combo_245[] = {KC_L, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_246[] = {KC_Q, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_247[] = {KC_F, KC_EQL, COMBO_END};
+const uint16_t PROGMEM stress_combo_248[] = {KC_D, KC_M, COMBO_END};
+const uint16_t PROGMEM stress_combo_249[] = {KC_G, KC_RBRC, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_250[] = {KC_Y, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_251[] = {KC_L, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_252[] = {KC_N, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_253[] = {KC_8, KC_7, COMBO_END};
+const uint16_t PROGMEM stress_combo_254[] = {KC_K, KC_0, COMBO_END};
+const uint16_t PROGMEM stress_combo_255[] = {KC_V, KC_H, COMBO_END};
+const uint16_t PROGMEM stress_combo_256[] = {KC_6, KC_L, COMBO_END};
+const uint16_t PROGMEM stress_combo_257[] = {KC_J, KC_EQL, COMBO_END};
+const uint16_t PROGMEM stress_combo_258[] = {KC_B, KC_R, COMBO_END};
+const uint16_t PROGMEM stress_combo_259[] = {KC_T, KC_0, KC_F, COMBO_END};
+const uint16_t PROGMEM stress_combo_260[] = {KC_F, KC_1, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_261[] = {KC_F, KC_U, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_262[] = {KC_3, KC_G, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_263[] = {KC_L, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_264[] = {KC_E, KC_C, KC_4, COMBO_END};
+const uint16_t PROGMEM stress_combo_265[] = {KC_L, KC_C, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_266[] = {KC_C, KC_A, KC_5, COMBO_END};
+const uint16_t PROGMEM stress_combo_267[] = {KC_M, KC_J, COMBO_END};
+const uint16_t PROGMEM stress_combo_268[] = {KC_G, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_269[] = {KC_O, KC_P, KC_K, COMBO_END};
+const uint16_t PROGMEM stress_combo_270[] = {KC_Y, KC_M, COMBO_END};
+const uint16_t PROGMEM stress_combo_271[] = {KC_U, KC_A, KC_MINS, COMBO_END};
+const uint16_t PROGMEM stress_combo_272[] = {KC_0, KC_Z, COMBO_END};
+const uint16_t PROGMEM stress_combo_273[] = {KC_R, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_274[] = {KC_I, KC_4, KC_RBRC, COMBO_END};
+const uint16_t PROGMEM stress_combo_275[] = {KC_U, KC_I, COMBO_END};
+const uint16_t PROGMEM stress_combo_276[] = {KC_F, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_277[] = {KC_2, KC_B, COMBO_END};
+const uint16_t PROGMEM stress_combo_278[] = {KC_A, KC_W, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_279[] = {KC_EQL, KC_Q, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_280[] = {KC_Y, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_281[] = {KC_Q, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_282[] = {KC_H, KC_S, COMBO_END};
+const uint16_t PROGMEM stress_combo_283[] = {KC_K, KC_Q, COMBO_END};
+const uint16_t PROGMEM stress_combo_284[] = {KC_O, KC_X, COMBO_END};
+const uint16_t PROGMEM stress_combo_285[] = {KC_3, KC_A, COMBO_END};
+const uint16_t PROGMEM stress_combo_286[] = {KC_H, KC_R, KC_U, COMBO_END};
+const uint16_t PROGMEM stress_combo_287[] = {KC_MINS, KC_B, KC_C, COMBO_END};
+const uint16_t PROGMEM stress_combo_288[] = {KC_W, KC_S, KC_2, COMBO_END};
+const uint16_t PROGMEM stress_combo_289[] = {KC_V, KC_8, COMBO_END};
+const uint16_t PROGMEM stress_combo_290[] = {KC_Q, KC_T, KC_J, COMBO_END};
+const uint16_t PROGMEM stress_combo_291[] = {KC_O, KC_J, COMBO_END};
+const uint16_t PROGMEM stress_combo_292[] = {KC_H, KC_W, KC_9, COMBO_END};
+const uint16_t PROGMEM stress_combo_293[] = {KC_5, KC_W, COMBO_END};
+const uint16_t PROGMEM stress_combo_294[] = {KC_R, KC_P, KC_D, COMBO_END};
+const uint16_t PROGMEM stress_combo_295[] = {KC_5, KC_RBRC, KC_T, COMBO_END};
+const uint16_t PROGMEM stress_combo_296[] = {KC_U, KC_9, KC_Y, COMBO_END};
+const uint16_t PROGMEM stress_combo_297[] = {KC_T, KC_8, KC_6, COMBO_END};
+const uint16_t PROGMEM stress_combo_298[] = {KC_J, KC_P, COMBO_END};
+const uint16_t PROGMEM stress_combo_299[] = {KC_7, KC_M, KC_P, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(stress_combo_0, KC_DOWN),
+    COMBO(stress_combo_1, KC_ESC),
+    COMBO(stress_combo_2, KC_TAB),
+    COMBO(stress_combo_3, KC_BSPC),
+    COMBO(stress_combo_4, KC_F23),
+    COMBO(stress_combo_5, KC_F23),
+    COMBO(stress_combo_6, KC_F11),
+    COMBO(stress_combo_7, KC_RGHT),
+    COMBO(stress_combo_8, KC_F5),
+    COMBO(stress_combo_9, KC_F3),
+    COMBO(stress_combo_10, KC_F2),
+    COMBO(stress_combo_11, KC_F19),
+    COMBO(stress_combo_12, KC_F1),
+    COMBO(stress_combo_13, KC_DOWN),
+    COMBO(stress_combo_14, KC_F14),
+    COMBO(stress_combo_15, KC_INS),
+    COMBO(stress_combo_16, KC_LEFT),
+    COMBO(stress_combo_17, KC_PGUP),
+    COMBO(stress_combo_18, KC_DOWN),
+    COMBO(stress_combo_19, KC_F9),
+    COMBO(stress_combo_20, KC_F13),
+    COMBO(stress_combo_21, KC_F4),
+    COMBO(stress_combo_22, KC_RGHT),
+    COMBO(stress_combo_23, KC_F10),
+    COMBO(stress_combo_24, KC_ESC),
+    COMBO(stress_combo_25, KC_F17),
+    COMBO(stress_combo_26, KC_TAB),
+    COMBO(stress_combo_27, KC_F11),
+    COMBO(stress_combo_28, KC_F13),
+    COMBO(stress_combo_29, KC_END),
+    COMBO(stress_combo_30, KC_F2),
+    COMBO(stress_combo_31, KC_F20),
+    COMBO(stress_combo_32, KC_F23),
+    COMBO(stress_combo_33, KC_LEFT),
+    COMBO(stress_combo_34, KC_F18),
+    COMBO(stress_combo_35, KC_HOME),
+    COMBO(stress_combo_36, KC_F18),
+    COMBO(stress_combo_37, KC_F9),
+    COMBO(stress_combo_38, KC_ESC),
+    COMBO(stress_combo_39, KC_F16),
+    COMBO(stress_combo_40, KC_F23),
+    COMBO(stress_combo_41, KC_F7),
+    COMBO(stress_combo_42, KC_LEFT),
+    COMBO(stress_combo_43, KC_PGUP),
+    COMBO(stress_combo_44, KC_F6),
+    COMBO(stress_combo_45, KC_F2),
+    COMBO(stress_combo_46, KC_F16),
+    COMBO(stress_combo_47, KC_TAB),
+    COMBO(stress_combo_48, KC_BSPC),
+    COMBO(stress_combo_49, KC_F6),
+    COMBO(stress_combo_50, KC_F13),
+    COMBO(stress_combo_51, KC_TAB),
+    COMBO(stress_combo_52, KC_BSPC),
+    COMBO(stress_combo_53, KC_UP),
+    COMBO(stress_combo_54, KC_F5),
+    COMBO(stress_combo_55, KC_F18),
+    COMBO(stress_combo_56, KC_F16),
+    COMBO(stress_combo_57, KC_TAB),
+    COMBO(stress_combo_58, KC_F10),
+    COMBO(stress_combo_59, KC_F20),
+    COMBO(stress_combo_60, KC_F6),
+    COMBO(stress_combo_61, KC_ENT),
+    COMBO(stress_combo_62, KC_PGUP),
+    COMBO(stress_combo_63, KC_BSPC),
+    COMBO(stress_combo_64, KC_F11),
+    COMBO(stress_combo_65, KC_F15),
+    COMBO(stress_combo_66, KC_BSPC),
+    COMBO(stress_combo_67, KC_F7),
+    COMBO(stress_combo_68, KC_PGUP),
+    COMBO(stress_combo_69, KC_F7),
+    COMBO(stress_combo_70, KC_INS),
+    COMBO(stress_combo_71, KC_F1),
+    COMBO(stress_combo_72, KC_HOME),
+    COMBO(stress_combo_73, KC_INS),
+    COMBO(stress_combo_74, KC_F14),
+    COMBO(stress_combo_75, KC_F24),
+    COMBO(stress_combo_76, KC_F15),
+    COMBO(stress_combo_77, KC_F13),
+    COMBO(stress_combo_78, KC_END),
+    COMBO(stress_combo_79, KC_F14),
+    COMBO(stress_combo_80, KC_F18),
+    COMBO(stress_combo_81, KC_F17),
+    COMBO(stress_combo_82, KC_F10),
+    COMBO(stress_combo_83, KC_F1),
+    COMBO(stress_combo_84, KC_F20),
+    COMBO(stress_combo_85, KC_BSPC),
+    COMBO(stress_combo_86, KC_TAB),
+    COMBO(stress_combo_87, KC_F14),
+    COMBO(stress_combo_88, KC_F7),
+    COMBO(stress_combo_89, KC_F21),
+    COMBO(stress_combo_90, KC_F21),
+    COMBO(stress_combo_91, KC_LEFT),
+    COMBO(stress_combo_92, KC_F21),
+    COMBO(stress_combo_93, KC_PGUP),
+    COMBO(stress_combo_94, KC_RGHT),
+    COMBO(stress_combo_95, KC_DEL),
+    COMBO(stress_combo_96, KC_INS),
+    COMBO(stress_combo_97, KC_DOWN),
+    COMBO(stress_combo_98, KC_TAB),
+    COMBO(stress_combo_99, KC_F5),
+    COMBO(stress_combo_100, KC_DOWN),
+    COMBO(stress_combo_101, KC_F7),
+    COMBO(stress_combo_102, KC_F23),
+    COMBO(stress_combo_103, KC_F8),
+    COMBO(stress_combo_104, KC_F23),
+    COMBO(stress_combo_105, KC_F20),
+    COMBO(stress_combo_106, KC_PGDN),
+    COMBO(stress_combo_107, KC_F4),
+    COMBO(stress_combo_108, KC_F5),
+    COMBO(stress_combo_109, KC_LEFT),
+    COMBO(stress_combo_110, KC_F21),
+    COMBO(stress_combo_111, KC_F20),
+    COMBO(stress_combo_112, KC_F20),
+    COMBO(stress_combo_113, KC_F3),
+    COMBO(stress_combo_114, KC_BSPC),
+    COMBO(stress_combo_115, KC_F5),
+    COMBO(stress_combo_116, KC_F22),
+    COMBO(stress_combo_117, KC_F1),
+    COMBO(stress_combo_118, KC_SPC),
+    COMBO(stress_combo_119, KC_F15),
+    COMBO(stress_combo_120, KC_F23),
+    COMBO(stress_combo_121, KC_PGDN),
+    COMBO(stress_combo_122, KC_F19),
+    COMBO(stress_combo_123, KC_F21),
+    COMBO(stress_combo_124, KC_UP),
+    COMBO(stress_combo_125, KC_DEL),
+    COMBO(stress_combo_126, KC_DOWN),
+    COMBO(stress_combo_127, KC_F20),
+    COMBO(stress_combo_128, KC_UP),
+    COMBO(stress_combo_129, KC_F10),
+    COMBO(stress_combo_130, KC_ESC),
+    COMBO(stress_combo_131, KC_F15),
+    COMBO(stress_combo_132, KC_F15),
+    COMBO(stress_combo_133, KC_F5),
+    COMBO(stress_combo_134, KC_PGDN),
+    COMBO(stress_combo_135, KC_F3),
+    COMBO(stress_combo_136, KC_F1),
+    COMBO(stress_combo_137, KC_F4),
+    COMBO(stress_combo_138, KC_PGDN),
+    COMBO(stress_combo_139, KC_F21),
+    COMBO(stress_combo_140, KC_F7),
+    COMBO(stress_combo_141, KC_F3),
+    COMBO(stress_combo_142, KC_F15),
+    COMBO(stress_combo_143, KC_F5),
+    COMBO(stress_combo_144, KC_ENT),
+    COMBO(stress_combo_145, KC_PGUP),
+    COMBO(stress_combo_146, KC_PGDN),
+    COMBO(stress_combo_147, KC_F9),
+    COMBO(stress_combo_148, KC_DOWN),
+    COMBO(stress_combo_149, KC_F4),
+    COMBO(stress_combo_150, KC_PGUP),
+    COMBO(stress_combo_151, KC_F10),
+    COMBO(stress_combo_152, KC_ESC),
+    COMBO(stress_combo_153, KC_F23),
+    COMBO(stress_combo_154, KC_F24),
+    COMBO(stress_combo_155, KC_F22),
+    COMBO(stress_combo_156, KC_F15),
+    COMBO(stress_combo_157, KC_F17),
+    COMBO(stress_combo_158, KC_END),
+    COMBO(stress_combo_159, KC_F19),
+    COMBO(stress_combo_160, KC_INS),
+    COMBO(stress_combo_161, KC_F4),
+    COMBO(stress_combo_162, KC_F14),
+    COMBO(stress_combo_163, KC_F24),
+    COMBO(stress_combo_164, KC_F16),
+    COMBO(stress_combo_165, KC_F23),
+    COMBO(stress_combo_166, KC_F22),
+    COMBO(stress_combo_167, KC_F19),
+    COMBO(stress_combo_168, KC_F18),
+    COMBO(stress_combo_169, KC_F15),
+    COMBO(stress_combo_170, KC_BSPC),
+    COMBO(stress_combo_171, KC_ENT),
+    COMBO(stress_combo_172, KC_F5),
+    COMBO(stress_combo_173, KC_END),
+    COMBO(stress_combo_174, KC_F15),
+    COMBO(stress_combo_175, KC_F7),
+    COMBO(stress_combo_176, KC_F14),
+    COMBO(stress_combo_177, KC_F21),
+    COMBO(stress_combo_178, KC_F6),
+    COMBO(stress_combo_179, KC_F2),
+    COMBO(stress_combo_180, KC_F13),
+    COMBO(stress_combo_181, KC_TAB),
+    COMBO(stress_combo_182, KC_F17),
+    COMBO(stress_combo_183, KC_F20),
+    COMBO(stress_combo_184, KC_BSPC),
+    COMBO(stress_combo_185, KC_F22),
+    COMBO(stress_combo_186, KC_F5),
+    COMBO(stress_combo_187, KC_DEL),
+    COMBO(stress_combo_188, KC_F6),
+    COMBO(stress_combo_189, KC_F3),
+    COMBO(stress_combo_190, KC_ESC),
+    COMBO(stress_combo_191, KC_F15),
+    COMBO(stress_combo_192, KC_F6),
+    COMBO(stress_combo_193, KC_F6),
+    COMBO(stress_combo_194, KC_F8),
+    COMBO(stress_combo_195, KC_SPC),
+    COMBO(stress_combo_196, KC_F1),
+    COMBO(stress_combo_197, KC_F15),
+    COMBO(stress_combo_198, KC_END),
+    COMBO(stress_combo_199, KC_F10),
+    COMBO(stress_combo_200, KC_F17),
+    COMBO(stress_combo_201, KC_F6),
+    COMBO(stress_combo_202, KC_F16),
+    COMBO(stress_combo_203, KC_F17),
+    COMBO(stress_combo_204, KC_PGUP),
+    COMBO(stress_combo_205, KC_F21),
+    COMBO(stress_combo_206, KC_RGHT),
+    COMBO(stress_combo_207, KC_F17),
+    COMBO(stress_combo_208, KC_F18),
+    COMBO(stress_combo_209, KC_F14),
+    COMBO(stress_combo_210, KC_F16),
+    COMBO(stress_combo_211, KC_F12),
+    COMBO(stress_combo_212, KC_PGUP),
+    COMBO(stress_combo_213, KC_F7),
+    COMBO(stress_combo_214, KC_DEL),
+    COMBO(stress_combo_215, KC_F1),
+    COMBO(stress_combo_216, KC_LEFT),
+    COMBO(stress_combo_217, KC_F21),
+    COMBO(stress_combo_218, KC_F3),
+    COMBO(stress_combo_219, KC_F15),
+    COMBO(stress_combo_220, KC_F8),
+    COMBO(stress_combo_221, KC_F23),
+    COMBO(stress_combo_222, KC_F15),
+    COMBO(stress_combo_223, KC_F20),
+    COMBO(stress_combo_224, KC_F22),
+    COMBO(stress_combo_225, KC_F18),
+    COMBO(stress_combo_226, KC_F22),
+    COMBO(stress_combo_227, KC_HOME),
+    COMBO(stress_combo_228, KC_F18),
+    COMBO(stress_combo_229, KC_F24),
+    COMBO(stress_combo_230, KC_F14),
+    COMBO(stress_combo_231, KC_F14),
+    COMBO(stress_combo_232, KC_F4),
+    COMBO(stress_combo_233, KC_SPC),
+    COMBO(stress_combo_234, KC_F18),
+    COMBO(stress_combo_235, KC_F9),
+    COMBO(stress_combo_236, KC_RGHT),
+    COMBO(stress_combo_237, KC_F23),
+    COMBO(stress_combo_238, KC_F23),
+    COMBO(stress_combo_239, KC_F9),
+    COMBO(stress_combo_240, KC_F7),
+    COMBO(stress_combo_241, KC_BSPC),
+    COMBO(stress_combo_242, KC_F14),
+    COMBO(stress_combo_243, KC_F17),
+    COMBO(stress_combo_244, KC_F5),
+    COMBO(stress_combo_245, KC_F19),
+    COMBO(stress_combo_246, KC_F14),
+    COMBO(stress_combo_247, KC_DEL),
+    COMBO(stress_combo_248, KC_BSPC),
+    COMBO(stress_combo_249, KC_F3),
+    COMBO(stress_combo_250, KC_HOME),
+    COMBO(stress_combo_251, KC_F16),
+    COMBO(stress_combo_252, KC_SPC),
+    COMBO(stress_combo_253, KC_INS),
+    COMBO(stress_combo_254, KC_F18),
+    COMBO(stress_combo_255, KC_END),
+    COMBO(stress_combo_256, KC_INS),
+    COMBO(stress_combo_257, KC_F23),
+    COMBO(stress_combo_258, KC_F5),
+    COMBO(stress_combo_259, KC_F7),
+    COMBO(stress_combo_260, KC_LEFT),
+    COMBO(stress_combo_261, KC_PGDN),
+    COMBO(stress_combo_262, KC_PGDN),
+    COMBO(stress_combo_263, KC_F15),
+    COMBO(stress_combo_264, KC_F1),
+    COMBO(stress_combo_265, KC_F9),
+    COMBO(stress_combo_266, KC_DOWN),
+    COMBO(stress_combo_267, KC_F12),
+    COMBO(stress_combo_268, KC_F11),
+    COMBO(stress_combo_269, KC_ENT),
+    COMBO(stress_combo_270, KC_F13),
+    COMBO(stress_combo_271, KC_F12),
+    COMBO(stress_combo_272, KC_F7),
+    COMBO(stress_combo_273, KC_UP),
+    COMBO(stress_combo_274, KC_ENT),
+    COMBO(stress_combo_275, KC_F7),
+    COMBO(stress_combo_276, KC_LEFT),
+    COMBO(stress_combo_277, KC_PGUP),
+    COMBO(stress_combo_278, KC_F22),
+    COMBO(stress_combo_279, KC_F9),
+    COMBO(stress_combo_280, KC_F5),
+    COMBO(stress_combo_281, KC_F11),
+    COMBO(stress_combo_282, KC_PGDN),
+    COMBO(stress_combo_283, KC_DEL),
+    COMBO(stress_combo_284, KC_UP),
+    COMBO(stress_combo_285, KC_F16),
+    COMBO(stress_combo_286, KC_F1),
+    COMBO(stress_combo_287, KC_F7),
+    COMBO(stress_combo_288, KC_PGUP),
+    COMBO(stress_combo_289, KC_DEL),
+    COMBO(stress_combo_290, KC_LEFT),
+    COMBO(stress_combo_291, KC_F5),
+    COMBO(stress_combo_292, KC_F1),
+    COMBO(stress_combo_293, KC_HOME),
+    COMBO(stress_combo_294, KC_DEL),
+    COMBO(stress_combo_295, KC_F4),
+    COMBO(stress_combo_296, KC_ESC),
+    COMBO(stress_combo_297, KC_F3),
+    COMBO(stress_combo_298, KC_UP),
+    COMBO(stress_combo_299, KC_F15),
+};
+// clang-format on
@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_cache.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class KeymapCache : public TestFixture {
+   public:
+    /* Counts the keycodes QMK reads from the keymap. */
+    void get_keycode(const layer_t layer, const keypos_t position, uint16_t* result) const override {
+        keymap_reads++;
+        TestFixture::get_keycode(layer, position, result);
+    }
+
+   protected:
+    mutable uint32_t keymap_reads = 0;
+
+    /* Maps every matrix position on every layer below `layer_count`; only layer 0 holds real keycodes. */
+    void set_transparent_keymap(uint8_t layer_count) {
+        keymap.clear();
+        for (uint8_t layer = 0; layer < layer_count; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    add_key(KeymapKey(layer, col, row, layer == 0 ? KC_A : KC_TRANSPARENT));
+                }
+            }
+        }
+    }
+
+    /* Returns the average time in nanoseconds to resolve a key through all active layers, and counts the keymap reads it took. */
+    double benchmark_resolution(bool cached, unsigned iterations, uint32_t *reads) {
+        keypos_t key   = {.col = 0, .row = 0};
+        uint32_t layer = 0;
+
+        keymap_cache_invalidate();
+        layer_switch_get_layer(key);
+
+        keymap_reads = 0;
+        auto start   = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++) {
+            if (!cached) {
+                keymap_cache_invalidate();
+            }
+            layer += layer_switch_get_layer(key);
+        }
+        auto end = std::chrono::steady_clock::now();
+        *reads   = keymap_reads;
+
+        EXPECT_EQ(layer, 0);
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+};
+
+TEST_F(KeymapCache, ResolvesThroughTransparentLayers) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b  = KeymapKey(1, 0, 0, KC_TRANSPARENT);
+    auto       key_c  = KeymapKey(2, 0, 0, KC_C);
+    auto       key_lo = KeymapKey(0, 1, 0, MO(1));
+
+    set_keymap({key_a, key_b, key_c, key_lo, KeymapKey(1, 1, 0, KC_TRANSPARENT), KeymapKey(2, 1, 0, KC_TRANSPARENT)});
+
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key_c.position), 2);
+    /* Served from the cache */
+    keymap_reads = 0;
+    EXPECT_EQ(layer_switch_get_layer(key_c.position), 2);
+    EXPECT_EQ(keymap_reads, 0);
+
+    layer_off(2);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 0);
+
+    layer_clear();
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+}
+
+TEST_F(KeymapCache, MomentaryLayerOnlyDropsAffectedKeys) {
+    TestDriver driver;
+    auto       key_mo = KeymapKey(0, 0, 0, MO(1));
+    auto       key_a  = KeymapKey(0, 1, 0, KC_A);
+    auto       key_b  = KeymapKey(0, 2, 0, KC_B);
+    auto       key_c  = KeymapKey(1, 2, 0, KC_C);
+
+    set_keymap({key_mo, key_a, key_b, key_c, KeymapKey(1, 0, 0, KC_TRANSPARENT), KeymapKey(1, 1, 0, KC_TRANSPARENT)});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 0);
+
+    key_mo.press();
+    run_one_scan_loop();
+
+    /* Layer 1 may now cover every key resolved to layer 0, so both are read again */
+    keymap_reads = 0;
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(keymap_reads, 2);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+    EXPECT_EQ(keymap_reads, 3);
+
+    key_mo.release();
+    run_one_scan_loop();
+
+    /* Only the key resolved to the layer which was turned off is read again */
+    keymap_reads = 0;
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(keymap_reads, 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 0);
+    EXPECT_EQ(keymap_reads, 1);
+}
+
+TEST_F(KeymapCache, LayerChangeRefreshesReports) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_lo = KeymapKey(0, 0, 0, MO(1));
+    auto       key_a  = KeymapKey(0, 1, 0, KC_A);
+    auto       key_b  = KeymapKey(1, 1, 0, KC_B);
+
+    set_keymap({key_lo, key_a, key_b, KeymapKey(1, 0, 0, KC_TRANSPARENT)});
+
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    key_lo.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (key_b.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    key_lo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeymapCache, BenchmarkResolution) {
+    TestDriver driver;
+
+    for (uint8_t layer_count : {16, 32}) {
+        set_transparent_keymap(layer_count);
+        layer_state_set((layer_state_t)(((uint64_t)1 << layer_count) - 1));
+
+        /* Uncached lookups walk every layer through the test fixture's keymap, so keep them few */
+        uint32_t     uncached_reads, cached_reads;
+        const double uncached_ns = benchmark_resolution(false, 100, &uncached_reads);
+        const double cached_ns   = benchmark_resolution(true, 10000, &cached_reads);
+
+        // Timings depend on the build machine, so they are only recorded
+        const std::string prefix = std::to_string(layer_count) + "_layers_";
+        RecordProperty(prefix + "uncached_ns", std::to_string(uncached_ns));
+        RecordProperty(prefix + "cached_ns", std::to_string(cached_ns));
+
+        // Every layer down to the only opaque one is read when uncached, and none once the key is cached
+        EXPECT_EQ(uncached_reads, 100 * layer_count);
+        EXPECT_EQ(cached_reads, 0);
+
+        layer_clear();
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+
+// Output of `qmk json2c --compress` for the layers in `keymap_compression_reference`, kept in sync by
+// test_generate_compressed_keymap_table_unit_test_fixture in lib/python/qmk/tests/test_qmk_keymap.py
+#define KEYMAP_COMPRESSED
+const uint16_t PROGMEM keymap_compressed_fill[] = {KC_SPC, KC_TRNS, KC_TRNS, KC_TRNS, KC_NO};
+const matrix_row_t PROGMEM keymap_compressed_masks[][MATRIX_ROWS] = {
+    [0] = {0x3FF, 0x3FF, 0x3FF, 0x3CF},
+    [1] = {0x3FF, 0x0, 0x0, 0x0},
+    [2] = {0x0, 0x3C0, 0x0, 0x10},
+    [3] = {0x1, 0x0, 0x0, 0x0},
+    [4] = {0x0, 0x0, 0x0, 0x200},
+};
+const uint16_t PROGMEM keymap_compressed_offsets[][MATRIX_ROWS] = {
+    [0] = {0, 10, 20, 30},
+    [1] = {38, 48, 48, 48},
+    [2] = {48, 48, 52, 52},
+    [3] = {53, 54, 54, 54},
+    [4] = {54, 54, 54, 54},
+};
+const uint16_t PROGMEM keymap_compressed_keycodes[] = {
+    KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P, KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K, KC_L, KC_SCLN, KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH, KC_LCTL, KC_LGUI, KC_LALT, MO(1), MO(2), KC_RALT, KC_RGUI, KC_RCTL, KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0, KC_LEFT, KC_DOWN, KC_UP, KC_RGHT, KC_ENT, QK_BOOT, TO(0)
+};
+
+// Same layers as a plain table, to check the lookups against
+const uint16_t keymap_compression_reference[][MATRIX_ROWS][MATRIX_COLS] = {
+    [0] = {
+        {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P},
+        {KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K, KC_L, KC_SCLN},
+        {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH},
+        {KC_LCTL, KC_LGUI, KC_LALT, MO(1), KC_SPC, KC_SPC, MO(2), KC_RALT, KC_RGUI, KC_RCTL},
+    },
+    [1] = {
+        {KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+    },
+    [2] = {
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_LEFT, KC_DOWN, KC_UP, KC_RGHT},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_ENT, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+    },
+    [3] = {
+        {QK_BOOT, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS},
+    },
+    [4] = {
+        {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
+        {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
+        {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO},
+        {KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, TO(0)},
+    },
+};
+
+// clang-format on
+
+const size_t keymap_compressed_size   = sizeof(keymap_compressed_fill) + sizeof(keymap_compressed_masks) + sizeof(keymap_compressed_offsets) + sizeof(keymap_compressed_keycodes);
+const size_t keymap_uncompressed_size = sizeof(keymap_compression_reference);
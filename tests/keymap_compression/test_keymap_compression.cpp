@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+
+extern const uint16_t keymap_compression_reference[][MATRIX_ROWS][MATRIX_COLS];
+extern const size_t   keymap_compressed_size;
+extern const size_t   keymap_uncompressed_size;
+}
+
+static const uint8_t reference_layer_count = 5;
+
+class KeymapCompression : public TestFixture {
+   protected:
+    /* Returns the average time in nanoseconds to look up every matrix position on every layer. */
+    template <typename F>
+    double benchmark_lookup(F&& lookup, unsigned iterations) {
+        uint32_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++) {
+            for (uint8_t layer = 0; layer < reference_layer_count; layer++) {
+                for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                        sum += lookup(layer, row, col);
+                    }
+                }
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        EXPECT_NE(sum, 0);
+        return std::chrono::duration<double, std::nano>(end - start).count() / (iterations * reference_layer_count * MATRIX_ROWS * MATRIX_COLS);
+    }
+};
+
+TEST_F(KeymapCompression, MatchesUncompressedKeymap) {
+    EXPECT_EQ(keymap_layer_count(), reference_layer_count);
+    for (uint8_t layer = 0; layer < reference_layer_count; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                EXPECT_EQ(keycode_at_keymap_location_raw(layer, row, col), keymap_compression_reference[layer][row][col]) << "layer " << +layer << " row " << +row << " col " << +col;
+            }
+        }
+    }
+}
+
+TEST_F(KeymapCompression, OutOfRangeIsTransparent) {
+    EXPECT_EQ(keycode_at_keymap_location_raw(reference_layer_count, 0, 0), KC_TRANSPARENT);
+    EXPECT_EQ(keycode_at_keymap_location_raw(0, MATRIX_ROWS, 0), KC_TRANSPARENT);
+    EXPECT_EQ(keycode_at_keymap_location_raw(0, 0, MATRIX_COLS), KC_TRANSPARENT);
+}
+
+TEST_F(KeymapCompression, SmallerThanUncompressedKeymap) {
+    RecordProperty("compressed_bytes", (int)keymap_compressed_size);
+    RecordProperty("uncompressed_bytes", (int)keymap_uncompressed_size);
+    EXPECT_LT(keymap_compressed_size, keymap_uncompressed_size);
+}
+
+TEST_F(KeymapCompression, LookupBenchmark) {
+    const unsigned iterations = 20000;
+
+    double uncompressed = benchmark_lookup([](uint8_t layer, uint8_t row, uint8_t col) { return pgm_read_word(&keymap_compression_reference[layer][row][col]); }, iterations);
+    double compressed   = benchmark_lookup(keycode_at_keymap_location_raw, iterations);
+
+    RecordProperty("compressed_ns", std::to_string(compressed));
+    RecordProperty("uncompressed_ns", std::to_string(uncompressed));
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyTraceReportScheduler : public TestFixture {};
+
+TEST_F(LatencyTraceReportScheduler, HeldBackReportsAreTracedWhenSent) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 1);
+    EXPECT_LATENCY_LE(LATENCY_TRACE_PLAIN, 0);
+
+    // The tap of B waits for the next two polls, one scan after A
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 1);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(2 * USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    // Pressed at 1ms and sent at 8ms, released at 2ms and sent at 16ms
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 3);
+    EXPECT_LATENCY_GE(LATENCY_TRACE_PLAIN, 0);
+    EXPECT_LATENCY_LE(LATENCY_TRACE_PLAIN, (2 * USB_POLLING_INTERVAL_MS - 2) * 1000);
+    const latency_trace_stats_t *stats = latency_trace_get_stats(LATENCY_TRACE_PLAIN);
+    EXPECT_EQ(stats->max, (2 * USB_POLLING_INTERVAL_MS - 2) * 1000u);
+    EXPECT_EQ(stats->stage_total[LATENCY_TRACE_PROCESS_RECORD], ((USB_POLLING_INTERVAL_MS - 1) + (2 * USB_POLLING_INTERVAL_MS - 2)) * 1000u);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 4);
+}
+
+TEST_F(LatencyTraceReportScheduler, KeysWithoutReportAreNotAddedToAHeldBackOne) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b  = KeymapKey(0, 1, 0, KC_B);
+    auto       key_mo = KeymapKey(0, 2, 0, MO(1));
+    set_keymap({key_a, key_b, key_mo, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(1, 1, 0, KC_TRNS), KeymapKey(1, 2, 0, KC_TRNS)});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // B waits for the next poll, the layer key changes nothing the host sees
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    key_b.press();
+    run_one_scan_loop();
+    key_mo.press();
+    run_one_scan_loop();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 2);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_mo.release();
+    key_a.release();
+    key_b.release();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
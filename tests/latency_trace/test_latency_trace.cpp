@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+class LatencyTrace : public TestFixture {};
+
+TEST_F(LatencyTrace, PlainKeyIsReportedInItsScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 2);
+    EXPECT_LATENCY_LE(LATENCY_TRACE_PLAIN, 0);
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_TAP_HOLD, 0);
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_COMBO, 0);
+}
+
+TEST_F(LatencyTrace, HeldTapHoldKeyWaitsForTheTappingTerm) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_TAP_HOLD, 1);
+    EXPECT_LATENCY_GE(LATENCY_TRACE_TAP_HOLD, TAPPING_TERM * 1000);
+    EXPECT_LATENCY_LE(LATENCY_TRACE_TAP_HOLD, (TAPPING_TERM + 1) * 1000);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_TAP_HOLD, 2);
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 0);
+}
+
+TEST_F(LatencyTrace, TappedTapHoldKeyWaitsForItsRelease) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key, 50);
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_trace_stats_t *stats = latency_trace_get_stats(LATENCY_TRACE_TAP_HOLD);
+    EXPECT_EQ(stats->count, 2u);
+    EXPECT_EQ(stats->max, 50000u);
+    // The press waits between action_exec() and process_record()
+    EXPECT_EQ(stats->stage_total[LATENCY_TRACE_ACTION_EXEC], 50000u);
+    EXPECT_EQ(stats->histogram[16], 1u);
+}
+
+TEST_F(LatencyTrace, ComboKeysAreTracedAsCombo) {
+    TestDriver driver;
+    auto       key_y = KeymapKey(0, 2, 0, KC_Y);
+    auto       key_u = KeymapKey(0, 3, 0, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 0);
+    EXPECT_GE(latency_trace_get_stats(LATENCY_TRACE_COMBO)->count, 2u);
+    // The chord is only reported once one of its keys is released
+    EXPECT_EQ(latency_trace_get_stats(LATENCY_TRACE_COMBO)->max, 2000u);
+}
+
+TEST_F(LatencyTrace, KeysWithoutReportAreNotTraced) {
+    TestDriver driver;
+    auto       layer_key = KeymapKey(0, 4, 0, MO(1));
+    set_keymap({layer_key, KeymapKey(1, 4, 0, KC_TRNS)});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(layer_key);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    for (uint8_t path = 0; path < LATENCY_TRACE_PATH_COUNT; path++) {
+        EXPECT_EQ(latency_trace_get_stats((latency_trace_path_t)path)->count, 0u);
+    }
+}
+
+TEST_F(LatencyTrace, RawHidCommands) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    uint8_t data[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_GET_SUMMARY, LATENCY_TRACE_PLAIN};
+    ASSERT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], LATENCY_TRACE_GET_SUMMARY);
+    EXPECT_EQ(data[4], 2);
+    EXPECT_EQ(data[16], LATENCY_TRACE_BUCKETS);
+
+    memset(data, 0, sizeof(data));
+    data[0] = LATENCY_TRACE_RAW_HID_ID;
+    data[1] = LATENCY_TRACE_GET_HISTOGRAM;
+    ASSERT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[4], 2);
+
+    data[2] = LATENCY_TRACE_PATH_COUNT;
+    ASSERT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0xFF);
+
+    data[0] = 0x01;
+    EXPECT_FALSE(latency_trace_raw_hid_receive(data, sizeof(data)));
+
+    data[0] = LATENCY_TRACE_RAW_HID_ID;
+    data[1] = LATENCY_TRACE_RESET;
+    data[2] = LATENCY_TRACE_PLAIN;
+    ASSERT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_LATENCY_COUNT(LATENCY_TRACE_PLAIN, 0);
+}
@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LEADER_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
+
+SRC += ../leader_sequences.c
+
+# The leader tests again, timed out on the deferred execution timer wheel instead of by leader_task()
+SRC += $(TEST_PATH)/../test_leader.cpp
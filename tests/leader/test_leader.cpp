@@ -222,3 +222,26 @@ TEST_F(Leader, extracts_layer_tap_keycode) {
 
     idle_for(300);
 }
+
+extern "C" uint16_t leader_time;
+
+TEST_F(Leader, timeout_follows_leader_time) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+
+    set_keymap({key_leader});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+
+    // Moved on without going through leader_reset_timer()
+    idle_for(200);
+    leader_time = timer_read();
+
+    idle_for(200);
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    idle_for(150);
+    EXPECT_EQ(leader_sequence_active(), false);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define LED_MATRIX_LED_COUNT 40
+#define LED_MATRIX_LED_PROCESS_LIMIT 8
+#define LED_MATRIX_RENDER_BUDGET_US 200
+#define LED_MATRIX_DEFAULT_MODE LED_MATRIX_CUSTOM_COSTLY
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LED_MATRIX_ENABLE = yes
+LED_MATRIX_DRIVER = custom
+LED_MATRIX_CUSTOM_USER = yes
+
+INTROSPECTION_KEYMAP_C = test_led_config.c
@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+static void noop_init(void) {}
+static void noop_set_value(int index, uint8_t value) {}
+static void noop_set_value_all(uint8_t value) {}
+static void noop_flush(void) {}
+
+const led_matrix_driver_t led_matrix_driver = {
+    .init          = noop_init,
+    .set_value     = noop_set_value,
+    .set_value_all = noop_set_value_all,
+    .flush         = noop_flush,
+};
+
+// clang-format off
+#define POINT_ROW(y) {0, y}, {24, y}, {48, y}, {72, y}, {96, y}, {128, y}, {152, y}, {176, y}, {200, y}, {224, y}
+
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 },
+    }, {
+        POINT_ROW(0), POINT_ROW(21), POINT_ROW(43), POINT_ROW(64),
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 4, 4, 4, 4, 4, 4, 1, 1,
+    }
+};
+// clang-format on
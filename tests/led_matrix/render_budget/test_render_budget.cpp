@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+#include <vector>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "led_matrix.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+typedef std::vector<std::pair<uint8_t, uint8_t>> frame_t;
+
+extern "C" {
+uint32_t costly_us_per_led = 0;
+
+static std::vector<frame_t> frames;
+
+void costly_rendered(uint8_t iter, uint8_t led_min, uint8_t led_max) {
+    if (iter == 0) {
+        frames.push_back({});
+    }
+    EXPECT_FALSE(frames.empty());
+    if (!frames.empty()) {
+        frames.back().push_back({led_min, led_max});
+    }
+}
+}
+
+class RenderBudget : public TestFixture {
+   protected:
+    void SetUp() override {
+        led_matrix_enable_noeeprom();
+        led_matrix_mode_noeeprom(LED_MATRIX_CUSTOM_COSTLY);
+    }
+
+    /* Renders frames until the chunk size has settled, and returns the last
+     * complete frame. */
+    frame_t settled_frame() {
+        frames.clear();
+        idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 30);
+        EXPECT_GT(frames.size(), 2);
+        return frames.size() > 1 ? frames[frames.size() - 2] : frame_t{};
+    }
+
+    /* Every LED must be rendered exactly once per frame, in order. */
+    void expect_covers_all_leds(const frame_t &frame) {
+        uint8_t next = 0;
+        for (auto &chunk : frame) {
+            EXPECT_EQ(chunk.first, next);
+            EXPECT_GT(chunk.second, chunk.first);
+            next = chunk.second;
+        }
+        EXPECT_EQ(next, LED_MATRIX_LED_COUNT);
+    }
+};
+
+TEST_F(RenderBudget, chunk_size_follows_effect_cost) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    // 50us per LED allows 4 LEDs per 200us iteration.
+    costly_us_per_led = 50;
+    frame_t frame     = settled_frame();
+    expect_covers_all_leds(frame);
+    EXPECT_EQ(frame.size(), 10);
+    for (auto &chunk : frame) {
+        EXPECT_EQ(chunk.second - chunk.first, 4);
+    }
+
+    // 10us per LED allows 20 LEDs.
+    costly_us_per_led = 10;
+    frame             = settled_frame();
+    expect_covers_all_leds(frame);
+    EXPECT_EQ(frame.size(), 2);
+
+    // A cheap effect renders everything at once.
+    costly_us_per_led = 1;
+    frame             = settled_frame();
+    expect_covers_all_leds(frame);
+    EXPECT_EQ(frame.size(), 1);
+
+    // An effect slower than the budget still makes progress.
+    costly_us_per_led = 500;
+    frame             = settled_frame();
+    expect_covers_all_leds(frame);
+    EXPECT_EQ(frame.size(), LED_MATRIX_LED_COUNT);
+}
+
+TEST_F(RenderBudget, new_effect_starts_from_process_limit) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    costly_us_per_led = 1;
+    settled_frame();
+
+    // Switching effects forgets the measured cost, so the first chunk of the
+    // new effect is bounded by LED_MATRIX_LED_PROCESS_LIMIT again.
+    led_matrix_mode_noeeprom(LED_MATRIX_SOLID);
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 2);
+    frames.clear();
+    costly_us_per_led = 50;
+    led_matrix_mode_noeeprom(LED_MATRIX_CUSTOM_COSTLY);
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 2);
+    ASSERT_FALSE(frames.empty());
+    ASSERT_FALSE(frames[0].empty());
+    EXPECT_EQ(frames[0][0].first, 0);
+    EXPECT_EQ(frames[0][0].second, LED_MATRIX_LED_PROCESS_LIMIT);
+}
@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "matrix_event_queue.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class MatrixEventQueue : public TestFixture {};
+
+TEST_F(MatrixEventQueue, KeyPressAndReleaseAreProcessed) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    key.press();
+    EXPECT_REPORT(driver, (key.report_code));
+    run_one_scan_loop();
+    EXPECT_TRUE(matrix_event_queue_is_empty());
+
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_TRUE(matrix_event_queue_is_empty());
+}
+
+TEST_F(MatrixEventQueue, KeysChangedInOneScanAreProcessedInMatrixOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_b = KeymapKey(0, 3, 1, KC_B);
+    auto       key_c = KeymapKey(0, 1, 2, KC_C);
+    auto       key_d = KeymapKey(0, 9, 1, KC_D);
+
+    set_keymap({key_b, key_c, key_d});
+
+    key_c.press();
+    key_d.press();
+    key_b.press();
+    EXPECT_REPORT(driver, (key_b.report_code));
+    EXPECT_REPORT(driver, (key_b.report_code, key_d.report_code));
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code, key_d.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    EXPECT_REPORT(driver, (key_c.report_code, key_d.report_code));
+    EXPECT_REPORT(driver, (key_c.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixEventQueue, OverflowFallsBackToFullMatrixResync) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+    auto       key_f = KeymapKey(0, 5, 0, KC_F);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e, key_f});
+
+    /* Six changes in one scan overflow the four entry queue */
+    for (auto key : {key_a, key_b, key_c, key_d, key_e, key_f}) {
+        key.press();
+    }
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code, key_e.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code, key_e.report_code, key_f.report_code));
+    run_one_scan_loop();
+    EXPECT_TRUE(matrix_event_queue_is_empty());
+    VERIFY_AND_CLEAR(driver);
+
+    /* Queued processing resumes after the resync */
+    key_a.release();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code, key_d.report_code, key_e.report_code, key_f.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    for (auto key : {key_b, key_c, key_d, key_e, key_f}) {
+        key.release();
+    }
+    EXPECT_REPORT(driver, (key_c.report_code, key_d.report_code, key_e.report_code, key_f.report_code));
+    EXPECT_REPORT(driver, (key_d.report_code, key_e.report_code, key_f.report_code));
+    EXPECT_REPORT(driver, (key_e.report_code, key_f.report_code));
+    EXPECT_REPORT(driver, (key_f.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixEventQueue, ScanWithoutSyncFallsBackToFullMatrixResync) {
+    // A matrix_scan() which does not report to the queue leaves it out of date
+    EXPECT_TRUE(matrix_event_queue_take_resync());
+
+    matrix_event_queue_sync();
+    EXPECT_FALSE(matrix_event_queue_take_resync());
+    EXPECT_TRUE(matrix_event_queue_take_resync());
+}
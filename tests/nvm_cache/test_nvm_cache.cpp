@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom_driver.h"
+#include "nvm_cache.h"
+#include "nvm_eeprom_cache_internal.h"
+}
+
+// Counting EEPROM backend, standing in for the driver of an actual keyboard
+static uint8_t  backing_store[EEPROM_SIZE];
+static uint32_t backing_reads;
+static uint32_t backing_writes;
+static uint32_t backing_bytes_written;
+
+extern "C" void eeprom_driver_init(void) {}
+
+extern "C" void eeprom_driver_erase(void) {
+    memset(backing_store, 0x00, sizeof(backing_store));
+}
+
+extern "C" void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    ++backing_reads;
+    memcpy(buf, &backing_store[(uintptr_t)addr], len);
+}
+
+extern "C" void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    ++backing_writes;
+    backing_bytes_written += len;
+    memcpy(&backing_store[(uintptr_t)addr], buf, len);
+}
+
+// Size of the keymap upload chunks sent by VIA, a 32-byte report less the command header
+static const uint16_t via_chunk_size = 28;
+static const uint16_t keymap_size    = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+class NvmCache : public TestFixture {
+   protected:
+    NvmCache() {
+        nvm_cache_flush();
+        reset_counts();
+    }
+
+    void reset_counts() {
+        backing_reads         = 0;
+        backing_writes        = 0;
+        backing_bytes_written = 0;
+    }
+
+    // Sends a whole keymap the way VIA does, where every keycode is derived from `seed`
+    void upload_keymap(uint8_t seed) {
+        uint8_t keymap[keymap_size];
+        for (uint16_t i = 0; i < keymap_size; i++) {
+            keymap[i] = seed + i;
+        }
+        for (uint16_t offset = 0; offset < keymap_size; offset += via_chunk_size) {
+            dynamic_keymap_set_buffer(offset, MIN(via_chunk_size, keymap_size - offset), &keymap[offset]);
+        }
+    }
+
+    uint16_t expected_keycode(uint8_t seed, uint8_t layer, uint8_t row, uint8_t col) {
+        uint16_t offset = ((layer * MATRIX_ROWS + row) * MATRIX_COLS + col) * 2;
+        return ((uint8_t)(seed + offset) << 8) | (uint8_t)(seed + offset + 1);
+    }
+
+    void verify_keymap(uint8_t seed) {
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, col), expected_keycode(seed, layer, row, col)) << "Keycode mismatch at layer " << +layer << ", row " << +row << ", col " << +col;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(NvmCache, KeymapUploadIsBatched) {
+    TestDriver driver;
+
+    upload_keymap(0x10);
+    EXPECT_EQ(backing_writes, 0) << "Upload was written through to the EEPROM";
+    EXPECT_TRUE(nvm_cache_is_dirty());
+
+    // Keep uploading while the host is busy, nothing is committed until it stops
+    idle_for(NVM_CACHE_FLUSH_DELAY / 2);
+    upload_keymap(0x20);
+    idle_for(NVM_CACHE_FLUSH_DELAY / 2);
+    EXPECT_EQ(backing_writes, 0) << "Upload was committed before writes stopped";
+
+    idle_for(NVM_CACHE_FLUSH_DELAY);
+    EXPECT_FALSE(nvm_cache_is_dirty()) << "Upload was not committed once idle";
+
+    // One write per page touched by the keymap, versus one per chunk and upload without the cache
+    const uint32_t pages = keymap_size / NVM_CACHE_PAGE_SIZE + 2;
+    RecordProperty("keymap_bytes", keymap_size);
+    RecordProperty("eeprom_writes", (int)backing_writes);
+    RecordProperty("eeprom_bytes_written", (int)backing_bytes_written);
+    RecordProperty("uncached_eeprom_writes", 2 * ((keymap_size + via_chunk_size - 1) / via_chunk_size));
+    EXPECT_LE(backing_writes, pages);
+    EXPECT_LE(backing_bytes_written, keymap_size);
+
+    nvm_eeprom_cache_invalidate();
+    verify_keymap(0x20);
+}
+
+TEST_F(NvmCache, KeycodeReadsComeFromRam) {
+    TestDriver driver;
+
+    upload_keymap(0x30);
+    reset_counts();
+    verify_keymap(0x30);
+    EXPECT_EQ(backing_reads, 0) << "Keycode lookup went to the EEPROM";
+}
+
+TEST_F(NvmCache, UnchangedUploadIsSkipped) {
+    TestDriver driver;
+
+    upload_keymap(0x40);
+    nvm_cache_flush();
+    reset_counts();
+
+    upload_keymap(0x40);
+    EXPECT_FALSE(nvm_cache_is_dirty()) << "Unchanged keymap was marked for writing";
+    EXPECT_EQ(backing_reads, 0);
+    EXPECT_EQ(backing_writes, 0);
+}
+
+TEST_F(NvmCache, SuspendCommitsPendingWrites) {
+    TestDriver driver;
+
+    dynamic_keymap_set_keycode(1, 2, 3, KC_B);
+    EXPECT_EQ(backing_writes, 0);
+
+    suspend_power_down_quantum();
+    EXPECT_FALSE(nvm_cache_is_dirty()) << "Suspend did not commit pending writes";
+    EXPECT_EQ(backing_writes, 1);
+
+    // Reload from the EEPROM, as on the next power up
+    nvm_eeprom_cache_invalidate();
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_B);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Enough for every glyph on the status screen
+#define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 96
@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../drawtext.hpp"
+
+TEST_F(DrawText, cached) {
+    draw_frames();
+    EXPECT_EQ(surface_hash(), DRAWTEXT_GOLDEN_HASH);
+
+    // Every string is sent in one go
+    benchmark("cached");
+    EXPECT_EQ(drawtext_viewport_count, calls);
+}
+
+TEST_F(DrawText, single_viewport_per_string) {
+    drawtext_viewport_count = 0;
+    drawtext(10, 100, large_font, "QMK 123", 0);
+    EXPECT_EQ(drawtext_viewport_count, 1);
+}
+
+TEST_F(DrawText, closed_font_leaves_cache) {
+    drawtext(10, 100, small_font, "abc", 0);
+    qp_close_font(small_font);
+
+    // The slot is reused by the other font, which must not pick up the glyphs cached for the first
+    small_font = qp_load_font_mem(font_robotomono20);
+    ASSERT_NE(small_font, nullptr);
+    drawtext(10, 100, large_font, "abc", 0);
+    uint32_t expected = surface_hash();
+    drawtext(10, 100, small_font, "abc", 0);
+    EXPECT_EQ(surface_hash(), expected);
+}
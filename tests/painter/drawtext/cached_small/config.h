@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Fewer glyphs than a single string needs, with only the narrower glyphs of the small font fitting
+#define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 3
+#define QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES 8
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../drawtext.hpp"
+
+TEST_F(DrawText, cached_small) {
+    draw_frames();
+    EXPECT_EQ(surface_hash(), DRAWTEXT_GOLDEN_HASH);
+
+    // Runs of cached glyphs share a viewport, the glyphs which do not fit are sent separately: 8, 7, 15, 8 and 2 for the strings of each frame
+    benchmark("cached_small");
+    EXPECT_EQ(drawtext_viewport_count, calls * 8);
+}
@@ -0,0 +1,127 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+#include "robotomono20.qff.h"
+#ifdef DRAWTEXT_SMALL_FONT_RLE
+#    include "thintel15_rle.qff.h"
+#    define DRAWTEXT_SMALL_FONT font_thintel15_rle
+#else
+#    include "thintel15.qff.h"
+#    define DRAWTEXT_SMALL_FONT font_thintel15
+#endif
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define DRAWTEXT_PANEL_WIDTH 240
+#define DRAWTEXT_PANEL_HEIGHT 240
+#define DRAWTEXT_FRAMES 200
+
+// Hash of the surface after drawing every frame, the same whether or not glyphs are cached or compressed
+#define DRAWTEXT_GOLDEN_HASH 0x33FCA2B2
+
+static uint32_t drawtext_viewport_count;
+
+static bool drawtext_counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    drawtext_viewport_count++;
+    return rgb565_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static bool drawtext_discard_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    return true;
+}
+
+/* Renders the same status screen repeatedly onto a surface, which uses the
+ * dummy comms driver. The resulting pixels are compared against a hash which
+ * is shared by every glyph cache configuration.
+ *
+ * The benchmark then renders it again without writing the pixels into the
+ * surface, reporting how long each qp_drawtext() call took and how many
+ * viewports it set -- on a real display each viewport is a separate set of
+ * commands sent to the panel. */
+class DrawText : public testing::Test {
+   protected:
+    void SetUp() override {
+        std::memset(surface_drivers, 0, sizeof(surface_drivers));
+
+        surface_vtable               = rgb565_surface_driver_vtable;
+        surface_vtable.base.viewport = drawtext_counting_viewport;
+
+        surface = qp_make_rgb565_surface(DRAWTEXT_PANEL_WIDTH, DRAWTEXT_PANEL_HEIGHT, surface_buffer);
+        ((painter_driver_t *)surface)->driver_vtable = (const painter_driver_vtable_t *)&surface_vtable;
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        small_font = qp_load_font_mem(DRAWTEXT_SMALL_FONT);
+        large_font = qp_load_font_mem(font_robotomono20);
+        ASSERT_NE(small_font, nullptr);
+        ASSERT_NE(large_font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(small_font);
+        qp_close_font(large_font);
+    }
+
+    int16_t drawtext(uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue) {
+        const auto start = std::chrono::steady_clock::now();
+        int16_t    width = qp_drawtext_recolor(surface, x, y, font, str, hue, 255, 255, 0, 0, 0);
+        elapsed += std::chrono::steady_clock::now() - start;
+        calls++;
+        EXPECT_EQ(width, qp_textwidth(font, str)) << str;
+        return width;
+    }
+
+    void draw_frames() {
+        drawtext_viewport_count = 0;
+        elapsed                 = std::chrono::nanoseconds{0};
+        calls                   = 0;
+
+        char buf[32];
+        for (uint32_t frame = 0; frame < DRAWTEXT_FRAMES; frame++) {
+            std::snprintf(buf, sizeof(buf), "WPM: %3u", (unsigned)((frame * 7) % 250));
+            drawtext(4, 4, large_font, buf, 85);
+            std::snprintf(buf, sizeof(buf), "Layer %u", (unsigned)(frame / 40));
+            drawtext(4, 30, large_font, buf, 170);
+            drawtext(4, 60, small_font, "The quick brown fox jumps over", frame % 256);
+            drawtext(4, 72, small_font, "the lazy dog! 0123456789", 255 - frame % 256);
+            std::snprintf(buf, sizeof(buf), "%02u:%02u", (unsigned)(frame / 60), (unsigned)(frame % 60));
+            drawtext(180, 220, small_font, buf, 0);
+        }
+    }
+
+    void benchmark(const char *name) {
+        surface_vtable.base.pixdata = drawtext_discard_pixdata;
+        draw_frames();
+        surface_vtable.base.pixdata = rgb565_surface_driver_vtable.base.pixdata;
+        RecordProperty(std::string(name) + "_ns_per_call", std::to_string((double)elapsed.count() / calls));
+        RecordProperty(std::string(name) + "_viewports_per_call", std::to_string((double)drawtext_viewport_count / calls));
+    }
+
+    uint32_t surface_hash() {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < sizeof(surface_buffer); i++) {
+            hash = (hash ^ surface_buffer[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    surface_painter_driver_vtable_t surface_vtable;
+    painter_device_t                surface;
+    painter_font_handle_t           small_font;
+    painter_font_handle_t           large_font;
+    std::chrono::nanoseconds        elapsed;
+    uint32_t                        calls;
+    uint8_t                         surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(DRAWTEXT_PANEL_WIDTH, DRAWTEXT_PANEL_HEIGHT, 16)];
+};
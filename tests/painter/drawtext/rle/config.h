@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// The same cache as cached_small, so that the narrower glyphs are decoded into it and the rest are streamed
+#define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 3
+#define QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES 8
+
+// robotomono20.qff.c is already RLE compressed, this swaps the small font for a compressed one too
+#define DRAWTEXT_SMALL_FONT_RLE
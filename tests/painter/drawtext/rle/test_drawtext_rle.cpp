@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../drawtext.hpp"
+
+TEST_F(DrawText, rle) {
+    draw_frames();
+    EXPECT_EQ(surface_hash(), DRAWTEXT_GOLDEN_HASH);
+
+    // Compression does not change which glyphs fit in the cache
+    benchmark("rle");
+    EXPECT_EQ(drawtext_viewport_count, calls * 8);
+}
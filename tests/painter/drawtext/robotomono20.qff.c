@@ -0,0 +1,163 @@
+// Copyright 2024 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image -i robotomono20.png -f mono2`
+
+#include <qp.h>
+
+const uint32_t font_robotomono20_length = 2396;
+
+// clang-format off
+const uint8_t font_robotomono20[2396] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0x5C, 0x09, 0x00, 0x00, 0xA3, 0xF6, 0xFF,
+    0xFF, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x05, 0x00,
+    0x00, 0x85, 0x00, 0x00, 0x06, 0x04, 0x00, 0x4D, 0x06, 0x00, 0x0B, 0x0D, 0x00, 0x4F, 0x14, 0x00,
+    0x4D, 0x1C, 0x00, 0x43, 0x23, 0x00, 0xC7, 0x24, 0x00, 0x07, 0x2A, 0x00, 0x89, 0x2F, 0x00, 0x4B,
+    0x33, 0x00, 0x04, 0x38, 0x00, 0xC6, 0x39, 0x00, 0x85, 0x3B, 0x00, 0x48, 0x3D, 0x00, 0xCB, 0x42,
+    0x00, 0xCB, 0x48, 0x00, 0xCB, 0x4E, 0x00, 0x0B, 0x55, 0x00, 0x0B, 0x5B, 0x00, 0x0B, 0x61, 0x00,
+    0x0B, 0x67, 0x00, 0x0B, 0x6D, 0x00, 0x0B, 0x73, 0x00, 0x0B, 0x79, 0x00, 0x05, 0x7F, 0x00, 0xC4,
+    0x81, 0x00, 0x8A, 0x84, 0x00, 0xCB, 0x88, 0x00, 0x4A, 0x8C, 0x00, 0x49, 0x90, 0x00, 0xD2, 0x95,
+    0x00, 0x0D, 0xA1, 0x00, 0x0C, 0xA8, 0x00, 0xCD, 0xAE, 0x00, 0x0D, 0xB6, 0x00, 0xCB, 0xBC, 0x00,
+    0x0B, 0xC3, 0x00, 0x0E, 0xC9, 0x00, 0x8E, 0xD0, 0x00, 0x05, 0xD8, 0x00, 0x8B, 0xDB, 0x00, 0x4D,
+    0xE1, 0x00, 0x8B, 0xE8, 0x00, 0xD1, 0xEE, 0x00, 0x8E, 0xF7, 0x00, 0x0E, 0xFF, 0x00, 0xCD, 0x06,
+    0x01, 0x8E, 0x0D, 0x01, 0xCC, 0x15, 0x01, 0x8C, 0x1C, 0x01, 0x0C, 0x23, 0x01, 0x8D, 0x29, 0x01,
+    0x8D, 0x30, 0x01, 0x92, 0x37, 0x01, 0xCD, 0x40, 0x01, 0xCC, 0x47, 0x01, 0x4C, 0x4E, 0x01, 0x06,
+    0x55, 0x01, 0x89, 0x59, 0x01, 0x45, 0x5F, 0x01, 0x08, 0x63, 0x01, 0x09, 0x66, 0x01, 0xC6, 0x67,
+    0x01, 0x8B, 0x69, 0x01, 0xCB, 0x6E, 0x01, 0x4A, 0x75, 0x01, 0x0B, 0x7A, 0x01, 0x8B, 0x80, 0x01,
+    0x87, 0x85, 0x01, 0x0B, 0x8A, 0x01, 0x8B, 0x90, 0x01, 0x45, 0x97, 0x01, 0xC5, 0x9A, 0x01, 0x8B,
+    0x9E, 0x01, 0x45, 0xA5, 0x01, 0xD2, 0xA8, 0x01, 0x4B, 0xB0, 0x01, 0x8B, 0xB5, 0x01, 0x8B, 0xBA,
+    0x01, 0xCB, 0xC0, 0x01, 0x47, 0xC7, 0x01, 0x0A, 0xCB, 0x01, 0xC7, 0xCF, 0x01, 0x4B, 0xD4, 0x01,
+    0x8A, 0xD9, 0x01, 0x4F, 0xDE, 0x01, 0x0A, 0xE5, 0x01, 0x0A, 0xEA, 0x01, 0x0A, 0xF0, 0x01, 0x07,
+    0xF5, 0x01, 0xC5, 0xFA, 0x01, 0x87, 0xFE, 0x01, 0x0E, 0x04, 0x02, 0x04, 0xFB, 0x1C, 0x08, 0x00,
+    0x0E, 0x00, 0x02, 0x00, 0x88, 0xC6, 0x08, 0x21, 0x84, 0x10, 0x42, 0x00, 0x60, 0x04, 0x03, 0x00,
+    0x85, 0x00, 0x60, 0x59, 0x96, 0x25, 0x01, 0x0B, 0x00, 0x05, 0x00, 0x95, 0x30, 0x03, 0x22, 0x40,
+    0x04, 0xFF, 0x83, 0x19, 0x30, 0x03, 0x22, 0x40, 0x04, 0xFF, 0x83, 0x19, 0x30, 0x03, 0x66, 0x40,
+    0x04, 0x88, 0x09, 0x00, 0x02, 0x00, 0x97, 0x03, 0x18, 0xE0, 0xC1, 0x1F, 0x86, 0x11, 0x8C, 0x41,
+    0x1C, 0xC0, 0x03, 0x78, 0x00, 0x07, 0x30, 0x83, 0x19, 0x8C, 0x3F, 0xF8, 0x00, 0x01, 0x08, 0x05,
+    0x00, 0x05, 0x00, 0x9A, 0x80, 0x03, 0x60, 0x02, 0x10, 0x23, 0x88, 0x19, 0xC4, 0x04, 0x26, 0x01,
+    0xDE, 0x00, 0xA0, 0x03, 0x68, 0x02, 0x16, 0x03, 0x89, 0x41, 0xC4, 0x20, 0x26, 0x00, 0x0E, 0x0A,
+    0x00, 0x05, 0x00, 0x96, 0x78, 0x80, 0x1F, 0x18, 0x03, 0x63, 0x60, 0x0C, 0xF8, 0x00, 0x07, 0xF0,
+    0x01, 0x67, 0x62, 0x5C, 0x0C, 0x8F, 0xC1, 0xE1, 0x3F, 0xF8, 0x0C, 0x08, 0x00, 0x82, 0x80, 0x24,
+    0x09, 0x06, 0x00, 0x93, 0x00, 0x10, 0x0C, 0x82, 0x41, 0x30, 0x18, 0x04, 0x83, 0xC1, 0x60, 0x30,
+    0x10, 0x18, 0x0C, 0x04, 0x06, 0x02, 0x03, 0x01, 0x80, 0x00, 0x02, 0x80, 0x8E, 0xC0, 0x40, 0x60,
+    0x30, 0x18, 0x08, 0x04, 0x06, 0x81, 0x60, 0x30, 0x18, 0x04, 0x83, 0x20, 0x02, 0x00, 0x03, 0x00,
+    0x89, 0x80, 0x00, 0x41, 0x92, 0x3F, 0x1C, 0x3C, 0xC8, 0x10, 0x01, 0x0C, 0x00, 0x07, 0x00, 0x8D,
+    0x30, 0x80, 0x01, 0x0C, 0x60, 0xF0, 0xBF, 0xFF, 0xC0, 0x00, 0x06, 0x30, 0x80, 0x01, 0x0A, 0x00,
+    0x07, 0x00, 0x83, 0x60, 0x66, 0x22, 0x00, 0x07, 0x00, 0x81, 0xF0, 0x01, 0x08, 0x00, 0x09, 0x00,
+    0x81, 0x60, 0x04, 0x03, 0x00, 0x03, 0x00, 0x02, 0x40, 0x82, 0x60, 0x20, 0x30, 0x02, 0x10, 0x81,
+    0x18, 0x08, 0x02, 0x0C, 0x83, 0x04, 0x06, 0x02, 0x03, 0x04, 0x00, 0x04, 0x00, 0x92, 0xF0, 0xC1,
+    0x1F, 0x86, 0x19, 0xCC, 0x60, 0x06, 0x33, 0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x31, 0x8C, 0x3F,
+    0xF8, 0x08, 0x00, 0x04, 0x00, 0x02, 0x80, 0x90, 0x07, 0x3E, 0x80, 0x01, 0x0C, 0x60, 0x00, 0x03,
+    0x18, 0xC0, 0x00, 0x06, 0x30, 0x80, 0x01, 0x0C, 0x60, 0x08, 0x00, 0x04, 0x00, 0x93, 0xF0, 0xC1,
+    0x1F, 0x83, 0x19, 0x0C, 0x60, 0x00, 0x01, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x01,
+    0xFE, 0x07, 0x07, 0x00, 0x04, 0x00, 0x92, 0xF0, 0xC1, 0x1F, 0x83, 0x19, 0x0C, 0x60, 0x80, 0x81,
+    0x07, 0x78, 0x00, 0x06, 0x30, 0x83, 0x19, 0x8C, 0x3F, 0xF8, 0x08, 0x00, 0x05, 0x00, 0x92, 0x03,
+    0x1C, 0xF0, 0x80, 0x06, 0x36, 0x98, 0x61, 0x0C, 0x63, 0x0C, 0xE3, 0x7F, 0xC0, 0x00, 0x06, 0x30,
+    0x80, 0x01, 0x07, 0x00, 0x04, 0x00, 0x92, 0xF0, 0x87, 0x3F, 0x06, 0x30, 0x80, 0x01, 0xFC, 0xE0,
+    0x0F, 0xC0, 0x00, 0x06, 0x20, 0x82, 0x31, 0x8C, 0x3F, 0xF0, 0x08, 0x00, 0x04, 0x00, 0x92, 0xC0,
+    0x01, 0x0F, 0x0C, 0x30, 0x80, 0x01, 0xF4, 0xF0, 0x8F, 0xC3, 0x0C, 0x66, 0x30, 0x82, 0x31, 0x0C,
+    0x3F, 0xF0, 0x08, 0x00, 0x04, 0x00, 0x92, 0xFC, 0x07, 0x30, 0x80, 0x01, 0x04, 0x30, 0x80, 0x00,
+    0x06, 0x10, 0xC0, 0x00, 0x06, 0x18, 0xC0, 0x00, 0x03, 0x18, 0x08, 0x00, 0x04, 0x00, 0x92, 0xF0,
+    0xC1, 0x1F, 0x86, 0x19, 0x8C, 0x60, 0x8C, 0xC1, 0x07, 0x7F, 0x08, 0x66, 0x30, 0x83, 0x19, 0x8C,
+    0x3F, 0xF8, 0x08, 0x00, 0x04, 0x00, 0x92, 0xF0, 0xC0, 0x1F, 0xC3, 0x18, 0xCC, 0x60, 0x06, 0x33,
+    0x18, 0xFF, 0xF0, 0x06, 0x30, 0xC0, 0x00, 0x07, 0x1F, 0x38, 0x08, 0x00, 0x04, 0x00, 0x80, 0x31,
+    0x04, 0x00, 0x81, 0x30, 0x04, 0x03, 0x00, 0x03, 0x00, 0x80, 0x66, 0x03, 0x00, 0x83, 0x60, 0x66,
+    0x26, 0x00, 0x08, 0x00, 0x81, 0x10, 0x70, 0x02, 0x78, 0x86, 0x60, 0x80, 0x07, 0x78, 0x00, 0x07,
+    0x10, 0x09, 0x00, 0x0B, 0x00, 0x82, 0xFE, 0xE3, 0x0F, 0x02, 0x00, 0x82, 0xE0, 0x3F, 0xFE, 0x0C,
+    0x00, 0x07, 0x00, 0x86, 0x20, 0x80, 0x07, 0x78, 0x80, 0x07, 0x38, 0x03, 0x78, 0x80, 0x20, 0x0A,
+    0x00, 0x03, 0x00, 0x85, 0xC0, 0xE3, 0xCF, 0xB0, 0x60, 0x40, 0x03, 0xC0, 0x80, 0x80, 0x02, 0x01,
+    0x02, 0x00, 0x81, 0x08, 0x10, 0x06, 0x00, 0x07, 0x00, 0xA7, 0xE0, 0x03, 0xE0, 0x38, 0xC0, 0x80,
+    0x81, 0x01, 0x0C, 0xC3, 0x23, 0x84, 0x89, 0x11, 0x23, 0x64, 0x84, 0x90, 0x11, 0x42, 0x66, 0x08,
+    0x99, 0x31, 0x66, 0xC6, 0x08, 0xB1, 0x33, 0x84, 0x79, 0x30, 0x00, 0x80, 0x01, 0x00, 0x1C, 0x02,
+    0xC0, 0x0F, 0x03, 0x00, 0x05, 0x00, 0x96, 0x60, 0x00, 0x0E, 0xC0, 0x01, 0x6C, 0x80, 0x0D, 0x10,
+    0x01, 0x63, 0x60, 0x0C, 0x06, 0xC3, 0x7F, 0xF8, 0x8F, 0x01, 0x33, 0x60, 0x03, 0x18, 0x08, 0x00,
+    0x04, 0x00, 0x95, 0xC0, 0x1F, 0xFC, 0xC3, 0x60, 0x0C, 0xC6, 0x60, 0x0C, 0xC3, 0x1F, 0xFC, 0xC3,
+    0x60, 0x0C, 0xC6, 0x60, 0x0C, 0xC6, 0x3F, 0xFC, 0x01, 0x07, 0x00, 0x05, 0x00, 0x8F, 0xF0, 0x80,
+    0x7F, 0x18, 0x0C, 0x03, 0x33, 0x60, 0x06, 0xC0, 0x00, 0x18, 0x00, 0x03, 0x60, 0xC0, 0x02, 0x18,
+    0x84, 0x83, 0xC1, 0x3F, 0xF0, 0x01, 0x08, 0x00, 0x05, 0x00, 0x95, 0x7E, 0xC0, 0x3F, 0x18, 0x0E,
+    0x83, 0x61, 0x60, 0x0C, 0x8C, 0x81, 0x31, 0x30, 0x06, 0xC6, 0xC0, 0x18, 0x0C, 0xC3, 0xE1, 0x1F,
+    0xFC, 0x09, 0x00, 0x04, 0x00, 0x93, 0xF8, 0xCF, 0x3F, 0x06, 0x30, 0x80, 0x01, 0x0C, 0xE0, 0x1F,
+    0x7F, 0x18, 0xC0, 0x00, 0x06, 0x30, 0x80, 0x7F, 0xFC, 0x07, 0x07, 0x00, 0x04, 0x00, 0x92, 0xF8,
+    0xC7, 0x3F, 0x06, 0x30, 0x80, 0x01, 0x0C, 0xE0, 0x1F, 0x7F, 0x18, 0xC0, 0x00, 0x06, 0x30, 0x80,
+    0x01, 0x0C, 0x08, 0x00, 0x05, 0x00, 0x98, 0xC0, 0x07, 0xF8, 0x07, 0x83, 0xC3, 0xC0, 0x18, 0x00,
+    0x06, 0x80, 0xE1, 0x63, 0xF8, 0x18, 0x30, 0x06, 0x0C, 0x03, 0xC3, 0xC1, 0xE0, 0x1F, 0xE0, 0x03,
+    0x09, 0x00, 0x05, 0x00, 0x98, 0x30, 0x60, 0x0C, 0x18, 0x03, 0xC6, 0x80, 0x31, 0x60, 0x0C, 0x18,
+    0xFF, 0xC7, 0xFF, 0x31, 0x60, 0x0C, 0x18, 0x03, 0xC6, 0x80, 0x31, 0x60, 0x0C, 0x18, 0x09, 0x00,
+    0x02, 0x00, 0x88, 0xC6, 0x18, 0x63, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x0C, 0x03, 0x00, 0x05, 0x00,
+    0x91, 0x06, 0x30, 0x80, 0x01, 0x0C, 0x60, 0x00, 0x03, 0x18, 0xC0, 0x00, 0x06, 0x10, 0xC1, 0x18,
+    0xC6, 0x3F, 0x78, 0x08, 0x00, 0x05, 0x00, 0x8E, 0x06, 0xC7, 0x60, 0x18, 0x06, 0x63, 0x60, 0x06,
+    0x6C, 0x80, 0x0F, 0xF0, 0x03, 0x66, 0xC0, 0x02, 0x18, 0x83, 0x06, 0xC3, 0x61, 0x30, 0x02, 0x0C,
+    0x08, 0x00, 0x04, 0x00, 0x93, 0x18, 0xC0, 0x00, 0x06, 0x30, 0x80, 0x01, 0x0C, 0x60, 0x00, 0x03,
+    0x18, 0xC0, 0x00, 0x06, 0x30, 0x80, 0x7F, 0xFC, 0x03, 0x07, 0x00, 0x06, 0x00, 0x9D, 0x60, 0x00,
+    0xC7, 0x01, 0x8E, 0x03, 0x1E, 0x0F, 0x3C, 0x1A, 0x68, 0x34, 0xD8, 0xC8, 0xB0, 0x91, 0x31, 0x63,
+    0x66, 0xC6, 0x6C, 0x8C, 0xD1, 0x18, 0xE3, 0x30, 0xC6, 0x61, 0x0C, 0xC3, 0x0B, 0x00, 0x05, 0x00,
+    0x98, 0x30, 0x60, 0x1C, 0x18, 0x07, 0xC6, 0x83, 0xF1, 0x61, 0x6C, 0x18, 0x33, 0xC6, 0x9C, 0x31,
+    0x66, 0x0C, 0x1B, 0xC3, 0xC7, 0xE0, 0x31, 0x70, 0x0C, 0x1C, 0x09, 0x00, 0x05, 0x00, 0x93, 0x80,
+    0x07, 0xF8, 0x07, 0x83, 0xC3, 0xC0, 0x18, 0x30, 0x06, 0x88, 0x01, 0x66, 0x80, 0x19, 0x20, 0x06,
+    0x0C, 0x03, 0xC3, 0x02, 0xE0, 0x82, 0x1F, 0xE0, 0x01, 0x09, 0x00, 0x05, 0x00, 0x95, 0xFE, 0xC0,
+    0x7F, 0x18, 0x0C, 0x03, 0x63, 0x60, 0x0C, 0x8C, 0xC1, 0xF0, 0x0F, 0x3E, 0xC0, 0x00, 0x18, 0x00,
+    0x03, 0x60, 0x00, 0x0C, 0x09, 0x00, 0x05, 0x00, 0x9B, 0xC0, 0x07, 0xF8, 0x07, 0x83, 0xC1, 0xC0,
+    0x18, 0x30, 0x06, 0x88, 0x01, 0x62, 0x80, 0x19, 0x20, 0x06, 0x0C, 0x03, 0xC3, 0x60, 0xE0, 0x1F,
+    0xF0, 0x07, 0x80, 0x03, 0xC0, 0x06, 0x00, 0x04, 0x00, 0x93, 0xC0, 0x1F, 0xFC, 0xC3, 0x60, 0x0C,
+    0xC6, 0x60, 0x0C, 0xC6, 0x70, 0xFC, 0xC3, 0x1F, 0x8C, 0xC1, 0x30, 0x0C, 0xC6, 0x60, 0x02, 0x0C,
+    0x07, 0x00, 0x05, 0x00, 0x94, 0x0F, 0xFC, 0xE3, 0x70, 0x06, 0x66, 0x00, 0x1C, 0x80, 0x0F, 0xE0,
+    0x03, 0x70, 0x00, 0x66, 0x60, 0x06, 0xC6, 0x3F, 0xF0, 0x01, 0x07, 0x00, 0x04, 0x00, 0x94, 0xF0,
+    0x7F, 0xFE, 0x07, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06,
+    0x60, 0x00, 0x06, 0x60, 0x08, 0x00, 0x05, 0x00, 0x96, 0x03, 0x66, 0xC0, 0x0C, 0x98, 0x01, 0x33,
+    0x60, 0x06, 0xCC, 0x80, 0x19, 0x30, 0x03, 0x66, 0xC0, 0x08, 0x18, 0x83, 0xC1, 0x1F, 0xF0, 0x01,
+    0x08, 0x00, 0x04, 0x00, 0x96, 0x80, 0x01, 0x66, 0xC0, 0x0C, 0x18, 0x83, 0x61, 0x30, 0x0C, 0x03,
+    0x63, 0x60, 0x0C, 0xCC, 0x00, 0x1B, 0x60, 0x03, 0x38, 0x00, 0x07, 0x60, 0x09, 0x00, 0x06, 0x00,
+    0x9B, 0x80, 0xC1, 0x60, 0x06, 0x83, 0x19, 0x0E, 0x66, 0x78, 0x08, 0xE3, 0x31, 0x8C, 0xC4, 0x30,
+    0x33, 0xC3, 0xCC, 0x04, 0x12, 0x1A, 0x78, 0x68, 0xE0, 0xE1, 0x81, 0x83, 0x03, 0x02, 0x0C, 0x02,
+    0x30, 0x0C, 0x00, 0x05, 0x00, 0x96, 0x03, 0xC7, 0x60, 0x18, 0x06, 0xC6, 0x80, 0x0D, 0xF0, 0x00,
+    0x1C, 0x80, 0x03, 0x78, 0x80, 0x1B, 0x30, 0x06, 0xC3, 0x60, 0x30, 0x06, 0x0E, 0x08, 0x00, 0x04,
+    0x00, 0x94, 0x70, 0xE0, 0x06, 0xC6, 0x30, 0x0C, 0x83, 0x19, 0x98, 0x01, 0x0F, 0xF0, 0x00, 0x06,
+    0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x08, 0x00, 0x04, 0x00, 0x95, 0xE0, 0x7F, 0xFE, 0x07,
+    0x30, 0x80, 0x01, 0x18, 0xC0, 0x00, 0x06, 0x70, 0x00, 0x03, 0x18, 0xC0, 0x00, 0x0C, 0xE0, 0x7F,
+    0xFE, 0x07, 0x07, 0x00, 0x8E, 0x80, 0xE7, 0x18, 0x86, 0x61, 0x18, 0x86, 0x61, 0x18, 0x86, 0x61,
+    0x18, 0x86, 0xE1, 0x78, 0x02, 0x00, 0x03, 0x00, 0x91, 0x10, 0x60, 0xC0, 0x00, 0x01, 0x06, 0x08,
+    0x30, 0x60, 0x80, 0x00, 0x03, 0x04, 0x18, 0x30, 0x40, 0x80, 0x01, 0x04, 0x00, 0x8D, 0xE0, 0x39,
+    0xC6, 0x18, 0x63, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0xB9, 0x07, 0x00, 0x03, 0x00, 0x02, 0x18,
+    0x84, 0x38, 0x2C, 0x64, 0x66, 0x46, 0x0C, 0x00, 0x13, 0x00, 0x81, 0xFE, 0x03, 0x04, 0x00, 0x83,
+    0x00, 0x60, 0x30, 0x08, 0x0D, 0x00, 0x08, 0x00, 0x8F, 0xE0, 0x83, 0x3B, 0x86, 0x01, 0x08, 0x7E,
+    0x38, 0x63, 0x10, 0x83, 0x18, 0x86, 0x3F, 0x78, 0x03, 0x07, 0x00, 0x02, 0x00, 0x94, 0x80, 0x01,
+    0x0C, 0x60, 0x00, 0x03, 0xD8, 0xC3, 0x3F, 0x0E, 0x33, 0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x39,
+    0xCC, 0x3F, 0xF6, 0x08, 0x00, 0x07, 0x00, 0x8D, 0x80, 0x0F, 0x7F, 0x0C, 0x1B, 0x6C, 0x80, 0x01,
+    0x06, 0x18, 0xC4, 0x30, 0x7F, 0xF8, 0x07, 0x00, 0x03, 0x00, 0x94, 0xC0, 0x00, 0x06, 0x30, 0x80,
+    0xE1, 0x8D, 0x7F, 0x0E, 0x33, 0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x31, 0x8C, 0x7F, 0x78, 0x03,
+    0x07, 0x00, 0x08, 0x00, 0x8E, 0xC0, 0x83, 0x3F, 0x04, 0x31, 0x98, 0xFF, 0x0C, 0x60, 0x00, 0x03,
+    0x30, 0x84, 0x3F, 0xF0, 0x08, 0x00, 0x02, 0x00, 0x8C, 0x1C, 0xCF, 0x60, 0xF8, 0x18, 0x0C, 0x06,
+    0x83, 0xC1, 0x60, 0x30, 0x18, 0x0C, 0x05, 0x00, 0x08, 0x00, 0x94, 0xE0, 0x8D, 0x7F, 0x0E, 0x33,
+    0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x31, 0x8C, 0x7F, 0x78, 0x03, 0x18, 0x61, 0xF8, 0x83, 0x0F,
+    0x02, 0x00, 0x02, 0x00, 0x95, 0x80, 0x01, 0x0C, 0x60, 0x00, 0x03, 0xD8, 0xC3, 0x3F, 0x0E, 0x31,
+    0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x19, 0xCC, 0x60, 0x06, 0x03, 0x07, 0x00, 0x8A, 0x00, 0x10,
+    0x02, 0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x03, 0x00, 0x8D, 0x00, 0x30, 0x06, 0x00,
+    0x63, 0x8C, 0x31, 0xC6, 0x18, 0x63, 0x8C, 0x31, 0x77, 0x00, 0x02, 0x00, 0x95, 0x80, 0x01, 0x0C,
+    0x60, 0x00, 0x03, 0x18, 0xC6, 0x18, 0x66, 0xB0, 0x83, 0x0F, 0x7C, 0x60, 0x06, 0x63, 0x18, 0xC3,
+    0x30, 0x06, 0x03, 0x07, 0x00, 0x8A, 0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21,
+    0x04, 0x03, 0x00, 0x0D, 0x00, 0x98, 0x60, 0x8F, 0x87, 0xFF, 0x3F, 0x8E, 0xC3, 0x18, 0x0C, 0x63,
+    0x30, 0x8C, 0xC1, 0x30, 0x06, 0xC3, 0x18, 0x0C, 0x63, 0x30, 0x8C, 0xC1, 0x30, 0x06, 0xC3, 0x0C,
+    0x00, 0x08, 0x00, 0x8F, 0xD8, 0xC3, 0x3F, 0x0E, 0x31, 0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x19,
+    0xCC, 0x60, 0x06, 0x03, 0x07, 0x00, 0x08, 0x00, 0x8E, 0xC0, 0x83, 0x3F, 0x0C, 0x33, 0x98, 0x81,
+    0x0C, 0x64, 0x20, 0x83, 0x31, 0x8C, 0x3B, 0xF0, 0x08, 0x00, 0x08, 0x00, 0x93, 0xD8, 0xC3, 0x3F,
+    0x0E, 0x33, 0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x19, 0xCC, 0x3B, 0xF6, 0x30, 0x80, 0x01, 0x0C,
+    0x60, 0x03, 0x00, 0x08, 0x00, 0x94, 0xE0, 0x8D, 0x7F, 0x0E, 0x33, 0x98, 0xC1, 0x0C, 0x66, 0x30,
+    0x83, 0x39, 0x8C, 0x7B, 0x78, 0x03, 0x18, 0xC0, 0x00, 0x06, 0x30, 0x02, 0x00, 0x05, 0x00, 0x89,
+    0xD8, 0x7C, 0x0E, 0x83, 0xC1, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x05, 0x00, 0x07, 0x00, 0x8D, 0x80,
+    0x07, 0x7F, 0x86, 0x19, 0xC0, 0x01, 0x3E, 0xC0, 0x01, 0x66, 0x18, 0x7F, 0x78, 0x07, 0x00, 0x02,
+    0x00, 0x8C, 0x80, 0xC1, 0x60, 0xFC, 0x18, 0x0C, 0x06, 0x83, 0xC1, 0x60, 0x30, 0x78, 0x38, 0x05,
+    0x00, 0x08, 0x00, 0x8F, 0x18, 0xCC, 0x60, 0x06, 0x33, 0x98, 0xC1, 0x0C, 0x66, 0x30, 0x83, 0x11,
+    0x8E, 0x7F, 0x78, 0x03, 0x07, 0x00, 0x07, 0x00, 0x8D, 0x30, 0x98, 0x61, 0x86, 0x10, 0xC3, 0x0C,
+    0x13, 0x68, 0xE0, 0x81, 0x03, 0x0C, 0x30, 0x07, 0x00, 0x0B, 0x00, 0x91, 0x08, 0x82, 0x8C, 0x63,
+    0xC6, 0x31, 0xA3, 0x18, 0xD9, 0x84, 0x6D, 0xC3, 0xA2, 0xC1, 0x71, 0xE0, 0x38, 0x30, 0x02, 0x18,
+    0x80, 0x0C, 0x0A, 0x00, 0x07, 0x00, 0x8E, 0x60, 0x98, 0x31, 0xCC, 0xE0, 0x81, 0x07, 0x0C, 0x78,
+    0xE0, 0xC1, 0x8C, 0x71, 0x86, 0x01, 0x06, 0x00, 0x07, 0x00, 0x92, 0x30, 0x98, 0x61, 0x86, 0x18,
+    0xC3, 0x0C, 0x13, 0x68, 0xE0, 0x81, 0x03, 0x0C, 0x30, 0x40, 0x80, 0x81, 0x03, 0x06, 0x02, 0x00,
+    0x07, 0x00, 0x8E, 0xE0, 0x9F, 0x7F, 0xC0, 0x80, 0x01, 0x06, 0x0C, 0x18, 0x70, 0xC0, 0x80, 0x03,
+    0xFE, 0x01, 0x06, 0x00, 0x88, 0x00, 0x10, 0x0C, 0x83, 0xC1, 0x60, 0x10, 0x08, 0x86, 0x02, 0xC1,
+    0x84, 0x40, 0x20, 0x30, 0x18, 0x0C, 0x02, 0x06, 0x81, 0x02, 0x00, 0x02, 0x00, 0x8B, 0x42, 0x08,
+    0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02, 0x00, 0x80, 0x80, 0x02, 0x81, 0x83, 0xC1,
+    0x60, 0x30, 0x18, 0x03, 0x0C, 0x87, 0xC7, 0x60, 0x30, 0x18, 0x0C, 0x06, 0xC3, 0x30, 0x02, 0x00,
+    0x10, 0x00, 0x86, 0x0E, 0xC2, 0xCF, 0x18, 0x1F, 0x00, 0x02, 0x10, 0x00,
+};
+// clang-format on
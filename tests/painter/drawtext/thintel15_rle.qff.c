@@ -0,0 +1,78 @@
+// Copyright 2026 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// thintel15.qff.c with each glyph RLE compressed, which the converter skips for this font as it comes out larger
+
+#include <qp.h>
+
+const uint32_t font_thintel15_rle_length = 1029;
+
+// clang-format off
+const uint8_t font_thintel15_rle[1029] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0x05, 0x04, 0x00, 0x00, 0xFA, 0xFB, 0xFF,
+    0xFF, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x02, 0x00,
+    0x00, 0x82, 0x00, 0x00, 0x84, 0x01, 0x00, 0xC6, 0x02, 0x00, 0x06, 0x05, 0x00, 0x88, 0x07, 0x00,
+    0x46, 0x0A, 0x00, 0x82, 0x0C, 0x00, 0x83, 0x0D, 0x00, 0x03, 0x0F, 0x00, 0x84, 0x10, 0x00, 0x06,
+    0x12, 0x00, 0x03, 0x14, 0x00, 0x85, 0x15, 0x00, 0x02, 0x17, 0x00, 0x04, 0x18, 0x00, 0xC5, 0x19,
+    0x00, 0xC4, 0x1B, 0x00, 0x85, 0x1D, 0x00, 0xC5, 0x1F, 0x00, 0xC5, 0x21, 0x00, 0xC5, 0x23, 0x00,
+    0xC5, 0x25, 0x00, 0xC5, 0x27, 0x00, 0xC5, 0x29, 0x00, 0xC5, 0x2B, 0x00, 0xC2, 0x2D, 0x00, 0xC3,
+    0x2E, 0x00, 0x45, 0x30, 0x00, 0x85, 0x32, 0x00, 0x45, 0x34, 0x00, 0x45, 0x36, 0x00, 0x48, 0x38,
+    0x00, 0x05, 0x3B, 0x00, 0x05, 0x3D, 0x00, 0x05, 0x3F, 0x00, 0x05, 0x41, 0x00, 0x04, 0x43, 0x00,
+    0xC4, 0x44, 0x00, 0x85, 0x46, 0x00, 0x85, 0x48, 0x00, 0x84, 0x4A, 0x00, 0x85, 0x4C, 0x00, 0x85,
+    0x4E, 0x00, 0x84, 0x50, 0x00, 0x86, 0x52, 0x00, 0xC6, 0x54, 0x00, 0x05, 0x57, 0x00, 0x05, 0x59,
+    0x00, 0x05, 0x5B, 0x00, 0x05, 0x5D, 0x00, 0x05, 0x5F, 0x00, 0x06, 0x61, 0x00, 0x45, 0x63, 0x00,
+    0x46, 0x65, 0x00, 0x86, 0x67, 0x00, 0xC6, 0x69, 0x00, 0x06, 0x6C, 0x00, 0x46, 0x6E, 0x00, 0x84,
+    0x70, 0x00, 0x44, 0x72, 0x00, 0x04, 0x74, 0x00, 0xC6, 0x75, 0x00, 0x45, 0x77, 0x00, 0xC3, 0x78,
+    0x00, 0xC5, 0x79, 0x00, 0xC5, 0x7B, 0x00, 0xC4, 0x7D, 0x00, 0x85, 0x7F, 0x00, 0x85, 0x81, 0x00,
+    0x84, 0x83, 0x00, 0x45, 0x85, 0x00, 0x45, 0x87, 0x00, 0x42, 0x89, 0x00, 0x43, 0x8A, 0x00, 0xC5,
+    0x8B, 0x00, 0xC2, 0x8D, 0x00, 0xC6, 0x8E, 0x00, 0xC5, 0x90, 0x00, 0xC5, 0x92, 0x00, 0xC5, 0x94,
+    0x00, 0xC5, 0x96, 0x00, 0xC4, 0x98, 0x00, 0x85, 0x9A, 0x00, 0x83, 0x9C, 0x00, 0x05, 0x9E, 0x00,
+    0x06, 0xA0, 0x00, 0x46, 0xA2, 0x00, 0x86, 0xA4, 0x00, 0xC5, 0xA6, 0x00, 0xC4, 0xA8, 0x00, 0x85,
+    0xAA, 0x00, 0x82, 0xAC, 0x00, 0x85, 0xAD, 0x00, 0x85, 0xAF, 0x00, 0x04, 0xFB, 0xC5, 0x02, 0x00,
+    0x03, 0x00, 0x82, 0x54, 0x45, 0x00, 0x81, 0x50, 0x05, 0x04, 0x00, 0x85, 0x00, 0x45, 0xFD, 0xD2,
+    0xAF, 0x28, 0x03, 0x00, 0x86, 0x84, 0x53, 0x15, 0x0E, 0x55, 0x39, 0x04, 0x02, 0x00, 0x02, 0x00,
+    0x85, 0x12, 0x15, 0x0A, 0x28, 0x54, 0x24, 0x03, 0x00, 0x85, 0x80, 0x50, 0x14, 0x52, 0x95, 0x58,
+    0x03, 0x00, 0x80, 0x14, 0x02, 0x00, 0x84, 0x4A, 0x92, 0x24, 0x02, 0x00, 0x84, 0x91, 0x24, 0x49,
+    0x01, 0x00, 0x82, 0x20, 0x27, 0x05, 0x03, 0x00, 0x84, 0x00, 0x40, 0x10, 0x1F, 0x41, 0x04, 0x00,
+    0x02, 0x00, 0x82, 0x60, 0x0A, 0x00, 0x02, 0x00, 0x80, 0xF0, 0x04, 0x00, 0x82, 0x00, 0x40, 0x00,
+    0x83, 0x40, 0x24, 0x22, 0x11, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0x94, 0x52, 0x32, 0x02, 0x00, 0x83,
+    0x20, 0x23, 0x22, 0x72, 0x02, 0x00, 0x81, 0xC0, 0x24, 0x02, 0x44, 0x80, 0x78, 0x02, 0x00, 0x84,
+    0xC0, 0x24, 0x44, 0x50, 0x32, 0x02, 0x00, 0x84, 0x80, 0x29, 0x95, 0x1E, 0x42, 0x02, 0x00, 0x84,
+    0xE0, 0x85, 0x83, 0x50, 0x32, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0x70, 0x52, 0x32, 0x02, 0x00, 0x84,
+    0xE0, 0x21, 0x42, 0x84, 0x10, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0x64, 0x52, 0x32, 0x02, 0x00, 0x84,
+    0xC0, 0xA4, 0xE4, 0x50, 0x32, 0x02, 0x00, 0x82, 0x00, 0x41, 0x00, 0x84, 0x00, 0x30, 0x60, 0x0A,
+    0x00, 0x80, 0x00, 0x02, 0x11, 0x81, 0x04, 0x41, 0x02, 0x00, 0x83, 0x00, 0x80, 0x07, 0x1E, 0x03,
+    0x00, 0x84, 0x20, 0x08, 0x82, 0x88, 0x08, 0x02, 0x00, 0x84, 0xC0, 0x24, 0x64, 0x04, 0x10, 0x02,
+    0x00, 0x87, 0x00, 0x1C, 0x22, 0x59, 0x55, 0x2D, 0x02, 0x1C, 0x03, 0x00, 0x84, 0xC0, 0xA4, 0xF4,
+    0x52, 0x4A, 0x02, 0x00, 0x84, 0xE0, 0xA4, 0x74, 0x52, 0x3A, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0x10,
+    0x42, 0x32, 0x02, 0x00, 0x84, 0xE0, 0xA4, 0x94, 0x52, 0x3A, 0x02, 0x00, 0x83, 0x70, 0x11, 0x17,
+    0x71, 0x02, 0x00, 0x83, 0x70, 0x11, 0x17, 0x11, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0xD0, 0x52, 0x32,
+    0x02, 0x00, 0x84, 0x20, 0xA5, 0xF4, 0x52, 0x4A, 0x02, 0x00, 0x80, 0x70, 0x02, 0x22, 0x80, 0x72,
+    0x02, 0x00, 0x84, 0xC0, 0x21, 0x84, 0x50, 0x32, 0x02, 0x00, 0x82, 0x20, 0xA5, 0x32, 0x02, 0x4A,
+    0x02, 0x00, 0x80, 0x10, 0x02, 0x11, 0x80, 0x71, 0x02, 0x00, 0x85, 0x40, 0xB4, 0x55, 0x51, 0x14,
+    0x45, 0x03, 0x00, 0x85, 0x40, 0x34, 0x55, 0x59, 0x14, 0x45, 0x03, 0x00, 0x84, 0xC0, 0xA4, 0x94,
+    0x52, 0x32, 0x02, 0x00, 0x84, 0xE0, 0xA4, 0x74, 0x42, 0x08, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0x94,
+    0x52, 0x51, 0x02, 0x00, 0x84, 0xE0, 0xA4, 0x74, 0x52, 0x4A, 0x02, 0x00, 0x84, 0xC0, 0xA4, 0x60,
+    0x50, 0x32, 0x02, 0x00, 0x85, 0xC0, 0x47, 0x10, 0x04, 0x41, 0x10, 0x03, 0x00, 0x84, 0x20, 0xA5,
+    0x94, 0x52, 0x32, 0x02, 0x00, 0x85, 0x40, 0x14, 0x45, 0x51, 0xA4, 0x10, 0x03, 0x00, 0x85, 0x40,
+    0x14, 0x45, 0x51, 0xB5, 0x45, 0x03, 0x00, 0x85, 0x40, 0x14, 0x29, 0x84, 0x12, 0x45, 0x03, 0x00,
+    0x85, 0x40, 0x14, 0x45, 0x0E, 0x41, 0x10, 0x03, 0x00, 0x85, 0xC0, 0x07, 0x21, 0x84, 0x10, 0x7C,
+    0x03, 0x00, 0x80, 0x17, 0x03, 0x11, 0x81, 0x07, 0x00, 0x83, 0x10, 0x21, 0x22, 0x44, 0x02, 0x00,
+    0x80, 0x47, 0x03, 0x44, 0x81, 0x07, 0x00, 0x82, 0x84, 0x12, 0x01, 0x06, 0x00, 0x04, 0x00, 0x80,
+    0x78, 0x02, 0x00, 0x80, 0x11, 0x04, 0x00, 0x02, 0x00, 0x82, 0x93, 0x5C, 0x72, 0x02, 0x00, 0x84,
+    0x20, 0x84, 0x93, 0x52, 0x3A, 0x02, 0x00, 0x83, 0x00, 0x60, 0x11, 0x61, 0x02, 0x00, 0x84, 0x00,
+    0x21, 0x97, 0x52, 0x72, 0x02, 0x00, 0x02, 0x00, 0x82, 0x93, 0x5E, 0x70, 0x02, 0x00, 0x83, 0x60,
+    0x11, 0x13, 0x11, 0x02, 0x00, 0x02, 0x00, 0x84, 0x97, 0x52, 0x72, 0x28, 0x19, 0x84, 0x20, 0x84,
+    0x93, 0x52, 0x4A, 0x02, 0x00, 0x82, 0x10, 0x55, 0x00, 0x84, 0x80, 0x20, 0x49, 0x0A, 0x00, 0x84,
+    0x20, 0x84, 0x94, 0x4E, 0x4A, 0x02, 0x00, 0x82, 0x54, 0x55, 0x00, 0x02, 0x00, 0x80, 0x2C, 0x03,
+    0x55, 0x03, 0x00, 0x84, 0x00, 0x80, 0x93, 0x52, 0x4A, 0x02, 0x00, 0x02, 0x00, 0x82, 0x93, 0x52,
+    0x32, 0x02, 0x00, 0x86, 0x00, 0x80, 0x93, 0x52, 0x3A, 0x21, 0x00, 0x02, 0x00, 0x84, 0x97, 0x52,
+    0x72, 0x08, 0x01, 0x83, 0x00, 0x50, 0x13, 0x11, 0x02, 0x00, 0x02, 0x00, 0x82, 0x17, 0x0C, 0x3A,
+    0x02, 0x00, 0x82, 0x48, 0x96, 0x44, 0x02, 0x00, 0x84, 0x00, 0x80, 0x94, 0x52, 0x72, 0x02, 0x00,
+    0x02, 0x00, 0x83, 0x44, 0x51, 0xA4, 0x10, 0x03, 0x00, 0x02, 0x00, 0x83, 0x44, 0x51, 0x54, 0x6D,
+    0x03, 0x00, 0x02, 0x00, 0x83, 0x44, 0x0A, 0xA1, 0x44, 0x03, 0x00, 0x86, 0x00, 0x80, 0x94, 0x52,
+    0x72, 0x28, 0x19, 0x83, 0x00, 0x70, 0x24, 0x71, 0x02, 0x00, 0x86, 0x4C, 0x08, 0x11, 0x84, 0x10,
+    0x0C, 0x00, 0x02, 0x55, 0x80, 0x01, 0x86, 0x83, 0x10, 0x82, 0x08, 0x21, 0x03, 0x00, 0x02, 0x00,
+    0x81, 0xB0, 0x1A, 0x03, 0x00,
+};
+// clang-format on
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// thintel15.qff.c with each glyph RLE compressed, which the converter skips for this font as it comes out larger
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t font_thintel15_rle_length;
+extern const uint8_t  font_thintel15_rle[1029];
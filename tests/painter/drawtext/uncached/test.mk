@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += $(TEST_PATH)/../robotomono20.qff.c
+SRC += $(TEST_PATH)/../thintel15.qff.c
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../drawtext.hpp"
+
+TEST_F(DrawText, uncached) {
+    draw_frames();
+    EXPECT_EQ(surface_hash(), DRAWTEXT_GOLDEN_HASH);
+
+    // Each glyph is sent separately
+    benchmark("uncached");
+    EXPECT_GT(drawtext_viewport_count, calls);
+}
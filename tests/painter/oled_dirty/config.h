@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Used by the Quantum Painter I2C comms driver, which is replaced by a model in the test
+#define I2C_TIMEOUT 100
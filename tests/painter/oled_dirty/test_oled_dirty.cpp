@@ -0,0 +1,189 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "test_common.hpp"
+
+extern "C" {
+#include "i2c_master.h"
+#include "qp.h"
+#include "qp_comms_dummy.h"
+#include "qp_oled_panel.h"
+#include "qp_sh1106.h"
+#include "qp_sh1106_opcodes.h"
+}
+
+#define PANEL_WIDTH 128
+#define PANEL_HEIGHT 64
+#define PANEL_PAGES (PANEL_HEIGHT / 8)
+
+/* Minimal model of the SH1106 display RAM, fed by a comms driver which
+ * otherwise behaves like the dummy one. */
+static uint8_t  gram[PANEL_PAGES][PANEL_WIDTH];
+static uint8_t  gram_page   = 0;
+static uint8_t  gram_column = 0;
+static uint32_t page_writes = 0;
+static uint32_t data_bytes  = 0;
+
+static bool counting_send_command(painter_device_t device, uint8_t cmd) {
+    if ((cmd & 0xF0) == SH1106_PAGE_ADDR) {
+        gram_page = cmd & 0x0F;
+        page_writes++;
+    } else if ((cmd & 0xF0) == SH1106_SETCOLUMN_LSB) {
+        gram_column = (gram_column & 0xF0) | (cmd & 0x0F);
+    } else if ((cmd & 0xF0) == SH1106_SETCOLUMN_MSB) {
+        gram_column = (gram_column & 0x0F) | ((cmd & 0x0F) << 4);
+    }
+    return true;
+}
+
+static uint32_t counting_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (uint32_t i = 0; i < byte_count; i++) {
+        EXPECT_LT(gram_column, PANEL_WIDTH);
+        gram[gram_page][gram_column++ % PANEL_WIDTH] = bytes[i];
+    }
+    data_bytes += byte_count;
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+static bool counting_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    return true;
+}
+
+static bool counting_comms_noop(painter_device_t device) {
+    return true;
+}
+
+static painter_comms_with_command_vtable_t counting_comms_vtable = {
+    .base =
+        {
+            .comms_init  = counting_comms_noop,
+            .comms_start = counting_comms_noop,
+            .comms_stop  = counting_comms_noop,
+            .comms_send  = counting_send_data,
+        },
+    .send_command          = counting_send_command,
+    .bulk_command_sequence = counting_bulk_command_sequence,
+};
+
+// The I2C comms driver is linked in, but replaced by the model above.
+extern "C" void i2c_init(void) {}
+
+extern "C" i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    ADD_FAILURE() << "unexpected I2C transfer";
+    return I2C_STATUS_ERROR;
+}
+
+/* Draws onto an SH1106, counting the page selects and the column bytes each
+ * flush sends, and checking the modelled display RAM against the panel's
+ * framebuffer. */
+class OledDirty : public testing::Test {
+   protected:
+    void SetUp() override {
+        static painter_device_t device = nullptr;
+        if (!device) {
+            device = qp_sh1106_make_i2c_device(PANEL_WIDTH, PANEL_HEIGHT, 0x3C);
+            ASSERT_NE(device, nullptr);
+            ((painter_driver_t *)device)->comms_vtable = (const painter_comms_vtable_t *)&counting_comms_vtable;
+        }
+        display = device;
+        std::memset(gram, 0xAA, sizeof(gram));
+    }
+
+    void init(painter_rotation_t rotation) {
+        ASSERT_TRUE(qp_init(display, rotation));
+        flush();
+        EXPECT_EQ(page_writes, PANEL_PAGES);
+        EXPECT_EQ(data_bytes, PANEL_PAGES * PANEL_WIDTH);
+    }
+
+    void flush() {
+        page_writes = 0;
+        data_bytes  = 0;
+        ASSERT_TRUE(qp_flush(display));
+        expect_gram_matches_framebuffer();
+    }
+
+    void expect_gram_matches_framebuffer() {
+        const oled_panel_painter_device_t *oled    = (const oled_panel_painter_device_t *)display;
+        const surface_painter_device_t    *surface = &oled->surface;
+        const uint16_t                     width   = surface->base.panel_width;
+        const uint16_t                     height  = surface->base.panel_height;
+        const bool                         rot90   = oled->base.rotation == QP_ROTATION_90;
+
+        for (uint16_t y = 0; y < height; y++) {
+            for (uint16_t x = 0; x < width; x++) {
+                const uint32_t pixel_num = y * width + x;
+                const bool     expected  = surface->u8buffer[pixel_num / 8] & (1 << (pixel_num % 8));
+
+                // With the panel rotated, surface columns map onto pages and rows onto mirrored panel columns
+                const uint8_t page   = rot90 ? x / 8 : y / 8;
+                const uint8_t column = rot90 ? PANEL_WIDTH - 1 - y : x;
+                const uint8_t bit    = rot90 ? x % 8 : y % 8;
+                ASSERT_EQ((bool)(gram[page][column] & (1 << bit)), expected) << "pixel " << x << "," << y;
+            }
+        }
+    }
+
+    painter_device_t display;
+};
+
+TEST_F(OledDirty, NothingSentWhenUnchanged) {
+    init(QP_ROTATION_0);
+    flush();
+    EXPECT_EQ(page_writes, 0);
+    EXPECT_EQ(data_bytes, 0);
+}
+
+TEST_F(OledDirty, CornersSentSeparatelyRot0) {
+    init(QP_ROTATION_0);
+
+    // A status widget in the top left, and an indicator in the bottom right
+    qp_rect(display, 0, 0, 9, 5, 0, 0, 255, true);
+    qp_rect(display, 118, 58, 127, 63, 0, 0, 255, true);
+    flush();
+
+    // Each corner covers two 8 pixel tiles of a single page
+    EXPECT_EQ(page_writes, 2);
+    EXPECT_EQ(data_bytes, 2 * 16);
+}
+
+TEST_F(OledDirty, CornersSentSeparatelyRot90) {
+    init(QP_ROTATION_90);
+
+    // The surface is 64 wide and 128 high once rotated
+    qp_rect(display, 0, 0, 9, 5, 0, 0, 255, true);
+    qp_rect(display, 54, 122, 63, 127, 0, 0, 255, true);
+    flush();
+
+    // Each corner covers two pages, with a single tile's worth of columns in each
+    EXPECT_EQ(page_writes, 4);
+    EXPECT_EQ(data_bytes, 4 * 8);
+}
+
+TEST_F(OledDirty, MonoSurfaceCornersSentSeparately) {
+    init(QP_ROTATION_0);
+
+    uint8_t          buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 1)];
+    painter_device_t surface = qp_make_mono1bpp_surface(PANEL_WIDTH, PANEL_HEIGHT, buffer);
+    ASSERT_NE(surface, nullptr);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    ASSERT_TRUE(qp_flush(surface));
+
+    // Corners which don't start on a byte boundary of the packed pixel data
+    qp_rect(surface, 3, 1, 9, 5, 0, 0, 255, true);
+    qp_rect(surface, 118, 58, 124, 62, 0, 0, 255, true);
+    ASSERT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    flush();
+
+    // Whole 8 pixel tiles, trimmed to the overall changed area
+    EXPECT_EQ(page_writes, 2);
+    EXPECT_EQ(data_bytes, (15 - 3 + 1) + (124 - 112 + 1));
+
+    const oled_panel_painter_device_t *oled = (const oled_panel_painter_device_t *)display;
+    EXPECT_EQ(std::memcmp(buffer, oled->surface.buffer, sizeof(buffer)), 0) << "display does not match the surface";
+
+    // Release the surface for the next test
+    std::memset((void *)surface, 0, sizeof(surface_painter_device_t));
+}
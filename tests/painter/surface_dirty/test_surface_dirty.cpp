@@ -0,0 +1,122 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 240
+
+static uint32_t viewport_count;
+static uint32_t pixel_count;
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    viewport_count++;
+    return rgb565_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static bool counting_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    pixel_count += native_pixel_count;
+    return rgb565_surface_driver_vtable.base.pixdata(device, pixel_data, native_pixel_count);
+}
+
+/* Draws into one surface, and sends the changes to a second surface which
+ * stands in for a display, counting what gets sent to it. */
+class SurfaceDirty : public testing::Test {
+   protected:
+    void SetUp() override {
+        std::memset(surface_drivers, 0, sizeof(surface_drivers));
+
+        target_vtable               = rgb565_surface_driver_vtable;
+        target_vtable.base.viewport = counting_viewport;
+        target_vtable.base.pixdata  = counting_pixdata;
+
+        surface = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, surface_buffer);
+        target  = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, target_buffer);
+        ((painter_driver_t *)target)->driver_vtable = (const painter_driver_vtable_t *)&target_vtable;
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+
+        // Get the initial contents of the surface across
+        draw();
+        EXPECT_EQ(viewport_count, 1);
+        EXPECT_EQ(pixel_count, PANEL_WIDTH * PANEL_HEIGHT);
+    }
+
+    void draw() {
+        viewport_count = 0;
+        pixel_count    = 0;
+        ASSERT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+        EXPECT_EQ(std::memcmp(surface_buffer, target_buffer, sizeof(surface_buffer)), 0) << "target does not match the surface";
+    }
+
+    surface_painter_driver_vtable_t target_vtable;
+    painter_device_t                surface;
+    painter_device_t                target;
+    uint8_t                         surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+    uint8_t                         target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+};
+
+TEST_F(SurfaceDirty, nothing_sent_when_unchanged) {
+    draw();
+    EXPECT_EQ(viewport_count, 0);
+    EXPECT_EQ(pixel_count, 0);
+}
+
+TEST_F(SurfaceDirty, entire_surface_sent_on_request) {
+    qp_setpixel(surface, 100, 100, 0, 255, 255);
+    viewport_count = 0;
+    pixel_count    = 0;
+    ASSERT_TRUE(qp_surface_draw(surface, target, 0, 0, true));
+    EXPECT_EQ(viewport_count, 1);
+    EXPECT_EQ(pixel_count, PANEL_WIDTH * PANEL_HEIGHT);
+}
+
+TEST_F(SurfaceDirty, dashboard_corners_sent_separately) {
+    // A status widget in the top left, and a clock in the bottom right
+    qp_rect(surface, 10, 10, 49, 29, 85, 255, 255, true);
+    qp_rect(surface, 190, 210, 229, 229, 170, 255, 255, true);
+    draw();
+
+    // Whole 8x16 pixel tiles, trimmed to the overall changed area
+    EXPECT_EQ(viewport_count, 2);
+    EXPECT_EQ(pixel_count, (55 - 10 + 1) * (31 - 10 + 1) + (229 - 184 + 1) * (229 - 208 + 1));
+    EXPECT_LT(pixel_count, (229 - 10 + 1) * (229 - 10 + 1)) << "no better than a single bounding box";
+}
+
+TEST_F(SurfaceDirty, change_inside_previous_region_is_sent) {
+    qp_setpixel(surface, 10, 10, 0, 255, 255);
+    qp_setpixel(surface, 200, 200, 0, 255, 255);
+    qp_setpixel(surface, 100, 100, 0, 255, 255);
+    draw();
+    EXPECT_EQ(viewport_count, 3);
+    EXPECT_EQ(pixel_count, (15 - 10 + 1) * (15 - 10 + 1) + 8 * 16 + (200 - 200 + 1) * (200 - 192 + 1));
+}
+
+TEST_F(SurfaceDirty, adjacent_tiles_are_merged) {
+    // A vertical bar crossing several tile rows, then a horizontal one crossing several tile columns
+    qp_rect(surface, 20, 0, 21, 239, 0, 255, 255, true);
+    draw();
+    EXPECT_EQ(viewport_count, 1);
+    EXPECT_EQ(pixel_count, 2 * PANEL_HEIGHT);
+
+    qp_rect(surface, 0, 120, 239, 121, 0, 255, 255, true);
+    draw();
+    EXPECT_EQ(viewport_count, 1);
+    EXPECT_EQ(pixel_count, 2 * PANEL_WIDTH);
+}
+
+TEST_F(SurfaceDirty, scattered_changes_reach_target) {
+    for (uint16_t i = 0; i < 500; i++) {
+        qp_setpixel(surface, (i * 37) % PANEL_WIDTH, (i * 101) % PANEL_HEIGHT, i % 256, 255, 255);
+    }
+    draw();
+    EXPECT_LE(pixel_count, PANEL_WIDTH * PANEL_HEIGHT);
+}
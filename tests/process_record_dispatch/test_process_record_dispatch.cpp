@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class ProcessRecordDispatch : public TestFixture {};
+
+static uint8_t handlers_for(uint16_t keycode) {
+    uint8_t                       count;
+    const process_record_range_t *ranges  = process_record_quantum_ranges(&count);
+    uint8_t                       handled = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        handled += keycode >= ranges[i].first && keycode <= ranges[i].last;
+    }
+    return handled;
+}
+
+// Every handler in turn, as process_record_quantum() did before it dispatched on ranges.
+static bool process_record_chain(keyrecord_t *record) {
+    uint16_t                      keycode = get_record_keycode(record, true);
+    uint8_t                       count;
+    const process_record_range_t *ranges = process_record_quantum_ranges(&count);
+    for (uint8_t i = 0; i < count; i++) {
+        if (!ranges[i].process(keycode, record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename F>
+static double ns_per_record(uint16_t keycode, F process) {
+    constexpr int iterations = 200000;
+    keyrecord_t   record     = {};
+    record.event.type        = KEY_EVENT;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        record.event.pressed = !(i & 1);
+        record.event.time    = timer_read();
+        process(&record);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+TEST_F(ProcessRecordDispatch, BasicKeycodeSkipsRangedHandlers) {
+    uint8_t count;
+    process_record_quantum_ranges(&count);
+
+    EXPECT_LT(handlers_for(KC_A), count);
+    EXPECT_GT(handlers_for(QK_TRI_LAYER_LOWER), handlers_for(KC_A));
+    EXPECT_EQ(handlers_for(QK_PROGRAMMABLE_BUTTON_1), handlers_for(KC_A) + 1);
+}
+
+TEST_F(ProcessRecordDispatch, RangedKeycodesReachTheirHandler) {
+    TestDriver driver;
+    auto       lower   = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+    auto       dt_up   = KeymapKey(0, 1, 0, QK_DYNAMIC_TAPPING_TERM_UP);
+    auto       regular = KeymapKey(0, 2, 0, KC_A);
+    set_keymap({lower, dt_up, regular});
+
+    EXPECT_NO_REPORT(driver);
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+
+    uint16_t tapping_term = g_tapping_term;
+    tap_key(dt_up);
+    EXPECT_EQ(g_tapping_term, tapping_term + DYNAMIC_TAPPING_TERM_INCREMENT);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, Benchmark) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    const struct {
+        const char *name;
+        uint16_t    keycode;
+    } keycodes[] = {
+        {"KC_A", KC_A},
+        {"LT_1_KC_A", LT(1, KC_A)},
+        {"QK_PROGRAMMABLE_BUTTON_1", QK_PROGRAMMABLE_BUTTON_1},
+        {"QK_TRI_LAYER_LOWER", QK_TRI_LAYER_LOWER},
+        {"UC_00E9", UC(0x00E9)},
+    };
+    uint8_t count;
+    process_record_quantum_ranges(&count);
+
+    RecordProperty("handlers", count);
+    for (const auto &entry : keycodes) {
+        set_keymap({KeymapKey(0, 0, 0, entry.keycode)});
+        double dispatch = ns_per_record(entry.keycode, process_record_quantum);
+        double chain    = ns_per_record(entry.keycode, process_record_chain);
+        RecordProperty(std::string(entry.name) + "_handlers", handlers_for(entry.keycode));
+        RecordProperty(std::string(entry.name) + "_dispatch_ns", std::to_string(dispatch));
+        RecordProperty(std::string(entry.name) + "_chain_ns", std::to_string(chain));
+        layer_clear();
+        clear_keyboard();
+    }
+}
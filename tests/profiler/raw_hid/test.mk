@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+PROFILER_ENABLE = yes
+RAW_ENABLE = yes
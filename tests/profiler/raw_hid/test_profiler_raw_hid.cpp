@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiler.h"
+#include "host.h"
+
+void advance_time_us(uint32_t us);
+}
+
+static std::vector<std::vector<uint8_t>> reports;
+static std::vector<uint8_t>              dump;
+
+static void capture_report(uint8_t *data, uint8_t length) {
+    reports.emplace_back(data, data + length);
+}
+
+static void capture_dump(const uint8_t *data, uint8_t length) {
+    dump.insert(dump.end(), data, data + length);
+}
+
+class ProfilerRawHid : public TestFixture {
+   protected:
+    host_driver_t driver;
+
+    void SetUp() override {
+        driver              = *host_get_driver();
+        driver.send_raw_hid = &capture_report;
+        host_set_driver(&driver);
+        profiler_reset();
+        reports.clear();
+        dump.clear();
+    }
+};
+
+TEST_F(ProfilerRawHid, DumpIsSentOneReportPerTask) {
+    for (uint8_t i = 0; i < 10; i++) {
+        PROFILE_ZONE("sent", advance_time_us(i));
+    }
+    profiler_dump(&capture_dump);
+
+    uint8_t data[32] = {PROFILER_RAW_HID_ID, PROFILER_DUMP_AND_RESET};
+    EXPECT_TRUE(profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_TRUE(reports.empty());
+
+    std::vector<uint8_t> received;
+    for (size_t task = 1; task < 100; task++) {
+        // Zones timed while the dump is sent are not recorded
+        PROFILE_ZONE("sent", advance_time_us(1));
+        profiler_task();
+        ASSERT_EQ(reports.size(), task);
+
+        const std::vector<uint8_t> &report = reports.back();
+        ASSERT_EQ(report.size(), 32u);
+        EXPECT_EQ(report[0], PROFILER_RAW_HID_ID);
+        EXPECT_EQ(report[1], task - 1);
+        received.insert(received.end(), &report[3], &report[3] + report[2]);
+        if (report[2] < 29) break;
+    }
+    EXPECT_EQ(received, dump);
+    EXPECT_GT(reports.size(), 1u);
+
+    // The statistics are reset once the last report is sent
+    EXPECT_EQ(profiler_get_zone("sent")->count, 0u);
+    size_t sent = reports.size();
+    profiler_task();
+    EXPECT_EQ(reports.size(), sent);
+    PROFILE_ZONE("sent", advance_time_us(1));
+    EXPECT_EQ(profiler_get_zone("sent")->count, 1u);
+}
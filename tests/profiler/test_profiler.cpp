@@ -0,0 +1,158 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiler.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void advance_time_us(uint32_t us);
+}
+
+static std::vector<uint8_t> dump;
+
+static void capture_dump(const uint8_t *data, uint8_t length) {
+    dump.insert(dump.end(), data, data + length);
+}
+
+static uint32_t read_u32(size_t offset) {
+    return dump[offset] | dump[offset + 1] << 8 | dump[offset + 2] << 16 | (uint32_t)dump[offset + 3] << 24;
+}
+
+class Profiler : public TestFixture {
+   protected:
+    void SetUp() override {
+        profiler_reset();
+        dump.clear();
+    }
+
+    /* Returns the (zone, depth, duration) samples at the end of the dump. */
+    std::vector<profiler_sample_t> dumped_samples() {
+        dump.clear();
+        profiler_dump(&capture_dump);
+
+        std::vector<profiler_sample_t> samples(dump[5]);
+        size_t                         offset = dump.size() - samples.size() * 6;
+        for (auto &sample : samples) {
+            sample = {dump[offset], dump[offset + 1], read_u32(offset + 2)};
+            offset += 6;
+        }
+        return samples;
+    }
+};
+
+TEST_F(Profiler, TaskZonesAreRecorded) {
+    TestDriver driver;
+
+    idle_for(10);
+
+    for (const char *name : {"matrix_task", "quantum_task", "host_task"}) {
+        const profiler_zone_stats_t *zone = profiler_get_zone(name);
+        ASSERT_NE(zone, nullptr) << name;
+        EXPECT_EQ(zone->count, 10u) << name;
+    }
+    EXPECT_EQ(profiler_get_zone("rgb_matrix_task"), nullptr);
+}
+
+TEST_F(Profiler, ZoneStatistics) {
+    for (uint32_t us : {5, 100, 1000, 100}) {
+        PROFILE_ZONE("statistics", advance_time_us(us));
+    }
+
+    const profiler_zone_stats_t *zone = profiler_get_zone("statistics");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(zone->count, 4u);
+    EXPECT_EQ(zone->total, 1205u);
+    EXPECT_EQ(zone->min, 5u);
+    EXPECT_EQ(zone->max, 1000u);
+
+    // Buckets are the bit length of the duration
+    EXPECT_EQ(zone->histogram[3], 1u);
+    EXPECT_EQ(zone->histogram[7], 2u);
+    EXPECT_EQ(zone->histogram[10], 1u);
+}
+
+TEST_F(Profiler, LongDurationsSaturateTheLastBucket) {
+    PROFILE_ZONE("long", advance_time_us(UINT32_C(1) << (PROFILER_HISTOGRAM_BUCKETS + 2)));
+
+    const profiler_zone_stats_t *zone = profiler_get_zone("long");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(zone->histogram[PROFILER_HISTOGRAM_BUCKETS - 1], 1u);
+}
+
+TEST_F(Profiler, NestedZonesRecordTheirDepth) {
+    PROFILE_ZONE("outer", {
+        advance_time_us(5);
+        PROFILE_ZONE("inner", advance_time_us(10));
+    });
+
+    auto samples = dumped_samples();
+    ASSERT_EQ(samples.size(), 2u);
+    EXPECT_EQ(samples[0].zone, profiler_zone("inner"));
+    EXPECT_EQ(samples[0].depth, 1);
+    EXPECT_EQ(samples[0].duration, 10u);
+    EXPECT_EQ(samples[1].zone, profiler_zone("outer"));
+    EXPECT_EQ(samples[1].depth, 0);
+    EXPECT_EQ(samples[1].duration, 15u);
+}
+
+TEST_F(Profiler, RingKeepsTheMostRecentSamples) {
+    for (uint32_t us = 1; us <= PROFILER_RING_SIZE + 3; us++) {
+        PROFILE_ZONE("ring", advance_time_us(us));
+    }
+
+    auto samples = dumped_samples();
+    ASSERT_EQ(samples.size(), PROFILER_RING_SIZE);
+    EXPECT_EQ(samples.front().duration, 4u);
+    EXPECT_EQ(samples.back().duration, PROFILER_RING_SIZE + 3u);
+}
+
+TEST_F(Profiler, DumpLayout) {
+    PROFILE_ZONE("dumped", advance_time_us(42));
+    advance_time(7);
+
+    profiler_dump(&capture_dump);
+
+    ASSERT_GE(dump.size(), 14u);
+    EXPECT_EQ(dump[0], 'Q');
+    EXPECT_EQ(dump[1], 'P');
+    EXPECT_EQ(dump[2], PROFILER_DUMP_VERSION);
+    EXPECT_EQ(dump[4], PROFILER_HISTOGRAM_BUCKETS);
+    EXPECT_EQ(dump[5], 1);
+    EXPECT_EQ(read_u32(6), 1000000u);
+    EXPECT_EQ(read_u32(10), 7u);
+
+    // Zones follow the header in registration order
+    size_t offset = 14;
+    for (uint8_t zone = 0; zone < dump[3]; zone++) {
+        std::string name(dump.begin() + offset + 1, dump.begin() + offset + 1 + dump[offset]);
+        offset += 1 + name.size();
+        if (name == "dumped") {
+            EXPECT_EQ(read_u32(offset), 1u);
+            EXPECT_EQ(read_u32(offset + 4), 42u);
+            EXPECT_EQ(read_u32(offset + 12), 42u);
+            EXPECT_EQ(read_u32(offset + 16), 42u);
+        }
+        offset += 20 + 2 * PROFILER_HISTOGRAM_BUCKETS;
+    }
+    EXPECT_EQ(offset + 6, dump.size());
+}
+
+TEST_F(Profiler, RawHidCommands) {
+    PROFILE_ZONE("raw_hid", advance_time_us(3));
+
+    uint8_t data[32] = {PROFILER_RAW_HID_ID, PROFILER_DUMP};
+    EXPECT_TRUE(profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(profiler_get_zone("raw_hid")->count, 1u);
+
+    data[1] = PROFILER_DUMP_AND_RESET;
+    EXPECT_TRUE(profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(profiler_get_zone("raw_hid")->count, 0u);
+
+    data[0] = PROFILER_RAW_HID_ID - 1;
+    EXPECT_FALSE(profiler_raw_hid_receive(data, sizeof(data)));
+}
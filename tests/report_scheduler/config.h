@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define USB_POLLING_INTERVAL_MS 8
+#define REPORT_SCHEDULER_QUEUE_SIZE 4
@@ -0,0 +1,273 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::Truly;
+
+#define EXPECT_EXTRA_REPORT(driver, report_usage) EXPECT_CALL((driver), send_extra_mock(Truly([](report_extra_t& report) { return report.usage == (report_usage); })))
+
+class ReportScheduler : public TestFixture {};
+
+TEST_F(ReportScheduler, ChangeAfterAQuietIntervalIsSentStraightAway) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The release waits for the next poll
+    EXPECT_NO_REPORT(driver);
+    key_a.release();
+    idle_for(USB_POLLING_INTERVAL_MS - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+}
+
+TEST_F(ReportScheduler, ChangesWithinOneIntervalShareOneReport) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    set_keymap({key_a, key_b, key_c});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    key_c.press();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+}
+
+TEST_F(ReportScheduler, TapWithinOneIntervalIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The press of B gets the next poll, and its release the one after, rather than being merged away
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_b);
+    idle_for(USB_POLLING_INTERVAL_MS - 3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportScheduler, ReleaseAndPressWithinOneIntervalIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The release gets the next poll, rather than being replaced by the press
+    EXPECT_NO_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+}
+
+TEST_F(ReportScheduler, TapsWithinOneIntervalAreSentOnePerInterval) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    // Two taps and a press, one scan apart: each release can share a report
+    // with the following press, but no press or release is merged away
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    key_a.press();
+    run_one_scan_loop();
+    idle_for(2 * USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportScheduler, FullQueueSendsItsOldestStateEarly) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // One more state than fits in the queue
+    EXPECT_EMPTY_REPORT(driver);
+    for (uint8_t i = 0; i < REPORT_SCHEDULER_QUEUE_SIZE / 2; i++) {
+        key_a.release();
+        run_one_scan_loop();
+        key_a.press();
+        run_one_scan_loop();
+    }
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(driver.stalled_reports(), 1u);
+
+    for (uint8_t i = 0; i < REPORT_SCHEDULER_QUEUE_SIZE / 2; i++) {
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(REPORT_SCHEDULER_QUEUE_SIZE * USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(driver.stalled_reports(), 1u);
+}
+
+TEST_F(ReportScheduler, MouseMovementIsAdded) {
+    TestDriver     driver;
+    InSequence     s;
+    report_mouse_t report = {};
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (5, -2, 0, 0, 0));
+    report.x = 1;
+    host_mouse_send(&report);
+    run_one_scan_loop();
+    report.x = 2;
+    report.y = -1;
+    host_mouse_send(&report);
+    report.x = 3;
+    host_mouse_send(&report);
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    // A button change is not added to the movement before it, it waits for the next poll
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    report   = {};
+    report.x = 1;
+    host_mouse_send(&report);
+    run_one_scan_loop();
+    report         = {};
+    report.buttons = 1;
+    host_mouse_send(&report);
+    run_one_scan_loop();
+    idle_for(2 * USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    report = {};
+    host_mouse_send(&report);
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportScheduler, ConsumerTapIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+
+    driver.set_polling_interval(USB_POLLING_INTERVAL_MS);
+
+    // Each usage that differs from the one queued before it gets its own poll
+    EXPECT_EXTRA_REPORT(driver, AUDIO_VOL_UP);
+    host_consumer_send(AUDIO_VOL_UP);
+    host_consumer_send(0);
+    host_consumer_send(AUDIO_VOL_UP);
+    host_consumer_send(0);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EXTRA_REPORT(driver, 0);
+    EXPECT_EXTRA_REPORT(driver, AUDIO_VOL_UP);
+    EXPECT_EXTRA_REPORT(driver, 0);
+    idle_for(3 * USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(driver.stalled_reports(), 0u);
+}
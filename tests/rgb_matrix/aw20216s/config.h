@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "test_common.h"
+
+// The test platform has no GPIO, the chip select is only passed to spi_start()
+typedef uint8_t pin_t;
+
+#define AW20216S_CS_PIN_1 1
+#define RGB_MATRIX_LED_COUNT 10
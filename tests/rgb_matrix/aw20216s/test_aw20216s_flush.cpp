@@ -0,0 +1,158 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "spi_master.h"
+#include "rgb_matrix.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+#define PWM_REGISTER_COUNT 216
+#define LED_STRIDE 21
+
+/* Minimal model of one AW20216S on the bus. */
+static bool     header_sent = false;
+static uint8_t  device_page = 0;
+static uint8_t  device_reg  = 0;
+static uint8_t  device_pwm[PWM_REGISTER_COUNT];
+static uint32_t pwm_writes = 0;
+static uint32_t pwm_bytes  = 0;
+static uint8_t  last_start = 0;
+
+extern "C" void spi_init(void) {}
+
+extern "C" bool spi_start(pin_t slave_pin, bool lsb_first, uint8_t mode, uint16_t divisor) {
+    header_sent = false;
+    return true;
+}
+
+extern "C" spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    if (!header_sent) {
+        EXPECT_EQ(length, 2);
+        device_page = data[0] & 0x0E;
+        device_reg  = data[1];
+        header_sent = true;
+    } else if (device_page == AW20216S_PAGE_PWM) {
+        EXPECT_LE(device_reg + length, PWM_REGISTER_COUNT);
+        memcpy(&device_pwm[device_reg], data, length);
+        last_start = device_reg;
+        pwm_writes++;
+        pwm_bytes += length;
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+extern "C" void spi_stop(void) {}
+
+class Aw20216sFlush : public TestFixture {
+   protected:
+    void reset_counters() {
+        pwm_writes = 0;
+        pwm_bytes  = 0;
+    }
+
+    void flush() {
+        reset_counters();
+        aw20216s_flush();
+    }
+
+    /* Checks the registers of every LED, and that the gaps between them hold
+     * the value the driver buffer started with. */
+    void expect_device(uint8_t red, uint8_t green, uint8_t blue) {
+        for (uint8_t reg = 0; reg < PWM_REGISTER_COUNT; reg++) {
+            const uint8_t led = reg / LED_STRIDE;
+            const uint8_t pos = reg % LED_STRIDE;
+            uint8_t       expected;
+            if (led >= RGB_MATRIX_LED_COUNT || pos > 2) {
+                expected = 0;
+            } else {
+                expected = pos == 0 ? red : pos == 1 ? green : blue;
+            }
+            ASSERT_EQ(device_pwm[reg], expected) << "register " << +reg;
+        }
+    }
+};
+
+TEST_F(Aw20216sFlush, InitSendsEveryRegister) {
+    aw20216s_set_color_all(10, 20, 30);
+    flush();
+
+    // A reset leaves the device out of step with the driver buffer.
+    memset(device_pwm, 0xAA, sizeof(device_pwm));
+    aw20216s_init_drivers();
+    flush();
+    EXPECT_EQ(pwm_writes, 1);
+    EXPECT_EQ(last_start, 0);
+    EXPECT_EQ(pwm_bytes, PWM_REGISTER_COUNT);
+    expect_device(10, 20, 30);
+
+    flush();
+    EXPECT_EQ(pwm_writes, 0);
+}
+
+TEST_F(Aw20216sFlush, UnchangedColorsAreNotSent) {
+    aw20216s_set_color_all(1, 2, 3);
+    flush();
+    expect_device(1, 2, 3);
+
+    aw20216s_set_color_all(1, 2, 3);
+    flush();
+    EXPECT_EQ(pwm_writes, 0);
+    EXPECT_EQ(pwm_bytes, 0);
+}
+
+TEST_F(Aw20216sFlush, SingleLedSendsOnlyItsRegisters) {
+    aw20216s_set_color_all(1, 2, 3);
+    flush();
+
+    aw20216s_set_color(3, 4, 5, 6);
+    flush();
+    EXPECT_EQ(pwm_writes, 1);
+    EXPECT_EQ(last_start, 3 * LED_STRIDE);
+    EXPECT_EQ(pwm_bytes, 3);
+    EXPECT_EQ(device_pwm[3 * LED_STRIDE], 4);
+    EXPECT_EQ(device_pwm[3 * LED_STRIDE + 1], 5);
+    EXPECT_EQ(device_pwm[3 * LED_STRIDE + 2], 6);
+
+    // Only the green register changes.
+    aw20216s_set_color(3, 4, 7, 6);
+    flush();
+    EXPECT_EQ(last_start, 3 * LED_STRIDE + 1);
+    EXPECT_EQ(pwm_bytes, 1);
+}
+
+TEST_F(Aw20216sFlush, DistantLedsAreSentAsOneRange) {
+    aw20216s_set_color_all(1, 2, 3);
+    flush();
+
+    // Set in reverse order, so the range grows downwards too.
+    aw20216s_set_color(7, 9, 9, 9);
+    aw20216s_set_color(2, 8, 8, 8);
+    flush();
+    EXPECT_EQ(pwm_writes, 1);
+    EXPECT_EQ(last_start, 2 * LED_STRIDE);
+    EXPECT_EQ(pwm_bytes, 7 * LED_STRIDE + 3 - 2 * LED_STRIDE);
+    EXPECT_EQ(device_pwm[2 * LED_STRIDE], 8);
+    EXPECT_EQ(device_pwm[7 * LED_STRIDE + 2], 9);
+}
+
+TEST_F(Aw20216sFlush, StaticEffectOnlyFlushesOnce) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    rgb_matrix_sethsv_noeeprom(HSV_RED);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 4);
+
+    reset_counters();
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 20);
+    EXPECT_EQ(pwm_writes, 0);
+    EXPECT_EQ(pwm_bytes, 0);
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Ten LEDs spread over the whole PWM page, with gaps between them.
+#define LED(n) {0, (n) * 21, (n) * 21 + 1, (n) * 21 + 2}
+
+// clang-format off
+const aw20216s_led_t PROGMEM g_aw20216s_leds[AW20216S_LED_COUNT] = {
+    LED(0), LED(1), LED(2), LED(3), LED(4), LED(5), LED(6), LED(7), LED(8), LED(9),
+};
+
+led_config_t g_led_config = {
+    {
+        {      0,      1,      2,      3,      4,      5,      6,      7,      8,      9 },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    }, {
+        {0, 32}, {24, 32}, {48, 32}, {72, 32}, {96, 32}, {128, 32}, {152, 32}, {176, 32}, {200, 32}, {224, 32},
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    }
+};
+// clang-format on
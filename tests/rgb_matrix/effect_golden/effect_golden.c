@@ -0,0 +1,87 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "effect_golden.h"
+
+#define LAYOUT_COLS 20
+#define LAYOUT_ROWS ((RGB_MATRIX_LED_COUNT + LAYOUT_COLS - 1) / LAYOUT_COLS)
+#define RAND_SEED 2463534242u
+
+rgb_t    captured_frame[RGB_MATRIX_LED_COUNT];
+uint32_t captured_frame_count = 0;
+uint32_t captured_hash        = 0;
+
+static uint32_t rand_state = RAND_SEED;
+
+/* Replaces the C library's rand(), which some effects use, so that their
+ * frames are the same whichever C library the tests are built against. */
+int rand(void) {
+    // xorshift32
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return (rand_state >> 1) & RAND_MAX;
+}
+
+static void capture_init(void) {}
+
+static void capture_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    captured_frame[index] = (rgb_t){.r = red, .g = green, .b = blue};
+}
+
+static void capture_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        capture_set_color(i, red, green, blue);
+    }
+}
+
+// FNV-1a over every frame sent to the LEDs since the last reset
+static void capture_flush(void) {
+    const uint8_t *data = (const uint8_t *)captured_frame;
+    for (size_t i = 0; i < sizeof(captured_frame); i++) {
+        captured_hash = (captured_hash ^ data[i]) * 16777619u;
+    }
+    captured_frame_count++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = capture_init,
+    .set_color     = capture_set_color,
+    .set_color_all = capture_set_color_all,
+    .flush         = capture_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 40, 41, 42, 43, 44, 45, 46, 47, 48, 49 },
+        { 60, 61, 62, 63, 64, 65, 66, 67, 68, 69 },
+    },
+};
+// clang-format on
+
+void effect_golden_layout_init(void) {
+    // A grid of LEDs spread over the whole coordinate space, keys on the left with modifiers in the corners, underglow elsewhere
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint8_t col           = i % LAYOUT_COLS;
+        uint8_t row           = i / LAYOUT_COLS;
+        g_led_config.point[i] = (led_point_t){.x = col * 224 / (LAYOUT_COLS - 1), .y = row * 64 / (LAYOUT_ROWS - 1)};
+        if (col >= MATRIX_COLS || row >= MATRIX_ROWS) {
+            g_led_config.flags[i] = LED_FLAG_UNDERGLOW;
+        } else if (row == MATRIX_ROWS - 1 && (col < 2 || col >= MATRIX_COLS - 2)) {
+            g_led_config.flags[i] = LED_FLAG_MODIFIER;
+        } else {
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+    }
+}
+
+void effect_golden_reset(void) {
+    memset(captured_frame, 0, sizeof(captured_frame));
+    captured_frame_count = 0;
+    captured_hash        = 2166136261u;
+    rand_state           = RAND_SEED;
+}
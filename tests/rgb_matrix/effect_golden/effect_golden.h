@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+// Contents of the LEDs as of the last set_color call, the hash covers every frame flushed since the last reset
+extern rgb_t    captured_frame[RGB_MATRIX_LED_COUNT];
+extern uint32_t captured_frame_count;
+extern uint32_t captured_hash;
+
+void effect_golden_layout_init(void);
+void effect_golden_reset(void);
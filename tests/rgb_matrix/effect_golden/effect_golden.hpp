@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include <lib/lib8tion/lib8tion.h>
+#include "effect_golden.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define EFFECT_GOLDEN_FRAMES 64
+
+typedef std::map<std::string, uint32_t> golden_hashes_t;
+
+// Defined by each layout, in its golden_hashes.h
+extern const golden_hashes_t effect_golden_hashes;
+
+/* Steps every effect through the same sequence of frames and key presses,
+ * recording how long rgb_matrix_task() took for each frame and comparing the
+ * frames sent to the driver against the stored hashes.
+ *
+ * When an effect is changed on purpose, copy the hash from the failure into
+ * the golden_hashes.h of each layout. */
+class EffectGolden : public TestFixture {
+   protected:
+    void SetUp() override {
+        effect_golden_layout_init();
+        rgb_matrix_enable_noeeprom();
+    }
+
+    void check_effects(const golden_hashes_t &golden) {
+        RecordProperty("leds", RGB_MATRIX_LED_COUNT);
+        RecordProperty("frames", EFFECT_GOLDEN_FRAMES);
+
+        size_t checked = 0;
+        for (uint8_t mode = RGB_MATRIX_NONE + 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+            const std::string name = effect_names[mode];
+            start_effect(mode);
+
+            std::vector<std::chrono::nanoseconds> frame_times;
+            std::chrono::nanoseconds              frame_time{0};
+            for (uint32_t tick = 0; captured_frame_count < EFFECT_GOLDEN_FRAMES; tick++) {
+                // Press a different key every 100ms, and let go of it 30ms later
+                if (tick % 100 == 0 || tick % 100 == 30) {
+                    uint8_t key = (tick / 100) * 7 % (MATRIX_ROWS * MATRIX_COLS);
+                    rgb_matrix_handle_key_event(key / MATRIX_COLS, key % MATRIX_COLS, tick % 100 == 0);
+                }
+
+                uint32_t   frames = captured_frame_count;
+                const auto start  = std::chrono::steady_clock::now();
+                rgb_matrix_task();
+                frame_time += std::chrono::steady_clock::now() - start;
+                if (captured_frame_count != frames) {
+                    frame_times.push_back(frame_time);
+                    frame_time = std::chrono::nanoseconds{0};
+                }
+                advance_time(1);
+                ASSERT_LT(tick, EFFECT_GOLDEN_FRAMES * 100) << name << " stopped sending frames after " << captured_frame_count;
+            }
+
+            const auto total   = std::accumulate(frame_times.begin(), frame_times.end(), std::chrono::nanoseconds{0});
+            const auto slowest = *std::max_element(frame_times.begin(), frame_times.end());
+            char hash[11];
+            std::snprintf(hash, sizeof(hash), "0x%08x", captured_hash);
+            RecordProperty(name + "_mean_ns", (int)(total.count() / frame_times.size()));
+            RecordProperty(name + "_max_ns", (int)slowest.count());
+            RecordProperty(name + "_hash", hash);
+            auto expected = golden.find(name);
+            if (expected == golden.end()) {
+                ADD_FAILURE() << "No golden hash for " << name;
+                continue;
+            }
+            EXPECT_EQ(captured_hash, expected->second) << name << " rendered different frames, hash " << hash;
+            checked++;
+        }
+        EXPECT_EQ(checked, golden.size()) << "Golden hashes for effects which are not enabled";
+    }
+
+   private:
+    /* Puts everything an effect depends on back to the same state, so that
+     * its frames do not depend on the effects which ran before it. */
+    void start_effect(uint8_t mode) {
+        // Let any key hits from the previous effect expire, the second pass catches ones which had not aged yet
+        for (int i = 0; i < 2; i++) {
+            advance_time(UINT16_MAX);
+            rgb_matrix_task();
+        }
+
+        set_time(1000);
+        rgb_matrix_mode_noeeprom(mode);
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(127);
+        random16_set_seed(1337);
+        effect_golden_reset();
+    }
+
+    const char *effect_names[RGB_MATRIX_EFFECT_MAX] = {
+        "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+    };
+};
+
+TEST_F(EffectGolden, MatchesGoldenHashes) {
+    check_effects(effect_golden_hashes);
+}
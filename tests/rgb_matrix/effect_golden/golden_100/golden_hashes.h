@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../effect_golden.hpp"
+
+// clang-format off
+const golden_hashes_t effect_golden_hashes = {
+    {"SOLID_COLOR",                0x08e0b6c5},
+    {"ALPHAS_MODS",                0xc3fcd8c5},
+    {"GRADIENT_UP_DOWN",           0xe250c2c5},
+    {"GRADIENT_LEFT_RIGHT",        0xaa50c3c5},
+    {"BREATHING",                  0x6c81efa1},
+    {"BAND_SAT",                   0xf1051ffd},
+    {"BAND_VAL",                   0xa6eeb2ad},
+    {"BAND_PINWHEEL_SAT",          0x9aa63051},
+    {"BAND_PINWHEEL_VAL",          0xeaff056b},
+    {"BAND_SPIRAL_SAT",            0x387f6b39},
+    {"BAND_SPIRAL_VAL",            0xf6bdfde2},
+    {"CYCLE_ALL",                  0x2a944295},
+    {"CYCLE_LEFT_RIGHT",           0xaa8879ed},
+    {"CYCLE_UP_DOWN",              0x410229fd},
+    {"RAINBOW_MOVING_CHEVRON",     0x6cf4275d},
+    {"CYCLE_OUT_IN",               0xb1836555},
+    {"CYCLE_OUT_IN_DUAL",          0x0b94aef3},
+    {"CYCLE_PINWHEEL",             0x15822887},
+    {"CYCLE_SPIRAL",               0x97e10def},
+    {"DUAL_BEACON",                0x551edef5},
+    {"RAINBOW_BEACON",             0x4ea1d4ed},
+    {"RAINBOW_PINWHEELS",          0x86c4d5f3},
+    {"FLOWER_BLOOMING",            0x62b95e99},
+    {"RAINDROPS",                  0x206b5d03},
+    {"JELLYBEAN_RAINDROPS",        0xfd0c5c04},
+    {"HUE_BREATHING",              0xdc7928b5},
+    {"HUE_PENDULUM",               0x91afde51},
+    {"HUE_WAVE",                   0xb4c52eb1},
+    {"PIXEL_RAIN",                 0xb952d9c5},
+    {"PIXEL_FLOW",                 0x8cf0fddd},
+    {"PIXEL_FRACTAL",              0x00fbb315},
+    {"TYPING_HEATMAP",             0xe71d4984},
+    {"DIGITAL_RAIN",               0xd393ca49},
+    {"SOLID_REACTIVE_SIMPLE",      0x3baefb9d},
+    {"SOLID_REACTIVE",             0x8b38c01d},
+    {"SOLID_REACTIVE_WIDE",        0x76d0e6b7},
+    {"SOLID_REACTIVE_MULTIWIDE",   0x06140b52},
+    {"SOLID_REACTIVE_CROSS",       0x36165608},
+    {"SOLID_REACTIVE_MULTICROSS",  0x74e42fa8},
+    {"SOLID_REACTIVE_NEXUS",       0x8a4e5e1f},
+    {"SOLID_REACTIVE_MULTINEXUS",  0xe8ea871b},
+    {"SPLASH",                     0x8c3ec18e},
+    {"MULTISPLASH",                0xf4a242e8},
+    {"SOLID_SPLASH",               0x1d8fb245},
+    {"SOLID_MULTISPLASH",          0x0e0cb911},
+    {"STARLIGHT_SMOOTH",           0xf53bf830},
+    {"STARLIGHT",                  0xbbb4db1f},
+    {"STARLIGHT_DUAL_SAT",         0x7b1b8a98},
+    {"STARLIGHT_DUAL_HUE",         0x8d815cdd},
+    {"RIVERFLOW",                  0x58bc96d2},
+};
+// clang-format on
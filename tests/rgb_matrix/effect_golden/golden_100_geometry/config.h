@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 100
+#define RGB_MATRIX_GEOMETRY_TABLE
+
+#include "../effect_golden_config.h"
@@ -0,0 +1,123 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+// As generated by qmk generate-keyboard-c for the points set up by effect_golden_layout_init(), around the default center of {112, 32}
+const led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {
+    {116, 143}, {105, 144}, {94, 145}, {83, 147}, {72, 150}, {62, 152}, {52, 156}, {43, 161}, {36, 168}, {32, 181},
+    {32, 201}, {36, 215}, {43, 223}, {52, 227}, {61, 231}, {71, 234}, {82, 237}, {93, 238}, {104, 240}, {116, 241},
+    {113, 136}, {102, 137}, {90, 138}, {78, 140}, {66, 141}, {56, 143}, {44, 146}, {34, 151}, {24, 159}, {17, 174},
+    {16, 208}, {23, 224}, {33, 233}, {44, 238}, {55, 241}, {65, 243}, {77, 244}, {89, 246}, {101, 247}, {113, 248},
+    {112, 128}, {101, 128}, {89, 128}, {77, 128}, {65, 128}, {54, 128}, {42, 128}, {30, 128}, {18, 128}, {6, 128},
+    {5, 0}, {17, 0}, {29, 0}, {41, 0}, {53, 0}, {64, 0}, {76, 0}, {88, 0}, {100, 0}, {112, 0},
+    {113, 120}, {102, 119}, {90, 118}, {78, 116}, {66, 115}, {56, 113}, {44, 110}, {34, 105}, {24, 97}, {17, 82},
+    {16, 48}, {23, 32}, {33, 23}, {44, 18}, {55, 15}, {65, 13}, {77, 12}, {89, 10}, {101, 9}, {113, 8},
+    {116, 113}, {105, 112}, {94, 111}, {83, 109}, {72, 106}, {62, 104}, {52, 100}, {43, 95}, {36, 88}, {32, 75},
+    {32, 55}, {36, 41}, {43, 33}, {52, 29}, {61, 25}, {71, 22}, {82, 19}, {93, 18}, {104, 16}, {116, 15},
+};
+
+const uint8_t g_led_distance[RGB_MATRIX_LED_COUNT][RGB_MATRIX_LED_COUNT] PROGMEM = {
+    {   0,  11,  23,  35,  47,  58,  70,  82,  94, 106, 117, 129, 141, 153, 165, 176, 188, 200, 212, 224,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,  32,  33,  39,  47,  56,  66,  76,  88,  99, 110, 121, 132, 144, 156, 168, 178, 190, 202, 214, 226,  48,  49,  53,  59,  67,  75,  84,  95, 105, 116, 126, 137, 148, 160, 171, 182, 194, 205, 217, 229,  64,  64,  68,  72,  79,  86,  94, 104, 113, 123, 133, 144, 154, 165, 176, 187, 198, 209, 221, 232 },
+    {  11,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154, 165, 177, 189, 201, 213,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  33,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157, 168, 179, 191, 203, 215,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161, 171, 183, 195, 206, 218,  64,  64,  65,  68,  73,  79,  87,  95, 104, 114, 123, 134, 144, 155, 166, 176, 188, 199, 210, 222 },
+    {  23,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142, 153, 165, 177, 189, 201,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  39,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145, 156, 168, 179, 191, 203,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149, 160, 171, 183, 195, 206,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 155, 165, 176, 188, 199, 210 },
+    {  35,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130, 141, 153, 165, 177, 189,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  47,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 144, 156, 168, 179, 191,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 148, 160, 171, 183, 195,  72,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 154, 165, 176, 188, 199 },
+    {  47,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 129, 141, 153, 165, 177,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  56,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 132, 144, 156, 168, 179,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 137, 148, 160, 171, 183,  79,  73,  68,  65,  64,  64,  68,  72,  79,  87,  94, 104, 113, 123, 134, 144, 154, 165, 176, 188 },
+    {  58,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 130, 142, 154, 166,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  66,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 122, 133, 145, 157, 169,  75,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 127, 138, 149, 161, 172,  86,  79,  72,  68,  64,  64,  65,  68,  73,  80,  87,  95, 104, 114, 124, 134, 144, 155, 166, 177 },
+    {  70,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  76,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161,  94,  87,  79,  72,  68,  65,  64,  65,  68,  73,  79,  87,  95, 104, 114, 123, 134, 144, 155, 166 },
+    {  82,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 155 },
+    {  94,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  99,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 105,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 113, 104,  95,  87,  79,  73,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144 },
+    { 106,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 110, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 123, 114, 104,  95,  87,  80,  73,  68,  65,  64,  64,  68,  72,  79,  87,  94, 104, 113, 123, 134 },
+    { 117, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 121, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 126, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 133, 123, 113, 104,  94,  87,  79,  72,  68,  64,  64,  65,  68,  73,  80,  87,  95, 104, 114, 124 },
+    { 129, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 132, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 137, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  73,  79,  87,  95, 104, 114 },
+    { 141, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 154, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104 },
+    { 153, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 156, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77, 160, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85, 165, 155, 144, 134, 123, 114, 104,  95,  87,  79,  73,  68,  65,  64,  65,  68,  72,  79,  87,  95 },
+    { 165, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 168, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67, 171, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76, 176, 166, 155, 144, 134, 124, 114, 104,  95,  87,  80,  73,  68,  65,  64,  64,  68,  72,  79,  87 },
+    { 176, 165, 153, 141, 129, 118, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 178, 168, 156, 144, 132, 122, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57, 182, 171, 160, 148, 137, 127, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67, 187, 176, 165, 154, 144, 134, 123, 113, 104,  94,  87,  79,  72,  68,  64,  64,  65,  68,  73,  80 },
+    { 188, 177, 165, 153, 141, 130, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 190, 179, 168, 156, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48, 194, 183, 171, 160, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60, 198, 188, 176, 165, 154, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  73 },
+    { 200, 189, 177, 165, 153, 142, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 202, 191, 179, 168, 156, 145, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40, 205, 195, 183, 171, 160, 149, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53, 209, 199, 188, 176, 165, 155, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68 },
+    { 212, 201, 189, 177, 165, 154, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 214, 203, 191, 179, 168, 157, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34, 217, 206, 195, 183, 171, 161, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49, 221, 210, 199, 188, 176, 166, 155, 144, 134, 123, 114, 104,  95,  87,  79,  73,  68,  65,  64,  65 },
+    { 224, 213, 201, 189, 177, 166, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 226, 215, 203, 191, 179, 169, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32, 229, 218, 206, 195, 183, 172, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48, 232, 222, 210, 199, 188, 177, 166, 155, 144, 134, 124, 114, 104,  95,  87,  80,  73,  68,  65,  64 },
+    {  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,   0,  11,  23,  35,  47,  58,  70,  82,  94, 106, 117, 129, 141, 153, 165, 176, 188, 200, 212, 224,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,  32,  33,  39,  47,  56,  66,  76,  88,  99, 110, 121, 132, 144, 156, 168, 178, 190, 202, 214, 226,  48,  49,  53,  59,  67,  75,  84,  95, 105, 116, 126, 137, 148, 160, 171, 182, 194, 205, 217, 229 },
+    {  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  11,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154, 165, 177, 189, 201, 213,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  33,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157, 168, 179, 191, 203, 215,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161, 171, 183, 195, 206, 218 },
+    {  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  23,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142, 153, 165, 177, 189, 201,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  39,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145, 156, 168, 179, 191, 203,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149, 160, 171, 183, 195, 206 },
+    {  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  35,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130, 141, 153, 165, 177, 189,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  47,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 144, 156, 168, 179, 191,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 148, 160, 171, 183, 195 },
+    {  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  47,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 129, 141, 153, 165, 177,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  56,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 132, 144, 156, 168, 179,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 137, 148, 160, 171, 183 },
+    {  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  58,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 130, 142, 154, 166,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  66,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 122, 133, 145, 157, 169,  75,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 127, 138, 149, 161, 172 },
+    {  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  70,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  76,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161 },
+    {  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  82,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149 },
+    {  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  94,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  99,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 105,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138 },
+    { 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 106,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 110, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127 },
+    { 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 117, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 121, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 126, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117 },
+    { 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 129, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 132, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 137, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106 },
+    { 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 141, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95 },
+    { 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 153, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 156, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77, 160, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85 },
+    { 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 165, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 168, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67, 171, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76 },
+    { 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 176, 165, 153, 141, 129, 118, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 178, 168, 156, 144, 132, 122, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57, 182, 171, 160, 148, 137, 127, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67 },
+    { 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 188, 177, 165, 153, 141, 130, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 190, 179, 168, 156, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48, 194, 183, 171, 160, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60 },
+    { 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 200, 189, 177, 165, 153, 142, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 202, 191, 179, 168, 156, 145, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40, 205, 195, 183, 171, 160, 149, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53 },
+    { 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 212, 201, 189, 177, 165, 154, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 214, 203, 191, 179, 168, 157, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34, 217, 206, 195, 183, 171, 161, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49 },
+    { 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 224, 213, 201, 189, 177, 166, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 226, 215, 203, 191, 179, 169, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32, 229, 218, 206, 195, 183, 172, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48 },
+    {  32,  33,  39,  47,  56,  66,  76,  88,  99, 110, 121, 132, 144, 156, 168, 178, 190, 202, 214, 226,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,   0,  11,  23,  35,  47,  58,  70,  82,  94, 106, 117, 129, 141, 153, 165, 176, 188, 200, 212, 224,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,  32,  33,  39,  47,  56,  66,  76,  88,  99, 110, 121, 132, 144, 156, 168, 178, 190, 202, 214, 226 },
+    {  33,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157, 168, 179, 191, 203, 215,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  11,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154, 165, 177, 189, 201, 213,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  33,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157, 168, 179, 191, 203, 215 },
+    {  39,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145, 156, 168, 179, 191, 203,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  23,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142, 153, 165, 177, 189, 201,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  39,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145, 156, 168, 179, 191, 203 },
+    {  47,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 144, 156, 168, 179, 191,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  35,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130, 141, 153, 165, 177, 189,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  47,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 144, 156, 168, 179, 191 },
+    {  56,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 132, 144, 156, 168, 179,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  47,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 129, 141, 153, 165, 177,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  56,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 132, 144, 156, 168, 179 },
+    {  66,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 122, 133, 145, 157, 169,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  58,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 130, 142, 154, 166,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  66,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 122, 133, 145, 157, 169 },
+    {  76,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  70,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  76,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157 },
+    {  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  82,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145 },
+    {  99,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  94,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  99,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133 },
+    { 110, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 106,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 110, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122 },
+    { 121, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 117, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 121, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111 },
+    { 132, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 129, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 132, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100 },
+    { 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 141, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88 },
+    { 156, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 153, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 156, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77 },
+    { 168, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 165, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 168, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67 },
+    { 178, 168, 156, 144, 132, 122, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 176, 165, 153, 141, 129, 118, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 178, 168, 156, 144, 132, 122, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57 },
+    { 190, 179, 168, 156, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 188, 177, 165, 153, 141, 130, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 190, 179, 168, 156, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48 },
+    { 202, 191, 179, 168, 156, 145, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 200, 189, 177, 165, 153, 142, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 202, 191, 179, 168, 156, 145, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40 },
+    { 214, 203, 191, 179, 168, 157, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 212, 201, 189, 177, 165, 154, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 214, 203, 191, 179, 168, 157, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34 },
+    { 226, 215, 203, 191, 179, 169, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 224, 213, 201, 189, 177, 166, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 226, 215, 203, 191, 179, 169, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32 },
+    {  48,  49,  53,  59,  67,  75,  84,  95, 105, 116, 126, 137, 148, 160, 171, 182, 194, 205, 217, 229,  32,  33,  39,  47,  56,  66,  76,  88,  99, 110, 121, 132, 144, 156, 168, 178, 190, 202, 214, 226,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,   0,  11,  23,  35,  47,  58,  70,  82,  94, 106, 117, 129, 141, 153, 165, 176, 188, 200, 212, 224,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224 },
+    {  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161, 171, 183, 195, 206, 218,  33,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157, 168, 179, 191, 203, 215,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  11,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154, 165, 177, 189, 201, 213,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213 },
+    {  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149, 160, 171, 183, 195, 206,  39,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145, 156, 168, 179, 191, 203,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  23,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142, 153, 165, 177, 189, 201,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201 },
+    {  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 148, 160, 171, 183, 195,  47,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 144, 156, 168, 179, 191,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  35,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130, 141, 153, 165, 177, 189,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189 },
+    {  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 137, 148, 160, 171, 183,  56,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 132, 144, 156, 168, 179,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  47,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 129, 141, 153, 165, 177,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177 },
+    {  75,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 127, 138, 149, 161, 172,  66,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 122, 133, 145, 157, 169,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  58,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 130, 142, 154, 166,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166 },
+    {  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161,  76,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  70,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154 },
+    {  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  82,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142 },
+    { 105,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138,  99,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  94,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130 },
+    { 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 110, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 106,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119 },
+    { 126, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 121, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 117, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108 },
+    { 137, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 132, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 129, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96 },
+    { 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 141, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84 },
+    { 160, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85, 156, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 153, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72 },
+    { 171, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76, 168, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 165, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61 },
+    { 182, 171, 160, 148, 137, 127, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67, 178, 168, 156, 144, 132, 122, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 176, 165, 153, 141, 129, 118, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50 },
+    { 194, 183, 171, 160, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60, 190, 179, 168, 156, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 188, 177, 165, 153, 141, 130, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39 },
+    { 205, 195, 183, 171, 160, 149, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53, 202, 191, 179, 168, 156, 145, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 200, 189, 177, 165, 153, 142, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28 },
+    { 217, 206, 195, 183, 171, 161, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49, 214, 203, 191, 179, 168, 157, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 212, 201, 189, 177, 165, 154, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20 },
+    { 229, 218, 206, 195, 183, 172, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48, 226, 215, 203, 191, 179, 169, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 224, 213, 201, 189, 177, 166, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16 },
+    {  64,  64,  68,  72,  79,  86,  94, 104, 113, 123, 133, 144, 154, 165, 176, 187, 198, 209, 221, 232,  48,  49,  53,  59,  67,  75,  84,  95, 105, 116, 126, 137, 148, 160, 171, 182, 194, 205, 217, 229,  32,  33,  39,  47,  56,  66,  76,  88,  99, 110, 121, 132, 144, 156, 168, 178, 190, 202, 214, 226,  16,  19,  28,  38,  49,  60,  71,  83,  95, 107, 118, 129, 141, 153, 165, 176, 188, 200, 212, 224,   0,  11,  23,  35,  47,  58,  70,  82,  94, 106, 117, 129, 141, 153, 165, 176, 188, 200, 212, 224 },
+    {  64,  64,  65,  68,  73,  79,  87,  95, 104, 114, 123, 134, 144, 155, 166, 176, 188, 199, 210, 222,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161, 171, 183, 195, 206, 218,  33,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157, 168, 179, 191, 203, 215,  19,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154, 165, 177, 189, 201, 213,  11,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154, 165, 177, 189, 201, 213 },
+    {  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 155, 165, 176, 188, 199, 210,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149, 160, 171, 183, 195, 206,  39,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145, 156, 168, 179, 191, 203,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142, 153, 165, 177, 189, 201,  23,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142, 153, 165, 177, 189, 201 },
+    {  72,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 154, 165, 176, 188, 199,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 148, 160, 171, 183, 195,  47,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133, 144, 156, 168, 179, 191,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130, 141, 153, 165, 177, 189,  35,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130, 141, 153, 165, 177, 189 },
+    {  79,  73,  68,  65,  64,  64,  68,  72,  79,  87,  94, 104, 113, 123, 134, 144, 154, 165, 176, 188,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 137, 148, 160, 171, 183,  56,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 132, 144, 156, 168, 179,  49,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 129, 141, 153, 165, 177,  47,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118, 129, 141, 153, 165, 177 },
+    {  86,  79,  72,  68,  64,  64,  65,  68,  73,  80,  87,  95, 104, 114, 124, 134, 144, 155, 166, 177,  75,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 127, 138, 149, 161, 172,  66,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 122, 133, 145, 157, 169,  60,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 119, 130, 142, 154, 166,  58,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107, 118, 130, 142, 154, 166 },
+    {  94,  87,  79,  72,  68,  65,  64,  65,  68,  73,  79,  87,  95, 104, 114, 123, 134, 144, 155, 166,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 116, 127, 138, 149, 161,  76,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 110, 122, 133, 145, 157,  71,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 107, 119, 130, 142, 154,  70,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95, 106, 118, 130, 142, 154 },
+    { 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 155,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138, 149,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88,  99, 110, 122, 133, 145,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84,  95, 107, 119, 130, 142,  82,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83,  94, 106, 118, 130, 142 },
+    { 113, 104,  95,  87,  79,  73,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 113, 123, 134, 144, 105,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 105, 116, 127, 138,  99,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77,  88,  99, 110, 122, 133,  95,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72,  83,  95, 107, 119, 130,  94,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71,  82,  94, 106, 118, 130 },
+    { 123, 114, 104,  95,  87,  80,  73,  68,  65,  64,  64,  68,  72,  79,  87,  94, 104, 113, 123, 134, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  84,  95, 105, 116, 127, 110, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67,  76,  88,  99, 110, 122, 107,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61,  71,  83,  95, 107, 119, 106,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59,  70,  82,  94, 106, 118 },
+    { 133, 123, 113, 104,  94,  87,  79,  72,  68,  64,  64,  65,  68,  73,  80,  87,  95, 104, 114, 124, 126, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 117, 121, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57,  67,  77,  88, 100, 111, 118, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50,  61,  72,  84,  96, 108, 117, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48,  59,  71,  83,  95, 107 },
+    { 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  73,  79,  87,  95, 104, 114, 137, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67,  76,  85,  95, 106, 132, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48,  56,  67,  77,  88, 100, 129, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39,  49,  61,  72,  84,  96, 129, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36,  47,  59,  71,  83,  95 },
+    { 154, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  72,  79,  87,  95, 104, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  59,  67,  76,  85,  95, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40,  47,  56,  67,  77,  88, 141, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28,  38,  49,  61,  72,  84, 141, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24,  35,  47,  59,  71,  83 },
+    { 165, 155, 144, 134, 123, 114, 104,  95,  87,  79,  73,  68,  65,  64,  65,  68,  72,  79,  87,  95, 160, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76,  85, 156, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34,  39,  47,  56,  67,  77, 153, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20,  28,  38,  49,  61,  72, 153, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12,  23,  35,  47,  59,  71 },
+    { 176, 166, 155, 144, 134, 124, 114, 104,  95,  87,  80,  73,  68,  65,  64,  64,  68,  72,  79,  87, 171, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49,  53,  59,  67,  76, 168, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32,  33,  39,  47,  56,  67, 165, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16,  19,  28,  38,  49,  61, 165, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0,  11,  23,  35,  47,  59 },
+    { 187, 176, 165, 154, 144, 134, 123, 113, 104,  94,  87,  79,  72,  68,  64,  64,  65,  68,  73,  80, 182, 171, 160, 148, 137, 127, 116, 105,  95,  84,  76,  67,  59,  53,  49,  48,  49,  53,  60,  67, 178, 168, 156, 144, 132, 122, 110,  99,  88,  76,  67,  56,  47,  39,  33,  32,  34,  40,  48,  57, 176, 165, 153, 141, 129, 119, 107,  95,  83,  71,  61,  49,  38,  28,  19,  16,  20,  28,  39,  50, 176, 165, 153, 141, 129, 118, 106,  94,  82,  70,  59,  47,  35,  23,  11,   0,  12,  24,  36,  48 },
+    { 198, 188, 176, 165, 154, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68,  73, 194, 183, 171, 160, 148, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53,  60, 190, 179, 168, 156, 144, 133, 122, 110,  99,  88,  77,  67,  56,  47,  39,  34,  32,  34,  40,  48, 188, 177, 165, 153, 141, 130, 119, 107,  95,  83,  72,  61,  49,  38,  28,  20,  16,  20,  28,  39, 188, 177, 165, 153, 141, 130, 118, 106,  94,  82,  71,  59,  47,  35,  23,  12,   0,  12,  24,  36 },
+    { 209, 199, 188, 176, 165, 155, 144, 134, 123, 113, 104,  95,  87,  79,  72,  68,  65,  64,  65,  68, 205, 195, 183, 171, 160, 149, 138, 127, 116, 105,  95,  85,  76,  67,  59,  53,  49,  48,  49,  53, 202, 191, 179, 168, 156, 145, 133, 122, 110,  99,  88,  77,  67,  56,  47,  40,  34,  32,  34,  40, 200, 189, 177, 165, 153, 142, 130, 119, 107,  95,  84,  72,  61,  49,  38,  28,  20,  16,  20,  28, 200, 189, 177, 165, 153, 142, 130, 118, 106,  94,  83,  71,  59,  47,  35,  24,  12,   0,  12,  24 },
+    { 221, 210, 199, 188, 176, 166, 155, 144, 134, 123, 114, 104,  95,  87,  79,  73,  68,  65,  64,  65, 217, 206, 195, 183, 171, 161, 149, 138, 127, 116, 106,  95,  85,  76,  67,  60,  53,  49,  48,  49, 214, 203, 191, 179, 168, 157, 145, 133, 122, 110, 100,  88,  77,  67,  56,  48,  40,  34,  32,  34, 212, 201, 189, 177, 165, 154, 142, 130, 119, 107,  96,  84,  72,  61,  49,  39,  28,  20,  16,  20, 212, 201, 189, 177, 165, 154, 142, 130, 118, 106,  95,  83,  71,  59,  47,  36,  24,  12,   0,  12 },
+    { 232, 222, 210, 199, 188, 177, 166, 155, 144, 134, 124, 114, 104,  95,  87,  80,  73,  68,  65,  64, 229, 218, 206, 195, 183, 172, 161, 149, 138, 127, 117, 106,  95,  85,  76,  67,  60,  53,  49,  48, 226, 215, 203, 191, 179, 169, 157, 145, 133, 122, 111, 100,  88,  77,  67,  57,  48,  40,  34,  32, 224, 213, 201, 189, 177, 166, 154, 142, 130, 119, 108,  96,  84,  72,  61,  50,  39,  28,  20,  16, 224, 213, 201, 189, 177, 166, 154, 142, 130, 118, 107,  95,  83,  71,  59,  48,  36,  24,  12,   0 },
+};
+// clang-format on
@@ -0,0 +1,9 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+# Relative to the test, so that each LED count gets its own build of the harness
+SRC += $(TEST_PATH)/../effect_golden.c
+SRC += $(TEST_PATH)/led_geometry.c
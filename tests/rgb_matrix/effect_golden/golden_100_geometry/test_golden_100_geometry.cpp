@@ -0,0 +1,7 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../effect_golden.hpp"
+
+// The precomputed distances and angles have to render the same frames as working them out on every frame
+#include "../golden_100/golden_hashes.h"
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../effect_golden.hpp"
+
+// clang-format off
+const golden_hashes_t effect_golden_hashes = {
+    {"SOLID_COLOR",                0x16d0cfc5},
+    {"ALPHAS_MODS",                0xb7ebb5c5},
+    {"GRADIENT_UP_DOWN",           0x76118fc5},
+    {"GRADIENT_LEFT_RIGHT",        0x934ce9c5},
+    {"BREATHING",                  0x65e40bfd},
+    {"BAND_SAT",                   0xe8ff3c21},
+    {"BAND_VAL",                   0x3088cf5d},
+    {"BAND_PINWHEEL_SAT",          0x53be0d88},
+    {"BAND_PINWHEEL_VAL",          0x3d970170},
+    {"BAND_SPIRAL_SAT",            0x8264b37c},
+    {"BAND_SPIRAL_VAL",            0xda1d24a5},
+    {"CYCLE_ALL",                  0xc9e027f5},
+    {"CYCLE_LEFT_RIGHT",           0x63107be5},
+    {"CYCLE_UP_DOWN",              0x0029fcd5},
+    {"RAINBOW_MOVING_CHEVRON",     0x6f8bc42f},
+    {"CYCLE_OUT_IN",               0xcd58452f},
+    {"CYCLE_OUT_IN_DUAL",          0x401ac28f},
+    {"CYCLE_PINWHEEL",             0xf5222cdb},
+    {"CYCLE_SPIRAL",               0x443c90b3},
+    {"DUAL_BEACON",                0x9a989cbf},
+    {"RAINBOW_BEACON",             0xee4c0b43},
+    {"RAINBOW_PINWHEELS",          0x07af95a9},
+    {"FLOWER_BLOOMING",            0x9787d531},
+    {"RAINDROPS",                  0x7d97b61f},
+    {"JELLYBEAN_RAINDROPS",        0xd8155ed0},
+    {"HUE_BREATHING",              0x3b942ae5},
+    {"HUE_PENDULUM",               0x3bc6e9dd},
+    {"HUE_WAVE",                   0x3ba8295d},
+    {"PIXEL_RAIN",                 0x485915c5},
+    {"PIXEL_FLOW",                 0xfa81a2ed},
+    {"PIXEL_FRACTAL",              0xe8503095},
+    {"TYPING_HEATMAP",             0xbeeacdf8},
+    {"DIGITAL_RAIN",               0x09e51be9},
+    {"SOLID_REACTIVE_SIMPLE",      0x4803160d},
+    {"SOLID_REACTIVE",             0x4633c7f5},
+    {"SOLID_REACTIVE_WIDE",        0xf6b42ada},
+    {"SOLID_REACTIVE_MULTIWIDE",   0xc3c635b9},
+    {"SOLID_REACTIVE_CROSS",       0x295495ba},
+    {"SOLID_REACTIVE_MULTICROSS",  0xedf53145},
+    {"SOLID_REACTIVE_NEXUS",       0x4cb490bd},
+    {"SOLID_REACTIVE_MULTINEXUS",  0x3510ec55},
+    {"SPLASH",                     0x393285f5},
+    {"MULTISPLASH",                0x26ed0744},
+    {"SOLID_SPLASH",               0xcb0df652},
+    {"SOLID_MULTISPLASH",          0xa0f1b120},
+    {"STARLIGHT_SMOOTH",           0x2ad92d57},
+    {"STARLIGHT",                  0xefecfeff},
+    {"STARLIGHT_DUAL_SAT",         0x4c312ee3},
+    {"STARLIGHT_DUAL_HUE",         0x7010d725},
+    {"RIVERFLOW",                  0x374a8956},
+};
+// clang-format on
@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <cstring>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "i2c_master.h"
+#include "rgb_matrix.h"
+
+uint8_t get_pwm_value(uint8_t driver, uint16_t reg);
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+/* Bytes a flush of every PWM register costs: a write-lock unlock and a page
+ * select per page, then 6 transfers of 30 and 9 transfers of 19 registers,
+ * each with the device address and the starting register. */
+static const uint32_t full_refresh_bytes = 2 * (2 * 3) + 6 * (2 + 30) + 9 * (2 + 19);
+
+/* Minimal model of one IS31FL3741 on the bus. */
+static uint8_t  device_page = 0;
+static uint8_t  device_pwm[2][256];
+static uint32_t bus_bytes  = 0;
+static uint32_t pwm_writes = 0;
+
+static uint32_t frames          = 0;
+static uint32_t frame_start     = 0;
+static uint32_t frame_bytes_max = 0;
+
+extern "C" void i2c_init(void) {}
+
+extern "C" i2c_status_t i2c_write_register(uint8_t address, uint8_t reg, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    bus_bytes += 2 + length;
+
+    if (reg == IS31FL3741_REG_COMMAND && length == 1) {
+        device_page = data[0];
+    } else if (reg != IS31FL3741_REG_COMMAND_WRITE_LOCK && device_page <= IS31FL3741_COMMAND_PWM_1) {
+        EXPECT_LE(reg + length, 256);
+        memcpy(&device_pwm[device_page][reg], data, length);
+        pwm_writes++;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+/* Called once per frame, right before the frame is flushed. */
+extern "C" bool rgb_matrix_indicators_user(void) {
+    if (frames > 0) {
+        frame_bytes_max = std::max(frame_bytes_max, bus_bytes - frame_start);
+    }
+    frame_start = bus_bytes;
+    frames++;
+    return true;
+}
+
+class Is31fl3741Flush : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+    }
+
+    void reset_counters() {
+        bus_bytes       = 0;
+        pwm_writes      = 0;
+        frames          = 0;
+        frame_start     = 0;
+        frame_bytes_max = 0;
+    }
+
+    /* Flushes whatever the renderer left pending, then compares the model of
+     * the device against the driver's PWM buffer. */
+    void expect_device_matches_driver() {
+        rgb_matrix_update_pwm_buffers();
+        for (uint16_t reg = 0; reg < 180; reg++) {
+            ASSERT_EQ(device_pwm[0][reg], get_pwm_value(0, reg)) << "page 0 register " << reg;
+        }
+        for (uint16_t reg = 0; reg < 171; reg++) {
+            ASSERT_EQ(device_pwm[1][reg], get_pwm_value(0, 0x100 | reg)) << "page 1 register " << reg;
+        }
+    }
+};
+
+TEST_F(Is31fl3741Flush, static_effect_only_flushes_once) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 4);
+    expect_device_matches_driver();
+
+    reset_counters();
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 20);
+    EXPECT_GT(frames, 10);
+    EXPECT_EQ(pwm_writes, 0);
+    EXPECT_EQ(bus_bytes, 0);
+
+    // A single changed LED only rewrites the block holding it.
+    rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 4);
+    expect_device_matches_driver();
+    reset_counters();
+    rgb_matrix_set_color(0, 1, 2, 3);
+    rgb_matrix_update_pwm_buffers();
+    EXPECT_EQ(pwm_writes, 1);
+    EXPECT_EQ(bus_bytes, 2 * 3 + 2 + 30);
+    expect_device_matches_driver();
+}
+
+/* Runs every effect with some typing and records the bus traffic per frame,
+ * checking that the device always ends up with the driver's PWM values. */
+TEST_F(Is31fl3741Flush, every_effect_keeps_device_in_sync) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    auto key_a = KeymapKey(0, 3, 1, KC_A);
+    auto key_l = KeymapKey(0, 8, 2, KC_L);
+    set_keymap({key_a, key_l});
+
+    for (uint8_t mode = RGB_MATRIX_NONE + 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        rgb_matrix_mode_noeeprom(mode);
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 4);
+        reset_counters();
+
+        for (uint8_t i = 0; i < 10; i++) {
+            tap_key(i % 2 ? key_l : key_a, 20);
+            idle_for(80);
+        }
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+        ASSERT_GT(frames, 1) << "mode " << +mode;
+
+        // Bytes up to the start of the last frame, which may not be flushed yet.
+        const uint32_t average = frame_start / (frames - 1);
+        const std::string prefix  = "mode_" + std::to_string(mode) + "_";
+        RecordProperty(prefix + "frames", frames - 1);
+        RecordProperty(prefix + "avg_bytes_per_frame", average);
+        RecordProperty(prefix + "max_bytes_per_frame", frame_bytes_max);
+        EXPECT_LE(frame_bytes_max, full_refresh_bytes) << "mode " << +mode;
+        expect_device_matches_driver();
+    }
+}
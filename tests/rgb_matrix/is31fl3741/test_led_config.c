@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// One LED per key, spread over both PWM pages so every register block is used.
+#define REG(n) ((n) < 180 ? (n) : 0x100 | ((n) - 180))
+#define LED(n) {0, REG((n) * 8), REG((n) * 8 + 1), REG((n) * 8 + 2)}
+
+// clang-format off
+const is31fl3741_led_t PROGMEM g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+    LED(0),  LED(1),  LED(2),  LED(3),  LED(4),  LED(5),  LED(6),  LED(7),  LED(8),  LED(9),
+    LED(10), LED(11), LED(12), LED(13), LED(14), LED(15), LED(16), LED(17), LED(18), LED(19),
+    LED(20), LED(21), LED(22), LED(23), LED(24), LED(25), LED(26), LED(27), LED(28), LED(29),
+    LED(30), LED(31), LED(32), LED(33), LED(34), LED(35), LED(36), LED(37), LED(38), LED(39),
+};
+
+#define POINT_ROW(y) {0, y}, {24, y}, {48, y}, {72, y}, {96, y}, {128, y}, {152, y}, {176, y}, {200, y}, {224, y}
+
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 },
+    }, {
+        POINT_ROW(0), POINT_ROW(21), POINT_ROW(43), POINT_ROW(64),
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 4, 4, 4, 4, 4, 4, 1, 1,
+    }
+};
+// clang-format on
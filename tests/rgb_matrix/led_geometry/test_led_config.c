@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint32_t flush_count = 0;
+
+static void noop_init(void) {}
+static void noop_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {}
+static void noop_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {}
+static void count_flush(void) {
+    flush_count++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = noop_init,
+    .set_color     = noop_set_color,
+    .set_color_all = noop_set_color_all,
+    .flush         = count_flush,
+};
+
+// clang-format off
+#define POINT_ROW(y) {0, y}, {24, y}, {48, y}, {72, y}, {96, y}, {128, y}, {152, y}, {176, y}, {200, y}, {224, y}
+
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 },
+    }, {
+        POINT_ROW(0), POINT_ROW(21), POINT_ROW(43), POINT_ROW(64),
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 4, 4, 4, 4, 4, 4, 1, 1,
+    }
+};
+
+// As generated by qmk generate-keyboard-c for handwired/pytest/led_geometry, around the default center of {112, 32}
+const led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {
+    {116, 143}, {93, 146}, {71, 150}, {51, 157}, {35, 170}, {35, 214}, {51, 227}, {71, 234}, {93, 238}, {116, 241},
+    {112, 134}, {88, 136}, {64, 138}, {41, 142}, {19, 155}, {19, 229}, {41, 242}, {64, 246}, {88, 248}, {112, 250},
+    {112, 122}, {88, 120}, {64, 118}, {41, 114}, {19, 101}, {19, 27}, {41, 14}, {64, 10}, {88, 8}, {112, 6},
+    {116, 113}, {93, 110}, {71, 106}, {51, 99}, {35, 86}, {35, 42}, {51, 29}, {71, 22}, {93, 18}, {116, 15},
+};
+
+const uint8_t g_led_distance[RGB_MATRIX_LED_COUNT][RGB_MATRIX_LED_COUNT] PROGMEM = {
+    {   0,  24,  48,  72,  96, 128, 152, 176, 200, 224,  21,  31,  52,  75,  98, 129, 153, 177, 201, 224,  43,  49,  64,  83, 105, 135, 157, 181, 204, 228,  64,  68,  80,  96, 115, 143, 164, 187, 209, 232 },
+    {  24,   0,  24,  48,  72, 104, 128, 152, 176, 200,  31,  21,  31,  52,  75, 106, 129, 153, 177, 201,  49,  43,  49,  64,  83, 112, 135, 157, 181, 204,  68,  64,  68,  80,  96, 122, 143, 164, 187, 209 },
+    {  48,  24,   0,  24,  48,  80, 104, 128, 152, 176,  52,  31,  21,  31,  52,  82, 106, 129, 153, 177,  64,  49,  43,  49,  64,  90, 112, 135, 157, 181,  80,  68,  64,  68,  80, 102, 122, 143, 164, 187 },
+    {  72,  48,  24,   0,  24,  56,  80, 104, 128, 152,  75,  52,  31,  21,  31,  59,  82, 106, 129, 153,  83,  64,  49,  43,  49,  70,  90, 112, 135, 157,  96,  80,  68,  64,  68,  85, 102, 122, 143, 164 },
+    {  96,  72,  48,  24,   0,  32,  56,  80, 104, 128,  98,  75,  52,  31,  21,  38,  59,  82, 106, 129, 105,  83,  64,  49,  43,  53,  70,  90, 112, 135, 115,  96,  80,  68,  64,  71,  85, 102, 122, 143 },
+    { 128, 104,  80,  56,  32,   0,  24,  48,  72,  96, 129, 106,  82,  59,  38,  21,  31,  52,  75,  98, 135, 112,  90,  70,  53,  43,  49,  64,  83, 105, 143, 122, 102,  85,  71,  64,  68,  80,  96, 115 },
+    { 152, 128, 104,  80,  56,  24,   0,  24,  48,  72, 153, 129, 106,  82,  59,  31,  21,  31,  52,  75, 157, 135, 112,  90,  70,  49,  43,  49,  64,  83, 164, 143, 122, 102,  85,  68,  64,  68,  80,  96 },
+    { 176, 152, 128, 104,  80,  48,  24,   0,  24,  48, 177, 153, 129, 106,  82,  52,  31,  21,  31,  52, 181, 157, 135, 112,  90,  64,  49,  43,  49,  64, 187, 164, 143, 122, 102,  80,  68,  64,  68,  80 },
+    { 200, 176, 152, 128, 104,  72,  48,  24,   0,  24, 201, 177, 153, 129, 106,  75,  52,  31,  21,  31, 204, 181, 157, 135, 112,  83,  64,  49,  43,  49, 209, 187, 164, 143, 122,  96,  80,  68,  64,  68 },
+    { 224, 200, 176, 152, 128,  96,  72,  48,  24,   0, 224, 201, 177, 153, 129,  98,  75,  52,  31,  21, 228, 204, 181, 157, 135, 105,  83,  64,  49,  43, 232, 209, 187, 164, 143, 115,  96,  80,  68,  64 },
+    {  21,  31,  52,  75,  98, 129, 153, 177, 201, 224,   0,  24,  48,  72,  96, 128, 152, 176, 200, 224,  22,  32,  52,  75,  98, 129, 153, 177, 201, 225,  43,  49,  64,  83, 105, 135, 157, 181, 204, 228 },
+    {  31,  21,  31,  52,  75, 106, 129, 153, 177, 201,  24,   0,  24,  48,  72, 104, 128, 152, 176, 200,  32,  22,  32,  52,  75, 106, 129, 153, 177, 201,  49,  43,  49,  64,  83, 112, 135, 157, 181, 204 },
+    {  52,  31,  21,  31,  52,  82, 106, 129, 153, 177,  48,  24,   0,  24,  48,  80, 104, 128, 152, 176,  52,  32,  22,  32,  52,  82, 106, 129, 153, 177,  64,  49,  43,  49,  64,  90, 112, 135, 157, 181 },
+    {  75,  52,  31,  21,  31,  59,  82, 106, 129, 153,  72,  48,  24,   0,  24,  56,  80, 104, 128, 152,  75,  52,  32,  22,  32,  60,  82, 106, 129, 153,  83,  64,  49,  43,  49,  70,  90, 112, 135, 157 },
+    {  98,  75,  52,  31,  21,  38,  59,  82, 106, 129,  96,  72,  48,  24,   0,  32,  56,  80, 104, 128,  98,  75,  52,  32,  22,  38,  60,  82, 106, 129, 105,  83,  64,  49,  43,  53,  70,  90, 112, 135 },
+    { 129, 106,  82,  59,  38,  21,  31,  52,  75,  98, 128, 104,  80,  56,  32,   0,  24,  48,  72,  96, 129, 106,  82,  60,  38,  22,  32,  52,  75,  98, 135, 112,  90,  70,  53,  43,  49,  64,  83, 105 },
+    { 153, 129, 106,  82,  59,  31,  21,  31,  52,  75, 152, 128, 104,  80,  56,  24,   0,  24,  48,  72, 153, 129, 106,  82,  60,  32,  22,  32,  52,  75, 157, 135, 112,  90,  70,  49,  43,  49,  64,  83 },
+    { 177, 153, 129, 106,  82,  52,  31,  21,  31,  52, 176, 152, 128, 104,  80,  48,  24,   0,  24,  48, 177, 153, 129, 106,  82,  52,  32,  22,  32,  52, 181, 157, 135, 112,  90,  64,  49,  43,  49,  64 },
+    { 201, 177, 153, 129, 106,  75,  52,  31,  21,  31, 200, 176, 152, 128, 104,  72,  48,  24,   0,  24, 201, 177, 153, 129, 106,  75,  52,  32,  22,  32, 204, 181, 157, 135, 112,  83,  64,  49,  43,  49 },
+    { 224, 201, 177, 153, 129,  98,  75,  52,  31,  21, 224, 200, 176, 152, 128,  96,  72,  48,  24,   0, 225, 201, 177, 153, 129,  98,  75,  52,  32,  22, 228, 204, 181, 157, 135, 105,  83,  64,  49,  43 },
+    {  43,  49,  64,  83, 105, 135, 157, 181, 204, 228,  22,  32,  52,  75,  98, 129, 153, 177, 201, 225,   0,  24,  48,  72,  96, 128, 152, 176, 200, 224,  21,  31,  52,  75,  98, 129, 153, 177, 201, 224 },
+    {  49,  43,  49,  64,  83, 112, 135, 157, 181, 204,  32,  22,  32,  52,  75, 106, 129, 153, 177, 201,  24,   0,  24,  48,  72, 104, 128, 152, 176, 200,  31,  21,  31,  52,  75, 106, 129, 153, 177, 201 },
+    {  64,  49,  43,  49,  64,  90, 112, 135, 157, 181,  52,  32,  22,  32,  52,  82, 106, 129, 153, 177,  48,  24,   0,  24,  48,  80, 104, 128, 152, 176,  52,  31,  21,  31,  52,  82, 106, 129, 153, 177 },
+    {  83,  64,  49,  43,  49,  70,  90, 112, 135, 157,  75,  52,  32,  22,  32,  60,  82, 106, 129, 153,  72,  48,  24,   0,  24,  56,  80, 104, 128, 152,  75,  52,  31,  21,  31,  59,  82, 106, 129, 153 },
+    { 105,  83,  64,  49,  43,  53,  70,  90, 112, 135,  98,  75,  52,  32,  22,  38,  60,  82, 106, 129,  96,  72,  48,  24,   0,  32,  56,  80, 104, 128,  98,  75,  52,  31,  21,  38,  59,  82, 106, 129 },
+    { 135, 112,  90,  70,  53,  43,  49,  64,  83, 105, 129, 106,  82,  60,  38,  22,  32,  52,  75,  98, 128, 104,  80,  56,  32,   0,  24,  48,  72,  96, 129, 106,  82,  59,  38,  21,  31,  52,  75,  98 },
+    { 157, 135, 112,  90,  70,  49,  43,  49,  64,  83, 153, 129, 106,  82,  60,  32,  22,  32,  52,  75, 152, 128, 104,  80,  56,  24,   0,  24,  48,  72, 153, 129, 106,  82,  59,  31,  21,  31,  52,  75 },
+    { 181, 157, 135, 112,  90,  64,  49,  43,  49,  64, 177, 153, 129, 106,  82,  52,  32,  22,  32,  52, 176, 152, 128, 104,  80,  48,  24,   0,  24,  48, 177, 153, 129, 106,  82,  52,  31,  21,  31,  52 },
+    { 204, 181, 157, 135, 112,  83,  64,  49,  43,  49, 201, 177, 153, 129, 106,  75,  52,  32,  22,  32, 200, 176, 152, 128, 104,  72,  48,  24,   0,  24, 201, 177, 153, 129, 106,  75,  52,  31,  21,  31 },
+    { 228, 204, 181, 157, 135, 105,  83,  64,  49,  43, 225, 201, 177, 153, 129,  98,  75,  52,  32,  22, 224, 200, 176, 152, 128,  96,  72,  48,  24,   0, 224, 201, 177, 153, 129,  98,  75,  52,  31,  21 },
+    {  64,  68,  80,  96, 115, 143, 164, 187, 209, 232,  43,  49,  64,  83, 105, 135, 157, 181, 204, 228,  21,  31,  52,  75,  98, 129, 153, 177, 201, 224,   0,  24,  48,  72,  96, 128, 152, 176, 200, 224 },
+    {  68,  64,  68,  80,  96, 122, 143, 164, 187, 209,  49,  43,  49,  64,  83, 112, 135, 157, 181, 204,  31,  21,  31,  52,  75, 106, 129, 153, 177, 201,  24,   0,  24,  48,  72, 104, 128, 152, 176, 200 },
+    {  80,  68,  64,  68,  80, 102, 122, 143, 164, 187,  64,  49,  43,  49,  64,  90, 112, 135, 157, 181,  52,  31,  21,  31,  52,  82, 106, 129, 153, 177,  48,  24,   0,  24,  48,  80, 104, 128, 152, 176 },
+    {  96,  80,  68,  64,  68,  85, 102, 122, 143, 164,  83,  64,  49,  43,  49,  70,  90, 112, 135, 157,  75,  52,  31,  21,  31,  59,  82, 106, 129, 153,  72,  48,  24,   0,  24,  56,  80, 104, 128, 152 },
+    { 115,  96,  80,  68,  64,  71,  85, 102, 122, 143, 105,  83,  64,  49,  43,  53,  70,  90, 112, 135,  98,  75,  52,  31,  21,  38,  59,  82, 106, 129,  96,  72,  48,  24,   0,  32,  56,  80, 104, 128 },
+    { 143, 122, 102,  85,  71,  64,  68,  80,  96, 115, 135, 112,  90,  70,  53,  43,  49,  64,  83, 105, 129, 106,  82,  59,  38,  21,  31,  52,  75,  98, 128, 104,  80,  56,  32,   0,  24,  48,  72,  96 },
+    { 164, 143, 122, 102,  85,  68,  64,  68,  80,  96, 157, 135, 112,  90,  70,  49,  43,  49,  64,  83, 153, 129, 106,  82,  59,  31,  21,  31,  52,  75, 152, 128, 104,  80,  56,  24,   0,  24,  48,  72 },
+    { 187, 164, 143, 122, 102,  80,  68,  64,  68,  80, 181, 157, 135, 112,  90,  64,  49,  43,  49,  64, 177, 153, 129, 106,  82,  52,  31,  21,  31,  52, 176, 152, 128, 104,  80,  48,  24,   0,  24,  48 },
+    { 209, 187, 164, 143, 122,  96,  80,  68,  64,  68, 204, 181, 157, 135, 112,  83,  64,  49,  43,  49, 201, 177, 153, 129, 106,  75,  52,  31,  21,  31, 200, 176, 152, 128, 104,  72,  48,  24,   0,  24 },
+    { 232, 209, 187, 164, 143, 115,  96,  80,  68,  64, 228, 204, 181, 157, 135, 105,  83,  64,  49,  43, 224, 201, 177, 153, 129,  98,  75,  52,  31,  21, 224, 200, 176, 152, 128,  96,  72,  48,  24,   0 },
+};
+// clang-format on
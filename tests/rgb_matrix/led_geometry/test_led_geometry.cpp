@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include <lib/lib8tion/lib8tion.h>
+
+extern uint32_t          flush_count;
+extern const led_point_t k_rgb_matrix_center;
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+class LedGeometry : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+    }
+};
+
+TEST_F(LedGeometry, TableMatchesRuntimeMath) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        EXPECT_EQ(pgm_read_byte(&g_led_geometry[i].dist), sqrt16(dx * dx + dy * dy)) << "LED " << +i;
+        EXPECT_EQ(pgm_read_byte(&g_led_geometry[i].angle), atan2_8(dy, dx)) << "LED " << +i;
+    }
+}
+
+TEST_F(LedGeometry, DistanceTableMatchesRuntimeMath) {
+    for (uint8_t hit = 0; hit < RGB_MATRIX_LED_COUNT; hit++) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            int16_t dx = g_led_config.point[i].x - g_led_config.point[hit].x;
+            int16_t dy = g_led_config.point[i].y - g_led_config.point[hit].y;
+            EXPECT_EQ(pgm_read_byte(&g_led_distance[hit][i]), sqrt16(dx * dx + dy * dy)) << "LED " << +i << " from " << +hit;
+        }
+    }
+}
+
+/* Records the host time taken per frame by every effect, while keys are being
+ * pressed so that the reactive effects have something to render. */
+TEST_F(LedGeometry, FrameTimeBenchmark) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    auto key_a = KeymapKey(0, 4, 1, KC_A);
+    auto key_b = KeymapKey(0, 7, 2, KC_B);
+    set_keymap({key_a, key_b});
+
+    for (uint8_t mode = RGB_MATRIX_NONE + 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        rgb_matrix_mode_noeeprom(mode);
+        idle_for(100);
+
+        flush_count      = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 10; i++) {
+            tap_key(i % 2 ? key_a : key_b);
+            idle_for(100);
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        ASSERT_GT(flush_count, 0) << effect_names[mode] << " never finished a frame";
+        RecordProperty(std::string(effect_names[mode]) + "_ns_per_frame", (int)(elapsed.count() / flush_count));
+    }
+}
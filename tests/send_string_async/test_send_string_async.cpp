@@ -0,0 +1,122 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {};
+
+TEST_F(SendStringAsync, StringIsTypedOneReportPerScan) {
+    TestDriver driver;
+    InSequence s;
+
+    // Nothing is sent until the queue is drained
+    EXPECT_NO_REPORT(driver);
+    send_string_with_delay_async("aB", 0);
+    EXPECT_TRUE(send_string_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(send_string_busy());
+}
+
+TEST_F(SendStringAsync, DelaysAreKept) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_with_delay_async("a" SS_DELAY(50) "b", 0);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(49);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, KeyPressesWaitForTheString) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_X);
+    set_keymap({key});
+
+    send_string_with_delay_async("ab", 0);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    key.press();
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, SynchronousStringIsTypedAfterTheQueue) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_with_delay_async("a", 0);
+    send_string_with_delay("b", 0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(send_string_busy());
+}
+
+TEST_F(SendStringAsync, StringLongerThanTheQueueIsTypedInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    // The queue holds 8 presses and releases, the first ones are typed to make room
+    for (uint8_t keycode = KC_A; keycode <= KC_F; keycode++) {
+        EXPECT_REPORT(driver, (keycode));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string_with_delay_async("abcdef", 0);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(send_string_busy());
+}
+
+TEST_F(SendStringAsync, TapCodesAndModifiers) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_with_delay_async(SS_LCTL("c") SS_TAP(X_ENTER), 0);
+    idle_for(6);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../split_transport_benchmark.hpp"
+
+class SplitBatch : public SplitTransportBenchmark {};
+
+TEST_F(SplitBatch, SlaveKeyReachesHost) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, MATRIX_ROWS_PER_HAND, KC_A);
+    set_keymap({key});
+
+    split_sim_link_t link = {.baud = 115200};
+    split_sim_configure(&link);
+    ASSERT_TRUE(split_sim_start());
+    idle_for(10);
+
+    EXPECT_REPORT(driver, (KC_A));
+    split_sim_press_key(1, 0);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    split_sim_release_key(1, 0);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitBatch, Benchmark) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 2, MATRIX_ROWS_PER_HAND, KC_D);
+    set_keymap({key});
+
+    static const struct {
+        const char      *name;
+        split_sim_link_t link;
+    } links[] = {
+        {"batched 115200", {.baud = 115200, .latency_us = 20}},
+        {"batched 38400", {.baud = 38400, .latency_us = 20}},
+        {"batched 115200 1000ppm", {.baud = 115200, .latency_us = 20, .bit_error_ppm = 1000, .seed = 5}},
+    };
+
+    for (const auto &entry : links) {
+        SplitBenchmarkResult result = run(driver, key, entry.link, 100);
+        report(entry.name, result);
+
+        EXPECT_EQ(result.missed, 0u) << entry.name;
+        if (entry.link.bit_error_ppm == 0) {
+            EXPECT_EQ(result.failures, 0u) << entry.name;
+            EXPECT_EQ(result.spurious, 0u) << entry.name;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../split_encoder.hpp"
+
+class SplitBatchEncoder : public SplitEncoder {};
+
+TEST_F(SplitBatchEncoder, SlaveEncoderStepsReachMaster) {
+    split_sim_link_t link = {.baud = 115200};
+    turn_encoder_while_holding_key(link);
+}
+
+TEST_F(SplitBatchEncoder, SlaveEncoderStepsReachMasterOnSlowLink) {
+    split_sim_link_t link = {.baud = 38400, .latency_us = 20};
+    turn_encoder_while_holding_key(link);
+}
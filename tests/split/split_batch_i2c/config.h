@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SPLIT_TRANSPORT_MIRROR
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_LED_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+#define SPLIT_ACTIVITY_ENABLE
+
+#define USE_I2C
+#define SPLIT_TRANSACTION_BATCH_ENABLE
+#define SPLIT_MAX_CONNECTION_ERRORS 1
+#define SPLIT_CONNECTION_CHECK_TIMEOUT 500
+
+#define NUM_ENCODERS_LEFT 1
+#define NUM_ENCODERS_RIGHT 1
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPLIT_KEYBOARD = yes
+ENCODER_ENABLE = yes
+ENCODER_DRIVER = custom
+
+SRC += split_sim.c
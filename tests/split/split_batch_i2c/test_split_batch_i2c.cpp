@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../split_encoder.hpp"
+
+class SplitBatchI2C : public SplitEncoder {};
+
+TEST_F(SplitBatchI2C, SlaveKeyReachesHost) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 4, MATRIX_ROWS_PER_HAND + 1, KC_E);
+    set_keymap({key});
+
+    split_sim_link_t link = {.baud = 400000};
+    split_sim_configure(&link);
+    ASSERT_TRUE(split_sim_start());
+    // Scans before the slave started already failed, wait out the reconnection throttle
+    idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 10);
+
+    EXPECT_REPORT(driver, (KC_E));
+    split_sim_press_key(4, 1);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    split_sim_release_key(4, 1);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    // Everything went through the batch exchange
+    const split_sim_stats_t *stats = split_sim_get_stats();
+    EXPECT_GT(stats->transactions[EXCHANGE_BATCH].attempts, 0u);
+    EXPECT_EQ(stats->transactions[EXCHANGE_BATCH].failures, 0u);
+    EXPECT_EQ(stats->transactions[GET_SLAVE_MATRIX_CHECKSUM].attempts, 0u);
+}
+
+TEST_F(SplitBatchI2C, SlaveEncoderStepsReachMaster) {
+    split_sim_link_t link = {.baud = 400000};
+    turn_encoder_while_holding_key(link);
+}
+
+TEST_F(SplitBatchI2C, Benchmark) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 2, MATRIX_ROWS_PER_HAND, KC_D);
+    set_keymap({key});
+
+    static const struct {
+        const char      *name;
+        split_sim_link_t link;
+    } links[] = {
+        {"batched i2c 100k", {.baud = 100000, .latency_us = 10}},
+        {"batched i2c 400k", {.baud = 400000, .latency_us = 10}},
+    };
+
+    for (const auto &entry : links) {
+        SplitBenchmarkResult result = run(driver, key, entry.link, 100);
+        report(entry.name, result);
+
+        EXPECT_EQ(result.missed, 0u) << entry.name;
+        EXPECT_EQ(result.failures, 0u) << entry.name;
+        EXPECT_EQ(result.spurious, 0u) << entry.name;
+    }
+}
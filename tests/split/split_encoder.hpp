@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "split_transport_benchmark.hpp"
+
+extern "C" {
+#include "encoder.h"
+#include "split_util.h"
+}
+
+// Encoder steps seen by the master, in the order they were handled
+static std::vector<std::pair<uint8_t, bool>> encoder_steps;
+
+extern "C" {
+void encoder_driver_init(void) {}
+
+void encoder_driver_task(void) {}
+
+bool encoder_update_user(uint8_t index, bool clockwise) {
+    encoder_steps.emplace_back(index, clockwise);
+    return false;
+}
+}
+
+/* Turns the slave half's encoder while one of its keys is held. The config
+ * disconnects on the first failed round of transactions, which would release
+ * the key. */
+class SplitEncoder : public SplitTransportBenchmark {
+   public:
+    void SetUp() override {
+        encoder_steps.clear();
+    }
+
+    void turn_encoder_while_holding_key(const split_sim_link_t &link) {
+        TestDriver driver;
+        auto       key = KeymapKey(0, 1, MATRIX_ROWS_PER_HAND, KC_A);
+        set_keymap({key});
+
+        split_sim_configure(&link);
+        ASSERT_TRUE(split_sim_start());
+        // Scans before the slave started already failed, wait out the reconnection throttle
+        idle_for(SPLIT_CONNECTION_CHECK_TIMEOUT + 10);
+
+        EXPECT_REPORT(driver, (KC_A));
+        split_sim_press_key(1, 0);
+        idle_for(2);
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_NO_REPORT(driver);
+        std::vector<std::pair<uint8_t, bool>> expected;
+        for (uint8_t i = 0; i < 20; i++) {
+            // Single steps, then bursts which queue up on the slave between scans
+            for (uint8_t step = 0; step <= i % 3; step++) {
+                split_sim_turn_encoder(NUM_ENCODERS_LEFT, i % 2);
+                expected.emplace_back(NUM_ENCODERS_LEFT, i % 2);
+            }
+            for (uint8_t ms = 0; ms < 5 + i % 4; ms++) {
+                run_one_scan_loop();
+                ASSERT_TRUE(is_transport_connected()) << "after step " << (int)i;
+            }
+        }
+        VERIFY_AND_CLEAR(driver);
+        EXPECT_EQ(encoder_steps, expected);
+
+        EXPECT_EMPTY_REPORT(driver);
+        split_sim_release_key(1, 0);
+        idle_for(2);
+        VERIFY_AND_CLEAR(driver);
+    }
+};
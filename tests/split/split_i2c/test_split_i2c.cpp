@@ -0,0 +1,56 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../split_transport_benchmark.hpp"
+
+class SplitI2C : public SplitTransportBenchmark {};
+
+TEST_F(SplitI2C, SlaveKeyReachesHost) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 4, MATRIX_ROWS_PER_HAND + 1, KC_E);
+    set_keymap({key});
+
+    split_sim_link_t link = {.baud = 400000};
+    split_sim_configure(&link);
+    ASSERT_TRUE(split_sim_start());
+    idle_for(10);
+
+    EXPECT_REPORT(driver, (KC_E));
+    split_sim_press_key(4, 1);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    split_sim_release_key(4, 1);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(split_sim_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM].attempts, 0u);
+    EXPECT_EQ(split_sim_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM].failures, 0u);
+}
+
+TEST_F(SplitI2C, Benchmark) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 2, MATRIX_ROWS_PER_HAND, KC_D);
+    set_keymap({key});
+
+    static const struct {
+        const char      *name;
+        split_sim_link_t link;
+    } links[] = {
+        {"i2c 100k", {.baud = 100000, .latency_us = 10}},
+        {"i2c 400k", {.baud = 400000, .latency_us = 10}},
+        {"i2c 400k 1000ppm", {.baud = 400000, .latency_us = 10, .bit_error_ppm = 1000, .seed = 5}},
+    };
+
+    for (const auto &entry : links) {
+        SplitBenchmarkResult result = run(driver, key, entry.link, 100);
+        report(entry.name, result);
+
+        EXPECT_EQ(result.missed, 0u) << entry.name;
+        if (entry.link.bit_error_ppm == 0) {
+            EXPECT_EQ(result.failures, 0u) << entry.name;
+            EXPECT_EQ(result.spurious, 0u) << entry.name;
+        }
+    }
+}
@@ -0,0 +1,196 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "split_sim.h"
+#include "timer.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InvokeWithoutArgs;
+
+// Which TRANSACTIONS_* handler drives each transaction
+static const char *split_transaction_handler(int8_t id) {
+    switch (id) {
+#ifdef USE_I2C
+        case I2C_EXECUTE_CALLBACK:
+            return "(callback)";
+#endif
+        case GET_SLAVE_MATRIX_CHECKSUM:
+        case GET_SLAVE_MATRIX_DATA:
+            return "SLAVE_MATRIX";
+#ifdef SPLIT_TRANSPORT_MIRROR
+        case PUT_MASTER_MATRIX:
+            return "MASTER_MATRIX";
+#endif
+#ifndef DISABLE_SYNC_TIMER
+        case PUT_SYNC_TIMER:
+            return "SYNC_TIMER";
+#endif
+#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+        case PUT_LAYER_STATE:
+        case PUT_DEFAULT_LAYER_STATE:
+            return "LAYER_STATE";
+#endif
+#ifdef SPLIT_LED_STATE_ENABLE
+        case PUT_LED_STATE:
+            return "LED_STATE";
+#endif
+#ifdef SPLIT_MODS_ENABLE
+        case PUT_MODS:
+            return "MODS";
+#endif
+#ifdef SPLIT_ACTIVITY_ENABLE
+        case PUT_ACTIVITY:
+            return "ACTIVITY";
+#endif
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+        case EXCHANGE_BATCH:
+            return "BATCH";
+#endif
+        default:
+            return "(other)";
+    }
+}
+
+struct SplitHandlerStats {
+    uint32_t attempts = 0;
+    uint32_t failures = 0;
+};
+
+struct SplitBenchmarkResult {
+    uint32_t                                 elapsed_us   = 0;
+    uint32_t                                 transactions = 0;
+    uint32_t                                 failures     = 0;
+    uint32_t                                 bytes        = 0;
+    uint32_t                                 busy_us      = 0;
+    uint32_t                                 bit_errors   = 0;
+    std::vector<uint32_t>                    latencies_us;
+    uint32_t                                 missed   = 0; // key changes the host never saw
+    uint32_t                                 spurious = 0; // reports nobody asked for
+    std::map<std::string, SplitHandlerStats> handlers;
+
+    double transactions_per_second() const {
+        return elapsed_us ? transactions * 1e6 / elapsed_us : 0;
+    }
+    uint32_t latency_avg_us() const {
+        if (latencies_us.empty()) return 0;
+        uint64_t sum = 0;
+        for (uint32_t latency : latencies_us) {
+            sum += latency;
+        }
+        return sum / latencies_us.size();
+    }
+    uint32_t latency_max_us() const {
+        return latencies_us.empty() ? 0 : *std::max_element(latencies_us.begin(), latencies_us.end());
+    }
+};
+
+/* Taps a key on the slave half over and over, timing how long each change
+ * takes to reach the host, and records what the link went through meanwhile. */
+class SplitTransportBenchmark : public TestFixture {
+   public:
+    void TearDown() override {
+        split_sim_stop();
+    }
+
+    SplitBenchmarkResult run(TestDriver &driver, const KeymapKey &key, const split_sim_link_t &link, uint16_t taps) {
+        SplitBenchmarkResult result;
+
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(InvokeWithoutArgs([&] { result.spurious++; }));
+
+        split_sim_configure(&link);
+        EXPECT_TRUE(split_sim_start());
+        // Connect and get through the first round of state syncing
+        idle_for(100);
+        split_sim_reset_stats();
+
+        uint32_t start = timer_read_us();
+        for (uint16_t i = 0; i < taps; i++) {
+            measure(driver, key, true, result);
+            idle_for(20 + i % 7);
+            measure(driver, key, false, result);
+            idle_for(20 + i % 11);
+        }
+        result.elapsed_us = timer_read_us() - start;
+
+        const split_sim_stats_t *stats = split_sim_get_stats();
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+            SplitHandlerStats &handler = result.handlers[split_transaction_handler(id)];
+            handler.attempts += stats->transactions[id].attempts;
+            handler.failures += stats->transactions[id].failures;
+            result.transactions += stats->transactions[id].attempts;
+            result.failures += stats->transactions[id].failures;
+        }
+        result.bytes      = stats->bytes;
+        result.busy_us    = stats->busy_us;
+        result.bit_errors = stats->bit_errors;
+
+        split_sim_stop();
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return result;
+    }
+
+    static void report(const char *name, const SplitBenchmarkResult &result) {
+        std::string prefix = name;
+        std::replace(prefix.begin(), prefix.end(), ' ', '_');
+        prefix += "_";
+        RecordProperty(prefix + "transactions_per_second", (int)result.transactions_per_second());
+        RecordProperty(prefix + "busy_percent", std::to_string(result.elapsed_us ? result.busy_us * 100.0 / result.elapsed_us : 0));
+        RecordProperty(prefix + "latency_avg_us", result.latency_avg_us());
+        RecordProperty(prefix + "latency_max_us", result.latency_max_us());
+        RecordProperty(prefix + "retries", result.failures);
+        RecordProperty(prefix + "missed", result.missed);
+        RecordProperty(prefix + "spurious", result.spurious);
+        for (const auto &handler : result.handlers) {
+            if (handler.second.attempts == 0) continue;
+            RecordProperty(prefix + handler.first + "_attempts", handler.second.attempts);
+            RecordProperty(prefix + handler.first + "_retries", handler.second.failures);
+        }
+    }
+
+   private:
+    void measure(TestDriver &driver, const KeymapKey &key, bool pressed, SplitBenchmarkResult &result) {
+        bool     reported    = false;
+        uint32_t reported_at = 0;
+        auto     seen        = [&] {
+            reported    = true;
+            reported_at = timer_read_us();
+        };
+        if (pressed) {
+            EXPECT_REPORT(driver, (key.code)).WillOnce(InvokeWithoutArgs(seen));
+        } else {
+            EXPECT_EMPTY_REPORT(driver).WillOnce(InvokeWithoutArgs(seen));
+        }
+
+        uint32_t start = timer_read_us();
+        if (pressed) {
+            split_sim_press_key(key.position.col, key.position.row - MATRIX_ROWS_PER_HAND);
+        } else {
+            split_sim_release_key(key.position.col, key.position.row - MATRIX_ROWS_PER_HAND);
+        }
+        for (uint16_t ms = 0; ms < 1000 && !reported; ms++) {
+            run_one_scan_loop();
+        }
+
+        if (reported) {
+            result.latencies_us.push_back(reported_at - start);
+        } else {
+            result.missed++;
+        }
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(InvokeWithoutArgs([&] { result.spurious++; }));
+    }
+};
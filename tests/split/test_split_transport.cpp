@@ -0,0 +1,119 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_transport_benchmark.hpp"
+
+using testing::_;
+
+class SplitTransport : public SplitTransportBenchmark {};
+
+TEST_F(SplitTransport, SlaveKeyReachesHost) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, MATRIX_ROWS_PER_HAND, KC_A);
+    set_keymap({key});
+
+    split_sim_link_t link = {.baud = 115200};
+    split_sim_configure(&link);
+    ASSERT_TRUE(split_sim_start());
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    split_sim_press_key(1, 0);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    split_sim_release_key(1, 0);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(split_sim_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM].attempts, 0u);
+    EXPECT_EQ(split_sim_get_stats()->transactions[GET_SLAVE_MATRIX_CHECKSUM].failures, 0u);
+}
+
+TEST_F(SplitTransport, SlaveHalfIsReleasedOnDisconnect) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 3, MATRIX_ROWS_PER_HAND + 1, KC_B);
+    set_keymap({key});
+
+    split_sim_link_t link = {.baud = 115200};
+    split_sim_configure(&link);
+    ASSERT_TRUE(split_sim_start());
+    idle_for(10);
+
+    EXPECT_REPORT(driver, (KC_B));
+    split_sim_press_key(3, 1);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    split_sim_stop();
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitTransport, LinkTimeIsAccounted) {
+    TestDriver driver;
+    set_keymap({});
+
+    // 10 bit frames at 10k baud: 1ms per byte, plus the turnarounds
+    split_sim_link_t link = {.baud = 10000, .latency_us = 50};
+    split_sim_configure(&link);
+    ASSERT_TRUE(split_sim_start());
+    idle_for(100);
+
+    const split_sim_stats_t *stats = split_sim_get_stats();
+    EXPECT_GT(stats->bytes, 0u);
+    EXPECT_GE(stats->busy_us, stats->bytes * 1000);
+    EXPECT_GT(timer_read_us(), 100000 + stats->busy_us - 1000);
+}
+
+TEST_F(SplitTransport, NoisyLinkRecovers) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, MATRIX_ROWS_PER_HAND, KC_C);
+    set_keymap({key});
+
+    split_sim_link_t     link   = {.baud = 115200, .bit_error_ppm = 2000, .seed = 7};
+    SplitBenchmarkResult result = run(driver, key, link, 50);
+
+    EXPECT_GT(result.bit_errors, 0u);
+    EXPECT_GT(result.failures, 0u);
+    EXPECT_EQ(result.missed, 0u);
+    EXPECT_EQ(result.latencies_us.size(), 100u);
+}
+
+TEST_F(SplitTransport, Benchmark) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 2, MATRIX_ROWS_PER_HAND, KC_D);
+    set_keymap({key});
+
+    static const struct {
+        const char      *name;
+        split_sim_link_t link;
+    } links[] = {
+        {"serial 115200", {.baud = 115200, .latency_us = 20}},
+        {"serial 460800", {.baud = 460800, .latency_us = 20}},
+        {"serial 38400", {.baud = 38400, .latency_us = 20}},
+        {"serial 115200 100ppm", {.baud = 115200, .latency_us = 20, .bit_error_ppm = 100, .seed = 3}},
+        {"serial 115200 1000ppm", {.baud = 115200, .latency_us = 20, .bit_error_ppm = 1000, .seed = 5}},
+    };
+
+    std::vector<SplitBenchmarkResult> results;
+    for (const auto &entry : links) {
+        results.push_back(run(driver, key, entry.link, 100));
+        report(entry.name, results.back());
+
+        EXPECT_EQ(results.back().missed, 0u) << entry.name;
+        if (entry.link.bit_error_ppm == 0) {
+            EXPECT_EQ(results.back().failures, 0u) << entry.name;
+            EXPECT_EQ(results.back().spurious, 0u) << entry.name;
+            EXPECT_LE(results.back().latency_max_us(), 20000u) << entry.name;
+        }
+    }
+
+    // Every scan of the master waits on the link, so a slower one shows in the latency
+    EXPECT_LT(results[1].latency_avg_us(), results[0].latency_avg_us());
+    EXPECT_LT(results[0].latency_avg_us(), results[2].latency_avg_us());
+}
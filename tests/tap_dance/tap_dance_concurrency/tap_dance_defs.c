@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "tap_dance_defs.h"
+
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_LCTL_A] = ACTION_TAP_DANCE_DOUBLE(KC_LCTL, KC_A),
+    [TD_LSFT_B] = ACTION_TAP_DANCE_DOUBLE(KC_LSFT, KC_B),
+    [TD_LALT_C] = ACTION_TAP_DANCE_DOUBLE(KC_LALT, KC_C),
+    [TD_LGUI_D] = ACTION_TAP_DANCE_DOUBLE(KC_LGUI, KC_D),
+    [TD_RCTL_E] = ACTION_TAP_DANCE_DOUBLE(KC_RCTL, KC_E),
+    [TD_RSFT_F] = ACTION_TAP_DANCE_DOUBLE(KC_RSFT, KC_F),
+    [TD_RALT_G] = ACTION_TAP_DANCE_DOUBLE(KC_RALT, KC_G),
+    [TD_RGUI_H] = ACTION_TAP_DANCE_DOUBLE(KC_RGUI, KC_H),
+    [TD_I_J]    = ACTION_TAP_DANCE_DOUBLE(KC_I, KC_J),
+};
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One more dance than TAP_DANCE_MAX_SIMULTANEOUS, each one is a modifier on
+// single tap and a letter on double tap.
+enum tap_dance_ids {
+    TD_LCTL_A,
+    TD_LSFT_B,
+    TD_LALT_C,
+    TD_LGUI_D,
+    TD_RCTL_E,
+    TD_RSFT_F,
+    TD_RALT_G,
+    TD_RGUI_H,
+    TD_I_J,
+};
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+TAP_DANCE_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = tap_dance_defs.c
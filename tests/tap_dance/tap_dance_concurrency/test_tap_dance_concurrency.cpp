@@ -0,0 +1,151 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+#include "tap_dance_defs.h"
+
+using testing::_;
+using testing::InSequence;
+
+static const uint8_t held_mods[] = {KC_LCTL, KC_LSFT, KC_LALT, KC_LGUI, KC_RCTL, KC_RSFT, KC_RALT, KC_RGUI};
+
+class TapDanceConcurrency : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    void SetUp() override {
+        for (uint8_t i = 0; i <= TD_I_J; i++) {
+            keys.push_back(KeymapKey{0, i, 0, TD(i)});
+            add_key(keys.back());
+        }
+    }
+
+    /* Matches a report holding the single tap modifiers of the first `count` dances, plus `extra` if set. */
+    static testing::Matcher<report_keyboard_t &> held_report(uint8_t count, uint8_t extra = KC_NO) {
+        std::vector<uint8_t> report(held_mods, held_mods + count);
+        if (extra != KC_NO) {
+            report.push_back(extra);
+        }
+        return testing::MakeMatcher(new KeyboardReportMatcher(report));
+    }
+
+    /* Holds the first `count` dances, each one finished as a single tap by the press of the next one, or by the
+     * tapping term for the last one. */
+    void hold_dances(TestDriver &driver, uint8_t count) {
+        for (uint8_t i = 0; i < count; i++) {
+            if (i > 0) {
+                EXPECT_CALL(driver, send_keyboard_mock(held_report(i))).Times(testing::AtLeast(1));
+            }
+            keys[i].press();
+            run_one_scan_loop();
+            VERIFY_AND_CLEAR(driver);
+        }
+        EXPECT_CALL(driver, send_keyboard_mock(held_report(count))).Times(testing::AtLeast(1));
+        idle_for(TAPPING_TERM + 1);
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    /* Releases the first `count` dances, last one first. */
+    void release_dances(TestDriver &driver, uint8_t count) {
+        for (uint8_t i = count; i-- > 0;) {
+            EXPECT_CALL(driver, send_keyboard_mock(held_report(i))).Times(testing::AtLeast(1));
+            keys[i].release();
+            run_one_scan_loop();
+            VERIFY_AND_CLEAR(driver);
+        }
+    }
+};
+
+TEST_F(TapDanceConcurrency, HoldsAsManyDancesAsStates) {
+    TestDriver driver;
+
+    hold_dances(driver, TAP_DANCE_MAX_SIMULTANEOUS);
+    release_dances(driver, TAP_DANCE_MAX_SIMULTANEOUS);
+}
+
+TEST_F(TapDanceConcurrency, DanceWithoutStateIsIgnored) {
+    TestDriver driver;
+
+    hold_dances(driver, TAP_DANCE_MAX_SIMULTANEOUS);
+
+    /* Every state is in use, so the extra dance does nothing */
+    EXPECT_NO_REPORT(driver);
+    tap_key(keys[TD_I_J]);
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Releasing one of the dances frees its state for the extra one */
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(TAP_DANCE_MAX_SIMULTANEOUS - 1))).Times(testing::AtLeast(1));
+    keys[TAP_DANCE_MAX_SIMULTANEOUS - 1].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(TAP_DANCE_MAX_SIMULTANEOUS - 1, KC_I))).Times(testing::AtLeast(1));
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(TAP_DANCE_MAX_SIMULTANEOUS - 1))).Times(testing::AtLeast(1));
+    tap_key(keys[TD_I_J]);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    release_dances(driver, TAP_DANCE_MAX_SIMULTANEOUS - 1);
+}
+
+TEST_F(TapDanceConcurrency, TimeoutWhileOtherDancesAreHeld) {
+    TestDriver driver;
+    InSequence s;
+    const uint8_t held = TAP_DANCE_MAX_SIMULTANEOUS - 1;
+
+    hold_dances(driver, held);
+
+    /* A single tap finishes exactly one tapping term after the tap */
+    EXPECT_NO_REPORT(driver);
+    tap_key(keys[held]);
+    idle_for(TAPPING_TERM - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(held + 1))).Times(testing::AtLeast(1));
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(held))).Times(testing::AtLeast(1));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* A double tap still works, the timer having been restarted by the second tap */
+    EXPECT_NO_REPORT(driver);
+    tap_key(keys[held]);
+    idle_for(TAPPING_TERM - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(held, KC_H))).Times(testing::AtLeast(1));
+    keys[held].press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(held_report(held))).Times(testing::AtLeast(1));
+    keys[held].release();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    release_dances(driver, held);
+}
+
+TEST_F(TapDanceConcurrency, InterruptedDancesDoNotTimeOutLater) {
+    TestDriver driver;
+
+    /* Tap every dance in turn, each tap interrupting the previous dance */
+    for (uint8_t round = 0; round < 10; round++) {
+        for (uint8_t i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
+            EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+            tap_key(keys[i]);
+        }
+    }
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing is left held, and no timeout fires once the last dance has finished */
+    EXPECT_NO_REPORT(driver);
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define CHORDAL_HOLD
+#define FLOW_TAP_TERM 150
+#define PERMISSIVE_HOLD
+#define SPECULATIVE_HOLD
+
+// Small enough that ordinary rolls over a held mod-tap overflow it.
+#define WAITING_BUFFER_SIZE 4
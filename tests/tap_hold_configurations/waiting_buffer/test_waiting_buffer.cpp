@@ -0,0 +1,151 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class WaitingBuffer : public TestFixture {};
+
+TEST_F(WaitingBuffer, overflow_settles_mod_tap_as_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, ALT_T(KC_P));
+    auto       key_j       = KeymapKey(0, 6, 1, KC_J);
+    auto       key_k       = KeymapKey(0, 7, 1, KC_K);
+    auto       key_l       = KeymapKey(0, 8, 1, KC_L);
+    auto       key_scln    = KeymapKey(0, 9, 1, KC_SCLN);
+
+    set_keymap({mod_tap_key, key_j, key_k, key_l, key_scln});
+
+    // Press mod-tap-hold key and three regular keys, which fills the buffer.
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(10);
+    key_j.press();
+    idle_for(10);
+    key_k.press();
+    idle_for(10);
+    key_l.press();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    // The next press does not fit, so the mod-tap key is settled as held and
+    // every buffered key is still sent, in order.
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_REPORT(driver, (KC_LALT, KC_J));
+    EXPECT_REPORT(driver, (KC_LALT, KC_J, KC_K));
+    EXPECT_REPORT(driver, (KC_LALT, KC_J, KC_K, KC_L));
+    EXPECT_REPORT(driver, (KC_LALT, KC_J, KC_K, KC_L, KC_SCLN));
+    key_scln.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Release all keys.
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(4);
+    EXPECT_EMPTY_REPORT(driver);
+    key_j.release();
+    key_k.release();
+    key_l.release();
+    key_scln.release();
+    run_one_scan_loop();
+    mod_tap_key.release();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_mods(), 0);
+}
+
+/* Replays a pseudo-random 100k event typing trace of rolls over home row
+ * mod-taps and regular keys, with a waiting buffer small enough to overflow
+ * constantly. Every regular key press must reach the host exactly once, and no
+ * key or mod may be left stuck once all keys are released. */
+TEST_F(WaitingBuffer, soak_random_typing_trace) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+    std::map<uint8_t, int> presses;
+    std::map<uint8_t, int> sent;
+    std::vector<uint8_t>   previous_keys;
+    report_keyboard_t      last_report = {};
+
+    // clang-format off
+    const uint16_t mod_taps[] = {
+        LCTL_T(KC_1), LSFT_T(KC_2), LALT_T(KC_3), LGUI_T(KC_4),
+        RGUI_T(KC_7), RALT_T(KC_8), RSFT_T(KC_9), RCTL_T(KC_0),
+    };
+    const uint16_t regular[] = {
+        KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P,
+        KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K, KC_L, KC_SCLN,
+    };
+    // clang-format on
+    for (uint8_t i = 0; i < 8; i++) {
+        keys.push_back(KeymapKey(0, i < 4 ? i : i + 2, 0, mod_taps[i]));
+    }
+    for (uint8_t i = 0; i < 20; i++) {
+        keys.push_back(KeymapKey(0, i % MATRIX_COLS, 1 + i / MATRIX_COLS, regular[i]));
+    }
+    for (auto &key : keys) {
+        add_key(key);
+    }
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([&](report_keyboard_t &report) {
+        std::vector<uint8_t> current;
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i] != KC_NO) current.push_back(report.keys[i]);
+        }
+        for (uint8_t code : current) {
+            // Only count regular keys, mod-tap taps send the digits.
+            if (code >= KC_1 && code <= KC_0) continue;
+            if (std::find(previous_keys.begin(), previous_keys.end(), code) == previous_keys.end()) {
+                sent[code]++;
+            }
+        }
+        previous_keys = current;
+        last_report   = report;
+    });
+
+    uint32_t seed = 1;
+    auto     next = [&](uint32_t range) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % range;
+    };
+
+    std::vector<size_t> held;
+    uint32_t            events = 0;
+    while (events < 100000) {
+        const bool release = !held.empty() && (held.size() >= 4 || next(100) < 45);
+        if (release) {
+            const size_t i = next(held.size());
+            keys[held[i]].release();
+            held.erase(held.begin() + i);
+        } else {
+            size_t k;
+            do {
+                k = next(keys.size());
+            } while (std::find(held.begin(), held.end(), k) != held.end());
+            keys[k].press();
+            held.push_back(k);
+            if (k >= 8) presses[keys[k].code]++;
+        }
+        events++;
+        idle_for(1 + next(40));
+
+        if (held.empty() && next(100) < 20) {
+            idle_for(TAPPING_TERM * 2);
+            ASSERT_EQ(presses, sent) << "after " << events << " events";
+            ASSERT_EQ(get_mods(), 0) << "after " << events << " events";
+            ASSERT_EQ(get_speculative_mods(), 0) << "after " << events << " events";
+            ASSERT_EQ(last_report, report_keyboard_t{}) << "after " << events << " events";
+        }
+    }
+    VERIFY_AND_CLEAR(driver);
+}
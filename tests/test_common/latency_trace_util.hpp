@@ -0,0 +1,28 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "latency_trace.h"
+}
+
+/**
+ * @brief Expects `events` key events to have been traced on `path`, one of
+ * latency_trace_path_t, since the start of the test.
+ */
+#define EXPECT_LATENCY_COUNT(path, events) EXPECT_EQ(latency_trace_get_stats(path)->count, (uint32_t)(events)) << "key events traced on " #path
+
+/**
+ * @brief Expects every key event traced on `path` to have reached the host
+ * within `max_us` microseconds of its matrix scan.
+ */
+#define EXPECT_LATENCY_LE(path, max_us) EXPECT_LE(latency_trace_get_stats(path)->max, (uint32_t)(max_us)) << "worst latency of " #path
+
+/**
+ * @brief Expects no key event traced on `path` to have reached the host
+ * sooner than `min_us` microseconds after its matrix scan.
+ */
+#define EXPECT_LATENCY_GE(path, min_us) EXPECT_GE(latency_trace_get_stats(path)->min, (uint32_t)(min_us)) << "best latency of " #path
@@ -18,15 +18,67 @@
 #include "test_matrix.h"
 #include <string.h>
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+#    include "matrix_event_queue.h"
+#endif
+
+#ifdef SPLIT_KEYBOARD
+#    include "split_util.h"
+#    include "transport.h"
+#endif
+
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+// Key changes are already debounced here, so each row settles on its new state
+static void mark_row(uint8_t row) {
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    matrix_event_queue_mark_row(row, matrix[row]);
+#endif
+}
+
 void matrix_init(void) {
     clear_all_keys();
     matrix_init_kb();
 }
 
+#ifdef SPLIT_KEYBOARD
+/* Same exchange as matrix_post_scan(), the other half's rows come from
+ * whichever transport the test links in. */
+static void matrix_split_exchange(void) {
+    uint8_t this_hand = is_keyboard_left() ? 0 : MATRIX_ROWS_PER_HAND;
+    uint8_t that_hand = MATRIX_ROWS_PER_HAND - this_hand;
+
+    if (is_keyboard_master()) {
+        static bool  last_connected                     = false;
+        matrix_row_t slave_matrix[MATRIX_ROWS_PER_HAND] = {0};
+        if (transport_master_if_connected(matrix + this_hand, slave_matrix)) {
+            memcpy(matrix + that_hand, slave_matrix, sizeof(slave_matrix));
+            for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+                mark_row(that_hand + row);
+            }
+            last_connected = true;
+        } else if (last_connected) {
+            // reset other half when disconnected
+            memset(matrix + that_hand, 0, sizeof(slave_matrix));
+            for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+                mark_row(that_hand + row);
+            }
+            last_connected = false;
+        }
+    } else {
+        transport_slave(matrix + that_hand, matrix + this_hand);
+    }
+}
+#endif
+
 uint8_t matrix_scan(void) {
+#ifdef SPLIT_KEYBOARD
+    matrix_split_exchange();
+#endif
     matrix_scan_kb();
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    matrix_event_queue_sync();
+#endif
     return 1;
 }
 
@@ -42,10 +94,12 @@ void matrix_scan_kb(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+    mark_row(row);
 }
 
 void release_key(uint8_t col, uint8_t row) {
     matrix[row] &= ~((matrix_row_t)1 << col);
+    mark_row(row);
 }
 
 bool matrix_is_on(uint8_t row, uint8_t col) {
@@ -54,6 +108,9 @@ bool matrix_is_on(uint8_t row, uint8_t col) {
 
 void clear_all_keys(void) {
     memset(matrix, 0, sizeof(matrix));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        mark_row(row);
+    }
 }
 
 void led_set(uint8_t usb_led) {}
@@ -15,6 +15,7 @@
  */
 
 #include "test_driver.hpp"
+#include "timer.h"
 
 TestDriver* TestDriver::m_this = nullptr;
 
@@ -44,21 +45,34 @@ uint8_t TestDriver::keyboard_leds(void) {
     return m_this->m_leds;
 }
 
+void TestDriver::poll(uint8_t report_type) {
+    if (m_polling_interval && m_has_reported[report_type] && timer_elapsed32(m_last_report[report_type]) < m_polling_interval) {
+        test_logger.trace() << "report " << +report_type << " sent before the host polled" << std::endl;
+        m_stalled_reports++;
+    }
+    m_last_report[report_type]  = timer_read32();
+    m_has_reported[report_type] = true;
+}
+
 void TestDriver::send_keyboard(report_keyboard_t* report) {
+    m_this->poll(REPORT_ID_KEYBOARD);
     test_logger.trace() << *report;
     m_this->send_keyboard_mock(*report);
 }
 
 void TestDriver::send_nkro(report_nkro_t* report) {
+    m_this->poll(REPORT_ID_NKRO);
     m_this->send_nkro_mock(*report);
 }
 
 void TestDriver::send_mouse(report_mouse_t* report) {
+    m_this->poll(REPORT_ID_MOUSE);
     test_logger.trace() << std::setw(10) << std::left << "send_mouse: (X:" << (int)report->x << ", Y:" << (int)report->y << ", H:" << (int)report->h << ", V:" << (int)report->v << ", B:" << (int)report->buttons << ")" << std::endl;
     m_this->send_mouse_mock(*report);
 }
 
 void TestDriver::send_extra(report_extra_t* report) {
+    m_this->poll(report->report_id);
     m_this->send_extra_mock(*report);
 }
 
@@ -33,6 +33,19 @@ class TestDriver {
         m_leds = leds;
     }
 
+    /**
+     * @brief Simulates a host that takes one report of each type every `interval`
+     * milliseconds. Reports sent before the host has taken the previous one, which
+     * would block on a real endpoint, are counted by `stalled_reports()`.
+     * An interval of 0 takes every report straight away.
+     */
+    void set_polling_interval(uint16_t interval) {
+        m_polling_interval = interval;
+    }
+    unsigned stalled_reports() const {
+        return m_stalled_reports;
+    }
+
     MOCK_METHOD1(send_keyboard_mock, void(report_keyboard_t&));
     MOCK_METHOD1(send_nkro_mock, void(report_nkro_t&));
     MOCK_METHOD1(send_mouse_mock, void(report_mouse_t&));
@@ -44,8 +57,13 @@ class TestDriver {
     static void        send_nkro(report_nkro_t* report);
     static void        send_mouse(report_mouse_t* report);
     static void        send_extra(report_extra_t* report);
+    void               poll(uint8_t report_type);
     host_driver_t      m_driver;
-    uint8_t            m_leds = 0;
+    uint8_t            m_leds             = 0;
+    uint16_t           m_polling_interval = 0;
+    unsigned           m_stalled_reports  = 0;
+    uint32_t           m_last_report[REPORT_ID_COUNT + 1];
+    bool               m_has_reported[REPORT_ID_COUNT + 1] = {};
     static TestDriver* m_this;
 };
 
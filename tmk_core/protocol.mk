@@ -46,6 +46,10 @@ ifeq ($(strip $(NKRO_ENABLE)), yes)
     SHARED_EP_ENABLE = yes
 endif
 
+ifeq ($(strip $(REPORT_SCHEDULER_ENABLE)), yes)
+    OPT_DEFS += -DREPORT_SCHEDULER_ENABLE
+endif
+
 ifeq ($(strip $(NO_SUSPEND_POWER_DOWN)), yes)
     OPT_DEFS += -DNO_SUSPEND_POWER_DOWN
 endif
@@ -36,6 +36,31 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "connection.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string.h"
+#endif
+
+#ifdef REPORT_SCHEDULER_ENABLE
+#    include <string.h>
+#    include "timer.h"
+
+#    ifndef REPORT_SCHEDULER_INTERVAL
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define REPORT_SCHEDULER_INTERVAL USB_POLLING_INTERVAL_MS
+#        else
+#            define REPORT_SCHEDULER_INTERVAL 1
+#        endif
+#    endif
+
+#    ifndef REPORT_SCHEDULER_QUEUE_SIZE
+#        define REPORT_SCHEDULER_QUEUE_SIZE 4
+#    endif
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 
@@ -71,8 +96,166 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+#ifdef REPORT_SCHEDULER_ENABLE
+/* Each report type keeps the last report handed to the driver and a queue of
+ * states that have not been sent yet, one per polling interval. A new state
+ * replaces the last queued one as long as the host would not miss a press or
+ * release because of it, otherwise it is queued behind it. The queued states
+ * are sent in order, each once the polling interval since the last report has
+ * passed. Only when the queue is full is its oldest state sent early.
+ */
+typedef struct report_schedule_t {
+    uint8_t  queued;
+    uint32_t sent_time;
+} report_schedule_t;
+
+static report_schedule_t keyboard_schedule;
+static report_keyboard_t keyboard_sent;
+static report_keyboard_t keyboard_queue[REPORT_SCHEDULER_QUEUE_SIZE];
+#    ifdef NKRO_ENABLE
+static report_schedule_t nkro_schedule;
+static report_nkro_t     nkro_sent;
+static report_nkro_t     nkro_queue[REPORT_SCHEDULER_QUEUE_SIZE];
+#    endif
+static report_schedule_t mouse_schedule;
+static report_mouse_t    mouse_queue[REPORT_SCHEDULER_QUEUE_SIZE];
+static report_schedule_t system_schedule;
+static uint16_t          system_sent;
+static uint16_t          system_queue[REPORT_SCHEDULER_QUEUE_SIZE];
+static report_schedule_t consumer_schedule;
+static uint16_t          consumer_sent;
+static uint16_t          consumer_queue[REPORT_SCHEDULER_QUEUE_SIZE];
+
+static void report_schedule_reset(report_schedule_t *schedule) {
+    // The first report does not have to wait
+    schedule->queued    = 0;
+    schedule->sent_time = timer_read32() - REPORT_SCHEDULER_INTERVAL;
+}
+
+static void report_scheduler_reset(void) {
+    report_schedule_reset(&keyboard_schedule);
+    memset(&keyboard_sent, 0, sizeof(keyboard_sent));
+#    ifdef NKRO_ENABLE
+    report_schedule_reset(&nkro_schedule);
+    memset(&nkro_sent, 0, sizeof(nkro_sent));
+#    endif
+    report_schedule_reset(&mouse_schedule);
+    report_schedule_reset(&system_schedule);
+    system_sent = 0;
+    report_schedule_reset(&consumer_schedule);
+    consumer_sent = 0;
+}
+
+static bool report_due(report_schedule_t *schedule) {
+    return timer_elapsed32(schedule->sent_time) >= REPORT_SCHEDULER_INTERVAL;
+}
+
+static void report_sent(report_schedule_t *schedule) {
+    schedule->sent_time = timer_read32();
+}
+
+/* Picks the slot for a new state in a queue that holds at least one: the last
+ * one, which it replaces, or a new one after it if replacing the last state
+ * would hide a change from the host. A full queue sends its oldest state early
+ * to make room.
+ */
+static uint8_t report_schedule_push(report_schedule_t *schedule, bool hides_change, void (*send_oldest)(void)) {
+    if (hides_change) {
+        if (schedule->queued == REPORT_SCHEDULER_QUEUE_SIZE) {
+            send_oldest();
+        }
+        schedule->queued++;
+    }
+    return schedule->queued - 1;
+}
+
+/* Takes the oldest state off a queue, into out. */
+static void report_schedule_pop(report_schedule_t *schedule, void *queue, void *out, size_t size) {
+    memcpy(out, queue, size);
+    schedule->queued--;
+    memmove(queue, (uint8_t *)queue + size, schedule->queued * size);
+}
+
+/* Whether replacing pending with next would hide a bit from the host: one set
+ * since the state before it, sent or queued, and cleared again, or one cleared
+ * and set again.
+ */
+static bool bits_hide_change(uint8_t sent, uint8_t pending, uint8_t next) {
+    return (pending & ~sent & ~next) | (sent & ~pending & next);
+}
+
+static bool keyboard_report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool keyboard_report_hides_change(const report_keyboard_t *sent, const report_keyboard_t *pending, const report_keyboard_t *next) {
+    if (bits_hide_change(sent->mods, pending->mods, next->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t pressed = pending->keys[i];
+        if (pressed && !keyboard_report_has_key(sent, pressed) && !keyboard_report_has_key(next, pressed)) {
+            return true;
+        }
+        uint8_t released = sent->keys[i];
+        if (released && !keyboard_report_has_key(pending, released) && keyboard_report_has_key(next, released)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#    ifdef NKRO_ENABLE
+static bool nkro_report_hides_change(const report_nkro_t *sent, const report_nkro_t *pending, const report_nkro_t *next) {
+    if (bits_hide_change(sent->mods, pending->mods, next->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if (bits_hide_change(sent->bits[i], pending->bits[i], next->bits[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+#    endif
+
+/* Adds the movement of next to pending, unless the buttons change, as the
+ * host would otherwise move the pointer with the new buttons, or the sum does
+ * not fit in a report.
+ */
+static bool mouse_report_merge(report_mouse_t *pending, const report_mouse_t *next) {
+    if (pending->buttons != next->buttons) {
+        return false;
+    }
+
+    int32_t x = (int32_t)pending->x + next->x;
+    int32_t y = (int32_t)pending->y + next->y;
+    int32_t v = (int32_t)pending->v + next->v;
+    int32_t h = (int32_t)pending->h + next->h;
+    if (x < MOUSE_REPORT_XY_MIN || x > MOUSE_REPORT_XY_MAX || y < MOUSE_REPORT_XY_MIN || y > MOUSE_REPORT_XY_MAX || v < MOUSE_REPORT_HV_MIN || v > MOUSE_REPORT_HV_MAX || h < MOUSE_REPORT_HV_MIN || h > MOUSE_REPORT_HV_MAX) {
+        return false;
+    }
+
+    *pending   = *next;
+    pending->x = x;
+    pending->y = y;
+    pending->v = v;
+    pending->h = h;
+    return true;
+}
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
+#ifdef REPORT_SCHEDULER_ENABLE
+    // Pending reports were meant for the previous driver
+    report_scheduler_reset();
+#endif
 }
 
 host_driver_t *host_get_driver(void) {
@@ -116,6 +299,14 @@ void host_task(void) {
         active_host = next_host;
     }
 #endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+    send_string_task();
+#endif
+
+#ifdef REPORT_SCHEDULER_ENABLE
+    host_report_scheduler_task();
+#endif
 }
 
 static host_driver_t *host_get_active_driver(void) {
@@ -174,15 +365,24 @@ led_t host_keyboard_led_state(void) {
 }
 
 /* send report */
-void host_keyboard_send(report_keyboard_t *report) {
+static void host_keyboard_send_now(report_keyboard_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_keyboard) return;
 
+#ifdef REPORT_SCHEDULER_ENABLE
+    keyboard_sent = *report;
+    report_sent(&keyboard_schedule);
+#endif
+
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
     (*driver->send_keyboard)(report);
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report();
+#endif
+
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
         for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
@@ -192,13 +392,59 @@ void host_keyboard_send(report_keyboard_t *report) {
     }
 }
 
-void host_nkro_send(report_nkro_t *report) {
+#ifdef REPORT_SCHEDULER_ENABLE
+static void host_keyboard_send_queued(void) {
+    report_keyboard_t report;
+    report_schedule_pop(&keyboard_schedule, keyboard_queue, &report, sizeof(report));
+    host_keyboard_send_now(&report);
+}
+
+static void host_keyboard_schedule(report_keyboard_t *report) {
+    if (keyboard_schedule.queued) {
+        uint8_t last         = keyboard_schedule.queued - 1;
+        bool    hides_change = keyboard_report_hides_change(last ? &keyboard_queue[last - 1] : &keyboard_sent, &keyboard_queue[last], report);
+        uint8_t slot         = report_schedule_push(&keyboard_schedule, hides_change, host_keyboard_send_queued);
+        keyboard_queue[slot] = *report;
+    } else {
+        keyboard_queue[0]        = *report;
+        keyboard_schedule.queued = 1;
+    }
+#    ifdef LATENCY_TRACE_ENABLE
+    // Its traced events complete once the states queued ahead of it have been sent
+    latency_trace_report_queued(keyboard_schedule.queued - 1);
+#    endif
+}
+#endif
+
+void host_keyboard_send(report_keyboard_t *report) {
+#ifdef REPORT_SCHEDULER_ENABLE
+    if (keyboard_schedule.queued || !report_due(&keyboard_schedule)) {
+        host_keyboard_schedule(report);
+        return;
+    }
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_queued(0);
+#endif
+    host_keyboard_send_now(report);
+}
+
+static void host_nkro_send_now(report_nkro_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_nkro) return;
 
+#if defined(REPORT_SCHEDULER_ENABLE) && defined(NKRO_ENABLE)
+    nkro_sent = *report;
+    report_sent(&nkro_schedule);
+#endif
+
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report();
+#endif
+
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
         for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
@@ -208,10 +454,51 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
-void host_mouse_send(report_mouse_t *report) {
+#if defined(REPORT_SCHEDULER_ENABLE) && defined(NKRO_ENABLE)
+static void host_nkro_send_queued(void) {
+    report_nkro_t report;
+    report_schedule_pop(&nkro_schedule, nkro_queue, &report, sizeof(report));
+    host_nkro_send_now(&report);
+}
+
+static void host_nkro_schedule(report_nkro_t *report) {
+    if (nkro_schedule.queued) {
+        uint8_t last         = nkro_schedule.queued - 1;
+        bool    hides_change = nkro_report_hides_change(last ? &nkro_queue[last - 1] : &nkro_sent, &nkro_queue[last], report);
+        uint8_t slot         = report_schedule_push(&nkro_schedule, hides_change, host_nkro_send_queued);
+        nkro_queue[slot]     = *report;
+    } else {
+        nkro_queue[0]        = *report;
+        nkro_schedule.queued = 1;
+    }
+#    ifdef LATENCY_TRACE_ENABLE
+    // Its traced events complete once the states queued ahead of it have been sent
+    latency_trace_report_queued(nkro_schedule.queued - 1);
+#    endif
+}
+#endif
+
+void host_nkro_send(report_nkro_t *report) {
+#if defined(REPORT_SCHEDULER_ENABLE) && defined(NKRO_ENABLE)
+    if (nkro_schedule.queued || !report_due(&nkro_schedule)) {
+        host_nkro_schedule(report);
+        return;
+    }
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_queued(0);
+#endif
+    host_nkro_send_now(report);
+}
+
+static void host_mouse_send_now(report_mouse_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_mouse) return;
 
+#ifdef REPORT_SCHEDULER_ENABLE
+    report_sent(&mouse_schedule);
+#endif
+
 #ifdef MOUSE_SHARED_EP
     report->report_id = REPORT_ID_MOUSE;
 #endif
@@ -223,33 +510,130 @@ void host_mouse_send(report_mouse_t *report) {
     (*driver->send_mouse)(report);
 }
 
-void host_system_send(uint16_t usage) {
-    if (usage == last_system_usage) return;
-    last_system_usage = usage;
+#ifdef REPORT_SCHEDULER_ENABLE
+static void host_mouse_send_queued(void) {
+    report_mouse_t report;
+    report_schedule_pop(&mouse_schedule, mouse_queue, &report, sizeof(report));
+    host_mouse_send_now(&report);
+}
+#endif
 
+void host_mouse_send(report_mouse_t *report) {
+#ifdef REPORT_SCHEDULER_ENABLE
+    if (mouse_schedule.queued) {
+        if (mouse_report_merge(&mouse_queue[mouse_schedule.queued - 1], report)) {
+            return;
+        }
+        uint8_t slot      = report_schedule_push(&mouse_schedule, true, host_mouse_send_queued);
+        mouse_queue[slot] = *report;
+        return;
+    }
+    if (!report_due(&mouse_schedule)) {
+        mouse_queue[0]        = *report;
+        mouse_schedule.queued = 1;
+        return;
+    }
+#endif
+    host_mouse_send_now(report);
+}
+
+static void host_extra_send_now(uint8_t report_id, uint16_t usage) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_extra) return;
 
+#ifdef REPORT_SCHEDULER_ENABLE
+    if (report_id == REPORT_ID_SYSTEM) {
+        system_sent = usage;
+        report_sent(&system_schedule);
+    } else {
+        consumer_sent = usage;
+        report_sent(&consumer_schedule);
+    }
+#endif
+
     report_extra_t report = {
-        .report_id = REPORT_ID_SYSTEM,
+        .report_id = report_id,
         .usage     = usage,
     };
     (*driver->send_extra)(&report);
 }
 
+#ifdef REPORT_SCHEDULER_ENABLE
+static void host_system_send_queued(void) {
+    uint16_t usage;
+    report_schedule_pop(&system_schedule, system_queue, &usage, sizeof(usage));
+    host_extra_send_now(REPORT_ID_SYSTEM, usage);
+}
+
+static void host_consumer_send_queued(void) {
+    uint16_t usage;
+    report_schedule_pop(&consumer_schedule, consumer_queue, &usage, sizeof(usage));
+    host_extra_send_now(REPORT_ID_CONSUMER, usage);
+}
+
+/* A usage only replaces the last queued one if that one is already what the
+ * host will have before it, otherwise it is queued after it.
+ */
+static void host_extra_schedule(uint8_t report_id, report_schedule_t *schedule, uint16_t sent, uint16_t *queue, void (*send_oldest)(void), uint16_t usage) {
+    if (schedule->queued) {
+        uint8_t last         = schedule->queued - 1;
+        bool    hides_change = queue[last] != (last ? queue[last - 1] : sent);
+        uint8_t slot         = report_schedule_push(schedule, hides_change, send_oldest);
+        queue[slot]          = usage;
+        return;
+    }
+    if (!report_due(schedule)) {
+        queue[0]         = usage;
+        schedule->queued = 1;
+        return;
+    }
+    host_extra_send_now(report_id, usage);
+}
+#endif
+
+void host_system_send(uint16_t usage) {
+    if (usage == last_system_usage) return;
+    last_system_usage = usage;
+
+#ifdef REPORT_SCHEDULER_ENABLE
+    host_extra_schedule(REPORT_ID_SYSTEM, &system_schedule, system_sent, system_queue, host_system_send_queued, usage);
+#else
+    host_extra_send_now(REPORT_ID_SYSTEM, usage);
+#endif
+}
+
 void host_consumer_send(uint16_t usage) {
     if (usage == last_consumer_usage) return;
     last_consumer_usage = usage;
 
-    host_driver_t *driver = host_get_active_driver();
-    if (!driver || !driver->send_extra) return;
+#ifdef REPORT_SCHEDULER_ENABLE
+    host_extra_schedule(REPORT_ID_CONSUMER, &consumer_schedule, consumer_sent, consumer_queue, host_consumer_send_queued, usage);
+#else
+    host_extra_send_now(REPORT_ID_CONSUMER, usage);
+#endif
+}
 
-    report_extra_t report = {
-        .report_id = REPORT_ID_CONSUMER,
-        .usage     = usage,
-    };
-    (*driver->send_extra)(&report);
+#ifdef REPORT_SCHEDULER_ENABLE
+void host_report_scheduler_task(void) {
+    if (keyboard_schedule.queued && report_due(&keyboard_schedule)) {
+        host_keyboard_send_queued();
+    }
+#    ifdef NKRO_ENABLE
+    if (nkro_schedule.queued && report_due(&nkro_schedule)) {
+        host_nkro_send_queued();
+    }
+#    endif
+    if (mouse_schedule.queued && report_due(&mouse_schedule)) {
+        host_mouse_send_queued();
+    }
+    if (system_schedule.queued && report_due(&system_schedule)) {
+        host_system_send_queued();
+    }
+    if (consumer_schedule.queued && report_due(&consumer_schedule)) {
+        host_consumer_send_queued();
+    }
 }
+#endif
 
 #ifdef JOYSTICK_ENABLE
 void host_joystick_send(joystick_t *joystick) {
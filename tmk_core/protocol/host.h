@@ -30,6 +30,12 @@ extern "C" {
 void host_init(void);
 void host_task(void);
 
+/**
+ * Sends the reports held back by REPORT_SCHEDULER_ENABLE whose polling
+ * interval has passed. Called from host_task().
+ */
+void host_report_scheduler_task(void);
+
 /* host driver */
 void           host_set_driver(host_driver_t *driver);
 host_driver_t *host_get_driver(void);